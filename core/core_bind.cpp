@@ -35,7 +35,9 @@
 #include "core/crypto/crypto_core.h"
 #include "core/debugger/engine_debugger.h"
 #include "core/debugger/script_debugger.h"
+#include "core/io/file_access_pack.h"
 #include "core/io/marshalls.h"
+#include "core/io/resource_importer.h"
 #include "core/math/geometry_2d.h"
 #include "core/math/geometry_3d.h"
 #include "core/os/keyboard.h"
@@ -132,6 +134,76 @@ Vector<String> ResourceLoader::list_directory(const String &p_directory) {
 	return ::ResourceLoader::list_directory(p_directory);
 }
 
+void ResourceLoader::prefetch_files(const PackedStringArray &p_paths) {
+	PackedData *pd = PackedData::get_singleton();
+	if (!pd || pd->is_disabled()) {
+		return;
+	}
+
+	Vector<String> paths;
+	for (const String &path : p_paths) {
+		String local_path = ::ResourceLoader::path_remap(ResourceUID::ensure_path(path));
+		if (ResourceFormatImporter::get_singleton()) {
+			// Imported resources are loaded from their imported file.
+			String imported_path = ResourceFormatImporter::get_singleton()->get_internal_resource_path(local_path);
+			if (!imported_path.is_empty()) {
+				local_path = imported_path;
+			}
+		}
+		paths.push_back(local_path);
+	}
+	pd->prefetch(paths);
+}
+
+Dictionary ResourceLoader::get_prefetch_status() const {
+	Dictionary ret;
+	PackedData::PrefetchStatus status;
+	if (PackedData::get_singleton()) {
+		status = PackedData::get_singleton()->get_prefetch_status();
+	}
+	ret["pending"] = status.pending;
+	ret["completed"] = status.completed;
+	ret["bytes"] = status.bytes;
+	ret["hits"] = status.hits;
+	ret["misses"] = status.misses;
+	return ret;
+}
+
+void ResourceLoader::set_profiling_enabled(bool p_enabled) {
+	::ResourceLoader::set_profiling_enabled(p_enabled);
+}
+
+bool ResourceLoader::is_profiling_enabled() const {
+	return ::ResourceLoader::is_profiling_enabled();
+}
+
+TypedArray<Dictionary> ResourceLoader::get_profile(bool p_clear) const {
+	TypedArray<Dictionary> ret;
+	for (const ::ResourceLoader::LoadProfileEvent &event : ::ResourceLoader::get_profile_events(p_clear)) {
+		Dictionary d;
+		d["path"] = event.path;
+		d["parent"] = event.parent;
+		d["phase"] = event.phase;
+		d["thread_id"] = event.thread_id;
+		d["begin_usec"] = event.begin_usec;
+		d["duration_usec"] = event.end_usec - event.begin_usec;
+		ret.push_back(d);
+	}
+	return ret;
+}
+
+void ResourceLoader::clear_profile() {
+	::ResourceLoader::clear_profile();
+}
+
+Error ResourceLoader::save_profile(const String &p_path) const {
+	Error err;
+	Ref<FileAccess> f = FileAccess::open(p_path, FileAccess::WRITE, &err);
+	ERR_FAIL_COND_V_MSG(f.is_null(), err, vformat("Cannot save load profile to '%s'.", p_path));
+	f->store_string(::ResourceLoader::get_profile_as_chrome_trace());
+	return OK;
+}
+
 void ResourceLoader::_bind_methods() {
 	ClassDB::bind_method(D_METHOD("load_threaded_request", "path", "type_hint", "use_sub_threads", "cache_mode"), &ResourceLoader::load_threaded_request, DEFVAL(""), DEFVAL(false), DEFVAL(CACHE_MODE_REUSE));
 	ClassDB::bind_method(D_METHOD("load_threaded_get_status", "path", "progress"), &ResourceLoader::load_threaded_get_status, DEFVAL_ARRAY);
@@ -148,6 +220,13 @@ void ResourceLoader::_bind_methods() {
 	ClassDB::bind_method(D_METHOD("exists", "path", "type_hint"), &ResourceLoader::exists, DEFVAL(""));
 	ClassDB::bind_method(D_METHOD("get_resource_uid", "path"), &ResourceLoader::get_resource_uid);
 	ClassDB::bind_method(D_METHOD("list_directory", "directory_path"), &ResourceLoader::list_directory);
+	ClassDB::bind_method(D_METHOD("prefetch_files", "paths"), &ResourceLoader::prefetch_files);
+	ClassDB::bind_method(D_METHOD("get_prefetch_status"), &ResourceLoader::get_prefetch_status);
+	ClassDB::bind_method(D_METHOD("set_profiling_enabled", "enabled"), &ResourceLoader::set_profiling_enabled);
+	ClassDB::bind_method(D_METHOD("is_profiling_enabled"), &ResourceLoader::is_profiling_enabled);
+	ClassDB::bind_method(D_METHOD("get_profile", "clear"), &ResourceLoader::get_profile, DEFVAL(false));
+	ClassDB::bind_method(D_METHOD("clear_profile"), &ResourceLoader::clear_profile);
+	ClassDB::bind_method(D_METHOD("save_profile", "path"), &ResourceLoader::save_profile);
 
 	BIND_ENUM_CONSTANT(THREAD_LOAD_INVALID_RESOURCE);
 	BIND_ENUM_CONSTANT(THREAD_LOAD_IN_PROGRESS);
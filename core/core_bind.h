@@ -85,6 +85,15 @@ public:
 
 	Vector<String> list_directory(const String &p_directory);
 
+	void prefetch_files(const PackedStringArray &p_paths);
+	Dictionary get_prefetch_status() const;
+
+	void set_profiling_enabled(bool p_enabled);
+	bool is_profiling_enabled() const;
+	TypedArray<Dictionary> get_profile(bool p_clear = false) const;
+	void clear_profile();
+	Error save_profile(const String &p_path) const;
+
 	ResourceLoader() { singleton = this; }
 };
 
@@ -39,6 +39,7 @@
 #include "core/io/resource_loader.h"
 #include "core/math/expression.h"
 #include "core/object/script_language.h"
+#include "core/os/lock_profiler.h"
 #include "core/os/os.h"
 #include "servers/display_server.h"
 
@@ -94,6 +95,50 @@ public:
 	}
 };
 
+#ifdef LOCK_PROFILING_ENABLED
+// Sends the statistics of every named lock once per second, as "locks:profile_frame".
+// Each entry is `[name, acquisitions, contended, wait_usec, max_wait_usec, sites]`, where
+// `sites` holds `[file, line, contended, wait_usec]` for the call sites that owned the lock
+// while it was being waited on, longest wait first.
+// Passing `true` as the first option when enabling resets the counters.
+class RemoteDebugger::LockContentionProfiler : public EngineProfiler {
+	uint64_t last_send_time = 0;
+
+public:
+	void toggle(bool p_enable, const Array &p_opts) {
+		if (p_enable && p_opts.size() > 0 && bool(p_opts[0])) {
+			LockProfiler::reset();
+		}
+		last_send_time = 0;
+	}
+
+	void add(const Array &p_data) {}
+
+	void tick(double p_frame_time, double p_process_time, double p_physics_time, double p_physics_frame_time) {
+		uint64_t time = OS::get_singleton()->get_ticks_msec();
+		if (time - last_send_time < 1000) {
+			return;
+		}
+		last_send_time = time;
+
+		uint32_t count = LockProfiler::get_profile_count();
+		Array locks;
+		locks.resize(count);
+		for (uint32_t i = 0; i < count; i++) {
+			LockProfile::Stats stats = LockProfiler::get_stats(i);
+			Array sites;
+			sites.resize(stats.site_count);
+			for (uint32_t j = 0; j < stats.site_count; j++) {
+				const LockProfile::Site &site = stats.sites[j];
+				sites[j] = Array({ site.file ? String(site.file) : String(), site.line, site.contended, site.wait_usec });
+			}
+			locks[i] = Array({ String(stats.name), stats.acquisitions, stats.contended, stats.wait_usec, stats.max_wait_usec, sites });
+		}
+		EngineDebugger::get_singleton()->send_message("locks:profile_frame", locks);
+	}
+};
+#endif // LOCK_PROFILING_ENABLED
+
 Error RemoteDebugger::_put_msg(const String &p_message, const Array &p_data) {
 	Array msg = { p_message, Thread::get_caller_id(), p_data };
 	Error err = peer->put_message(msg);
@@ -714,6 +759,12 @@ RemoteDebugger::RemoteDebugger(Ref<RemoteDebuggerPeer> p_peer) {
 		profiler_enable("performance", true);
 	}
 
+#ifdef LOCK_PROFILING_ENABLED
+	// Lock contention profiler, enabled on request.
+	lock_contention_profiler.instantiate();
+	lock_contention_profiler->bind("locks");
+#endif // LOCK_PROFILING_ENABLED
+
 	// Core and profiler captures.
 	Capture core_cap(this,
 			[](void *p_user, const String &p_cmd, const Array &p_data, bool &r_captured) {
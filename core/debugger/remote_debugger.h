@@ -53,6 +53,12 @@ private:
 
 	Ref<PerformanceProfiler> performance_profiler;
 
+#ifdef LOCK_PROFILING_ENABLED
+	class LockContentionProfiler;
+
+	Ref<LockContentionProfiler> lock_contention_profiler;
+#endif // LOCK_PROFILING_ENABLED
+
 	Ref<RemoteDebuggerPeer> peer;
 
 	struct OutputString {
@@ -184,6 +184,8 @@ public:
 
 	virtual uint64_t get_buffer(uint8_t *p_dst, uint64_t p_length) const = 0; ///< get an array of bytes, needs to be overwritten by children.
 	Vector<uint8_t> get_buffer(int64_t p_length) const;
+	virtual const uint8_t *get_buffer_view(uint64_t p_length) const { return nullptr; } ///< get a read-only view of the next bytes without copying and advance the position, returns nullptr if not supported or not enough data is available.
+	virtual const uint8_t *map_read_only() { return nullptr; } ///< map the whole file into memory, the mapping stays valid until the file is closed, returns nullptr if not supported.
 	virtual String get_line() const;
 	virtual String get_token() const;
 	virtual Vector<String> get_csv_line(const String &p_delim = ",") const;
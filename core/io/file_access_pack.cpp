@@ -45,6 +45,52 @@ Error PackedData::add_pack(const String &p_path, bool p_replace_files, uint64_t
 	return ERR_FILE_UNRECOGNIZED;
 }
 
+void PackedData::remove_pack(const String &p_path) {
+	MutexLock lock(prefetch_mutex);
+	for (const String &path : get_file_paths()) {
+		String simplified_path = path.simplify_path().trim_prefix("res://");
+		PathMD5 pmd5(simplified_path.md5_buffer());
+		HashMap<PathMD5, PackedFile, PathMD5>::Iterator E = files.find(pmd5);
+		if (E && E->value.pack == p_path) {
+			remove_path(path);
+
+			// Drop directories that only held files of this pack.
+			PackedDir *cd = root;
+			for (const String &dir : simplified_path.get_base_dir().split("/", false)) {
+				HashMap<String, PackedDir *>::Iterator S = cd->subdirs.find(dir);
+				if (!S) {
+					cd = nullptr;
+					break;
+				}
+				cd = S->value;
+			}
+			while (cd && cd != root && cd->files.is_empty() && cd->subdirs.is_empty()) {
+				PackedDir *parent = cd->parent;
+				parent->subdirs.erase(cd->name);
+				memdelete(cd);
+				cd = parent;
+			}
+
+			if (prefetch_pending.erase(pmd5)) {
+				prefetch_status.pending--;
+			}
+			prefetch_warm.erase(pmd5);
+		}
+	}
+	for (List<PrefetchRequest>::Element *E = prefetch_queue.front(); E;) {
+		List<PrefetchRequest>::Element *N = E->next();
+		if (E->get().file.pack == p_path) {
+			prefetch_queue.erase(E);
+		}
+		E = N;
+	}
+	lock.temp_unlock();
+
+	for (int i = 0; i < sources.size(); i++) {
+		sources[i]->close_pack(p_path);
+	}
+}
+
 void PackedData::add_path(const String &p_pkg_path, const String &p_path, uint64_t p_ofs, uint64_t p_size, const uint8_t *p_md5, PackSource *p_src, bool p_replace_files, bool p_encrypted) {
 	String simplified_path = p_path.simplify_path().trim_prefix("res://");
 	PathMD5 pmd5(simplified_path.md5_buffer());
@@ -156,6 +202,91 @@ void PackedData::clear() {
 	files.clear();
 	_free_packed_dirs(root);
 	root = memnew(PackedDir);
+
+	MutexLock lock(prefetch_mutex);
+	prefetch_queue.clear();
+	prefetch_pending.clear();
+	prefetch_warm.clear();
+	prefetch_status.pending = 0;
+}
+
+void PackedData::prefetch(const Vector<String> &p_paths) {
+	MutexLock lock(prefetch_mutex);
+
+	int queued = 0;
+	for (const String &path : p_paths) {
+		PathMD5 pmd5(path.simplify_path().trim_prefix("res://").md5_buffer());
+		HashMap<PathMD5, PackedFile, PathMD5>::Iterator E = files.find(pmd5);
+		if (!E || prefetch_pending.has(pmd5) || prefetch_warm.has(pmd5)) {
+			continue; // Not packed, or already requested.
+		}
+
+		PrefetchRequest req;
+		req.md5 = pmd5;
+		req.path = path;
+		req.file = E->value;
+		prefetch_queue.push_back(req);
+		prefetch_pending.insert(pmd5);
+		queued++;
+	}
+
+	if (queued == 0) {
+		return;
+	}
+
+	prefetch_status.pending += queued;
+	prefetch_used.set();
+	if (!prefetch_thread.is_started()) {
+		prefetch_thread.start(_prefetch_thread_func, this);
+	}
+	for (int i = 0; i < queued; i++) {
+		prefetch_semaphore.post();
+	}
+}
+
+PackedData::PrefetchStatus PackedData::get_prefetch_status() const {
+	MutexLock lock(prefetch_mutex);
+	return prefetch_status;
+}
+
+void PackedData::_prefetch_record_open(const PathMD5 &p_md5) {
+	MutexLock lock(prefetch_mutex);
+	if (prefetch_warm.erase(p_md5)) {
+		prefetch_status.hits++;
+	} else if (prefetch_pending.has(p_md5)) {
+		prefetch_status.misses++;
+	}
+}
+
+void PackedData::_prefetch_thread_func(void *p_userdata) {
+	PackedData *pd = static_cast<PackedData *>(p_userdata);
+
+	while (true) {
+		pd->prefetch_semaphore.wait();
+		if (pd->prefetch_exit.is_set()) {
+			break;
+		}
+
+		MutexLock lock(pd->prefetch_mutex);
+		if (pd->prefetch_queue.is_empty()) {
+			continue; // Cleared meanwhile.
+		}
+		PrefetchRequest req = pd->prefetch_queue.front()->get();
+		pd->prefetch_queue.pop_front();
+
+		// Read unlocked, so opening files is never blocked by storage.
+		lock.temp_unlock();
+		uint64_t bytes = req.file.src->prefetch_file(req.path, &req.file);
+		lock.temp_relock();
+
+		if (!pd->prefetch_pending.erase(req.md5)) {
+			continue; // Cleared meanwhile.
+		}
+		pd->prefetch_warm.insert(req.md5);
+		pd->prefetch_status.pending--;
+		pd->prefetch_status.completed++;
+		pd->prefetch_status.bytes += bytes;
+	}
 }
 
 PackedData::PackedData() {
@@ -177,6 +308,12 @@ PackedData::~PackedData() {
 		singleton = nullptr;
 	}
 
+	if (prefetch_thread.is_started()) {
+		prefetch_exit.set();
+		prefetch_semaphore.post();
+		prefetch_thread.wait_to_finish();
+	}
+
 	for (int i = 0; i < sources.size(); i++) {
 		memdelete(sources[i]);
 	}
@@ -185,6 +322,30 @@ PackedData::~PackedData() {
 
 //////////////////////////////////////////////////////////////////
 
+uint64_t PackSource::prefetch_file(const String &p_path, PackedData::PackedFile *p_file) {
+	Ref<FileAccess> f = get_file(p_path, p_file);
+	if (f.is_null() || !f->is_open()) {
+		return 0;
+	}
+
+	// Reading the whole file through leaves it in the OS page cache.
+	uint8_t buffer[16384];
+	uint64_t total = 0;
+	while (true) {
+		uint64_t read = f->get_buffer(buffer, sizeof(buffer));
+		if (read == 0 || read > sizeof(buffer)) {
+			break;
+		}
+		total += read;
+		if (read < sizeof(buffer)) {
+			break;
+		}
+	}
+	return total;
+}
+
+//////////////////////////////////////////////////////////////////
+
 bool PackedSourcePCK::try_open_pack(const String &p_path, bool p_replace_files, uint64_t p_offset) {
 	Ref<FileAccess> f = FileAccess::open(p_path, FileAccess::READ);
 	if (f.is_null()) {
@@ -318,11 +479,97 @@ bool PackedSourcePCK::try_open_pack(const String &p_path, bool p_replace_files,
 		}
 	}
 
+	// The pack may have been replaced, map it again on next access. Open files keep the previous mapping alive.
+	close_pack(p_path);
+
 	return true;
 }
 
+PackedSourcePCK::MappedPack PackedSourcePCK::_map_pack(const String &p_path) {
+	MappedPack mp;
+	Ref<FileAccess> f = FileAccess::open(p_path, FileAccess::READ);
+	if (f.is_null()) {
+		return mp;
+	}
+
+	uint64_t length = f->get_length();
+	const uint8_t *data = f->map_read_only();
+	if (!data) {
+		return mp; // Not supported by the platform or the file system, use regular reads.
+	}
+	if (length == 0 || f->get_length() < length) {
+		WARN_PRINT(vformat("PCK \"%s\" changed while being memory-mapped, using regular reads.", p_path));
+		return mp;
+	}
+
+	mp.file = f;
+	mp.data = data;
+	mp.length = length;
+#ifdef DEBUG_ENABLED
+	print_verbose(vformat("PCK \"%s\" memory-mapped (%d bytes).", p_path, mp.length));
+#endif
+	return mp;
+}
+
+const uint8_t *PackedSourcePCK::_get_mapped_file(const PackedData::PackedFile *p_file, Ref<FileAccess> *r_owner) {
+	if (p_file->encrypted || !PackedData::get_singleton()->is_using_mmap()) {
+		return nullptr;
+	}
+
+	MutexLock lock(mapped_packs_mutex);
+	HashMap<String, MappedPack>::Iterator E = mapped_packs.find(p_file->pack);
+	if (!E) {
+		// Failed mappings are remembered too, so they are not retried on every open.
+		E = mapped_packs.insert(p_file->pack, _map_pack(p_file->pack));
+	}
+
+	MappedPack &mp = E->value;
+	if (mp.file.is_null() || p_file->offset + p_file->size > mp.length) {
+		return nullptr;
+	}
+	if (mp.file->get_length() < mp.length) {
+		// Touching pages past the end of a truncated file raises SIGBUS, stop using the mapping.
+		WARN_PRINT(vformat("PCK \"%s\" was truncated while memory-mapped, using regular reads.", p_file->pack));
+		mp = MappedPack();
+		return nullptr;
+	}
+
+	if (r_owner) {
+		*r_owner = mp.file;
+	}
+	return mp.data + p_file->offset;
+}
+
 Ref<FileAccess> PackedSourcePCK::get_file(const String &p_path, PackedData::PackedFile *p_file) {
-	return memnew(FileAccessPack(p_path, *p_file));
+	Ref<FileAccess> owner;
+	const uint8_t *mapped = _get_mapped_file(p_file, &owner);
+	return memnew(FileAccessPack(p_path, *p_file, mapped, owner));
+}
+
+void PackedSourcePCK::close_pack(const String &p_path) {
+	MutexLock lock(mapped_packs_mutex);
+	mapped_packs.erase(p_path);
+}
+
+uint64_t PackedSourcePCK::prefetch_file(const String &p_path, PackedData::PackedFile *p_file) {
+	Ref<FileAccess> owner;
+	const uint8_t *mapped = _get_mapped_file(p_file, &owner);
+	if (!mapped) {
+		return PackSource::prefetch_file(p_path, p_file);
+	}
+
+	// Touch every page of the file, so it is resident by the time it is read.
+	const volatile uint8_t *pages = mapped;
+	uint8_t sink = 0;
+	for (uint64_t i = 0; i < p_file->size; i += 4096) {
+		sink ^= pages[i];
+	}
+	if (p_file->size > 0) {
+		sink ^= pages[p_file->size - 1];
+	}
+	(void)sink;
+
+	return p_file->size;
 }
 
 //////////////////////////////////////////////////////////////////
@@ -371,7 +618,9 @@ Error FileAccessPack::open_internal(const String &p_path, int p_mode_flags) {
 }
 
 bool FileAccessPack::is_open() const {
-	if (f.is_valid()) {
+	if (mapped) {
+		return true;
+	} else if (f.is_valid()) {
 		return f->is_open();
 	} else {
 		return false;
@@ -379,7 +628,7 @@ bool FileAccessPack::is_open() const {
 }
 
 void FileAccessPack::seek(uint64_t p_position) {
-	ERR_FAIL_COND_MSG(f.is_null(), "File must be opened before use.");
+	ERR_FAIL_COND_MSG(!mapped && f.is_null(), "File must be opened before use.");
 
 	if (p_position > pf.size) {
 		eof = true;
@@ -387,7 +636,9 @@ void FileAccessPack::seek(uint64_t p_position) {
 		eof = false;
 	}
 
-	f->seek(off + p_position);
+	if (!mapped) {
+		f->seek(off + p_position);
+	}
 	pos = p_position;
 }
 
@@ -408,7 +659,7 @@ bool FileAccessPack::eof_reached() const {
 }
 
 uint64_t FileAccessPack::get_buffer(uint8_t *p_dst, uint64_t p_length) const {
-	ERR_FAIL_COND_V_MSG(f.is_null(), -1, "File must be opened before use.");
+	ERR_FAIL_COND_V_MSG(!mapped && f.is_null(), -1, "File must be opened before use.");
 	ERR_FAIL_COND_V(!p_dst && p_length > 0, -1);
 
 	if (eof) {
@@ -421,21 +672,38 @@ uint64_t FileAccessPack::get_buffer(uint8_t *p_dst, uint64_t p_length) const {
 		to_read = (int64_t)pf.size - (int64_t)pos;
 	}
 
-	pos += to_read;
-
 	if (to_read <= 0) {
 		return 0;
 	}
-	f->get_buffer(p_dst, to_read);
+
+	if (mapped) {
+		memcpy(p_dst, mapped + pos, to_read);
+	} else {
+		f->get_buffer(p_dst, to_read);
+	}
+	pos += to_read;
 
 	return to_read;
 }
 
+const uint8_t *FileAccessPack::get_buffer_view(uint64_t p_length) const {
+	if (!mapped || eof || p_length > pf.size - pos) {
+		return nullptr;
+	}
+
+	const uint8_t *view = mapped + pos;
+	pos += p_length;
+
+	return view;
+}
+
 void FileAccessPack::set_big_endian(bool p_big_endian) {
-	ERR_FAIL_COND_MSG(f.is_null(), "File must be opened before use.");
+	ERR_FAIL_COND_MSG(!mapped && f.is_null(), "File must be opened before use.");
 
 	FileAccess::set_big_endian(p_big_endian);
-	f->set_big_endian(p_big_endian);
+	if (f.is_valid()) {
+		f->set_big_endian(p_big_endian);
+	}
 }
 
 Error FileAccessPack::get_error() const {
@@ -459,15 +727,27 @@ bool FileAccessPack::file_exists(const String &p_name) {
 
 void FileAccessPack::close() {
 	f = Ref<FileAccess>();
+	mapped = nullptr;
+	mapped_file = Ref<FileAccess>();
 }
 
-FileAccessPack::FileAccessPack(const String &p_path, const PackedData::PackedFile &p_file) :
-		pf(p_file),
-		f(FileAccess::open(pf.pack, FileAccess::READ)) {
+FileAccessPack::FileAccessPack(const String &p_path, const PackedData::PackedFile &p_file, const uint8_t *p_mapped, const Ref<FileAccess> &p_mapped_file) :
+		pf(p_file) {
+	pos = 0;
+	eof = false;
+	off = pf.offset;
+
+	if (p_mapped && p_mapped_file.is_valid() && !pf.encrypted) {
+		// Reads are served from the mapped pack, no file handle is needed.
+		mapped = p_mapped;
+		mapped_file = p_mapped_file;
+		return;
+	}
+
+	f = FileAccess::open(pf.pack, FileAccess::READ);
 	ERR_FAIL_COND_MSG(f.is_null(), vformat("Can't open pack-referenced file '%s'.", String(pf.pack)));
 
 	f->seek(pf.offset);
-	off = pf.offset;
 
 	if (pf.encrypted) {
 		Ref<FileAccessEncrypted> fae;
@@ -485,8 +765,6 @@ FileAccessPack::FileAccessPack(const String &p_path, const PackedData::PackedFil
 		f = fae;
 		off = 0;
 	}
-	pos = 0;
-	eof = false;
 }
 
 //////////////////////////////////////////////////////////////////////////////////
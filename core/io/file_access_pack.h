@@ -32,9 +32,13 @@
 
 #include "core/io/dir_access.h"
 #include "core/io/file_access.h"
+#include "core/os/mutex.h"
+#include "core/os/semaphore.h"
+#include "core/os/thread.h"
 #include "core/string/print_string.h"
 #include "core/templates/hash_set.h"
 #include "core/templates/list.h"
+#include "core/templates/safe_refcount.h"
 
 // Godot's packed file magic header ("GDPC" in ASCII).
 #define PACK_HEADER_MAGIC 0x43504447
@@ -68,6 +72,14 @@ public:
 		bool encrypted;
 	};
 
+	struct PrefetchStatus {
+		uint64_t pending = 0; // Files queued but not read yet.
+		uint64_t completed = 0; // Files read ahead so far.
+		uint64_t bytes = 0; // Bytes read ahead so far.
+		uint64_t hits = 0; // Files opened after their prefetch completed.
+		uint64_t misses = 0; // Files opened while their prefetch was still pending.
+	};
+
 private:
 	struct PackedDir {
 		PackedDir *parent = nullptr;
@@ -98,12 +110,32 @@ private:
 
 	HashMap<PathMD5, PackedFile, PathMD5> files;
 
+	struct PrefetchRequest {
+		PathMD5 md5;
+		String path;
+		PackedFile file;
+	};
+
+	Thread prefetch_thread;
+	Semaphore prefetch_semaphore;
+	mutable Mutex prefetch_mutex;
+	SafeFlag prefetch_exit;
+	SafeFlag prefetch_used;
+	List<PrefetchRequest> prefetch_queue;
+	HashSet<PathMD5, PathMD5> prefetch_pending;
+	HashSet<PathMD5, PathMD5> prefetch_warm;
+	PrefetchStatus prefetch_status;
+
+	static void _prefetch_thread_func(void *p_userdata);
+	void _prefetch_record_open(const PathMD5 &p_md5);
+
 	Vector<PackSource *> sources;
 
 	PackedDir *root = nullptr;
 
 	static inline PackedData *singleton = nullptr;
 	bool disabled = false;
+	bool use_mmap = false;
 
 	void _free_packed_dirs(PackedDir *p_dir);
 	void _get_file_paths(PackedDir *p_dir, const String &p_parent_dir, HashSet<String> &r_paths) const;
@@ -118,11 +150,21 @@ public:
 	void set_disabled(bool p_disabled) { disabled = p_disabled; }
 	_FORCE_INLINE_ bool is_disabled() const { return disabled; }
 
+	// While enabled, packs are memory-mapped on first access when the platform supports it,
+	// unencrypted files are then read straight from the mapped pages.
+	void set_use_mmap(bool p_use_mmap) { use_mmap = p_use_mmap; }
+	_FORCE_INLINE_ bool is_using_mmap() const { return use_mmap; }
+
 	static PackedData *get_singleton() { return singleton; }
 	Error add_pack(const String &p_path, bool p_replace_files, uint64_t p_offset);
+	void remove_pack(const String &p_path); // Files replaced by the pack are not restored.
 
 	void clear();
 
+	// Reads the given files ahead on a background thread, so opening them later does not wait on storage.
+	void prefetch(const Vector<String> &p_paths);
+	PrefetchStatus get_prefetch_status() const;
+
 	_FORCE_INLINE_ Ref<FileAccess> try_open_path(const String &p_path);
 	_FORCE_INLINE_ bool has_path(const String &p_path);
 
@@ -139,13 +181,29 @@ class PackSource {
 public:
 	virtual bool try_open_pack(const String &p_path, bool p_replace_files, uint64_t p_offset) = 0;
 	virtual Ref<FileAccess> get_file(const String &p_path, PackedData::PackedFile *p_file) = 0;
+	virtual uint64_t prefetch_file(const String &p_path, PackedData::PackedFile *p_file); // Called from the prefetch thread, returns the amount of bytes read ahead.
+	virtual void close_pack(const String &p_path) {}
 	virtual ~PackSource() {}
 };
 
 class PackedSourcePCK : public PackSource {
+	struct MappedPack {
+		Ref<FileAccess> file; // Owns the mapping, null if the pack can't be mapped.
+		const uint8_t *data = nullptr;
+		uint64_t length = 0;
+	};
+
+	Mutex mapped_packs_mutex;
+	HashMap<String, MappedPack> mapped_packs;
+
+	MappedPack _map_pack(const String &p_path);
+	const uint8_t *_get_mapped_file(const PackedData::PackedFile *p_file, Ref<FileAccess> *r_owner = nullptr);
+
 public:
 	virtual bool try_open_pack(const String &p_path, bool p_replace_files, uint64_t p_offset) override;
 	virtual Ref<FileAccess> get_file(const String &p_path, PackedData::PackedFile *p_file) override;
+	virtual uint64_t prefetch_file(const String &p_path, PackedData::PackedFile *p_file) override;
+	virtual void close_pack(const String &p_path) override;
 };
 
 class PackedSourceDirectory : public PackSource {
@@ -163,6 +221,8 @@ class FileAccessPack : public FileAccess {
 	mutable uint64_t pos;
 	mutable bool eof;
 	uint64_t off;
+	const uint8_t *mapped = nullptr; // File data inside a memory-mapped pack, if any.
+	Ref<FileAccess> mapped_file; // Keeps the mapping alive while the file is open.
 
 	Ref<FileAccess> f;
 	virtual Error open_internal(const String &p_path, int p_mode_flags) override;
@@ -188,6 +248,7 @@ public:
 	virtual bool eof_reached() const override;
 
 	virtual uint64_t get_buffer(uint8_t *p_dst, uint64_t p_length) const override;
+	virtual const uint8_t *get_buffer_view(uint64_t p_length) const override;
 
 	virtual void set_big_endian(bool p_big_endian) override;
 
@@ -201,7 +262,7 @@ public:
 
 	virtual void close() override;
 
-	FileAccessPack(const String &p_path, const PackedData::PackedFile &p_file);
+	FileAccessPack(const String &p_path, const PackedData::PackedFile &p_file, const uint8_t *p_mapped = nullptr, const Ref<FileAccess> &p_mapped_file = Ref<FileAccess>());
 };
 
 int64_t PackedData::get_size(const String &p_path) {
@@ -225,6 +286,10 @@ Ref<FileAccess> PackedData::try_open_path(const String &p_path) {
 		return nullptr; // Not found.
 	}
 
+	if (prefetch_used.is_set()) {
+		_prefetch_record_open(pmd5);
+	}
+
 	return E->value.src->get_file(p_path, &E->value);
 }
 
@@ -618,7 +618,7 @@ HashMap<String, Resource *> ResourceCache::resources;
 HashMap<String, HashMap<String, String>> ResourceCache::resource_path_cache;
 #endif
 
-Mutex ResourceCache::lock;
+Mutex ResourceCache::lock("ResourceCache");
 #ifdef TOOLS_ENABLED
 RWLock ResourceCache::path_cache_lock;
 #endif
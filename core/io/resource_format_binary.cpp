@@ -968,7 +968,7 @@ void ResourceLoaderBinary::get_dependencies(Ref<FileAccess> p_f, List<String> *p
 			dep += "::" + external_resources[i].type;
 		}
 		if (!fallback_path.is_empty()) {
-			if (!p_add_types) {
+			if (!p_add_types || external_resources[i].type.is_empty()) {
 				dep += "::"; // Ensure that path comes third, even if there is no type.
 			}
 			dep += "::" + fallback_path;
@@ -1240,9 +1240,14 @@ Ref<Resource> ResourceFormatLoaderBinary::load(const String &p_path, const Strin
 	String path = !p_original_path.is_empty() ? p_original_path : p_path;
 	loader.local_path = ProjectSettings::get_singleton()->localize_path(path);
 	loader.res_path = loader.local_path;
-	loader.open(f);
-
-	err = loader.load();
+	{
+		ResourceLoader::LoadProfileScope profile_scope(loader.local_path, "read");
+		loader.open(f);
+	}
+	{
+		ResourceLoader::LoadProfileScope profile_scope(loader.local_path, "parse");
+		err = loader.load();
+	}
 
 	if (r_error) {
 		*r_error = err;
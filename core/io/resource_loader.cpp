@@ -34,6 +34,7 @@
 #include "core/core_bind.h"
 #include "core/io/dir_access.h"
 #include "core/io/file_access.h"
+#include "core/io/json.h"
 #include "core/io/resource_importer.h"
 #include "core/object/script_language.h"
 #include "core/os/condition_variable.h"
@@ -374,6 +375,9 @@ void ResourceLoader::_run_load_task(void *p_userdata) {
 	ThreadLoadTask *curr_load_task_backup = curr_load_task;
 	curr_load_task = &load_task;
 
+	const bool profiling = profiling_enabled.is_set();
+	const uint64_t load_begin_usec = profiling ? OS::get_singleton()->get_ticks_usec() : 0;
+
 	// Thread-safe either if it's the current thread or a brand new one.
 	CallQueue *own_mq_override = nullptr;
 	if (load_nesting == 0) {
@@ -389,14 +393,25 @@ void ResourceLoader::_run_load_task(void *p_userdata) {
 	}
 	// --
 
+	// Dependencies found while scanning are loaded by their own tasks; hold them until the
+	// loader below claims them, so they are not released in between.
+	Vector<Ref<LoadToken>> dependency_tokens;
+	if (load_task.schedule_dependencies) {
+		HashSet<String> visited;
+		visited.insert(load_task.local_path);
+		_schedule_dependencies(load_task.local_path, visited, dependency_tokens);
+	}
+
 	bool xl_remapped = false;
 	const String &remapped_path = _path_remap(load_task.local_path, &xl_remapped);
 
 	Error load_err = OK;
 	Ref<Resource> res = _load(remapped_path, remapped_path != load_task.local_path ? load_task.local_path : String(), load_task.type_hint, load_task.cache_mode, &load_err, load_task.use_sub_threads, &load_task.progress);
+	dependency_tokens.clear();
 	if (MessageQueue::get_singleton() != MessageQueue::get_main_singleton()) {
 		MessageQueue::get_singleton()->flush();
 	}
+	const uint64_t load_end_usec = profiling ? OS::get_singleton()->get_ticks_usec() : 0;
 
 	thread_load_mutex.lock();
 
@@ -484,6 +499,14 @@ void ResourceLoader::_run_load_task(void *p_userdata) {
 		}
 	}
 
+	if (profiling) {
+		if (load_task.queued_usec && load_task.queued_usec < load_begin_usec) {
+			_profile_record(load_task.local_path, load_task.requester, "wait", load_task.queued_usec, load_begin_usec);
+		}
+		_profile_record(load_task.local_path, load_task.requester, "load", load_begin_usec, load_end_usec);
+		_profile_record(load_task.local_path, load_task.requester, "finalize", load_end_usec, OS::get_singleton()->get_ticks_usec());
+	}
+
 	// It's safe now to let the task go in case no one else was grabbing the token.
 	load_task.load_token->unreference();
 
@@ -502,6 +525,52 @@ void ResourceLoader::_run_load_task(void *p_userdata) {
 	curr_load_task = curr_load_task_backup;
 }
 
+// Starts a threaded load for every resource that the given one depends on, transitively.
+// Dependencies are read from file headers only, and requested deepest first, so that leaves
+// are already loading (or loaded) by the time the resources depending on them are parsed.
+// Loads later requested by the format loaders attach to these tasks instead of starting new ones.
+void ResourceLoader::_schedule_dependencies(const String &p_local_path, HashSet<String> &r_visited, Vector<Ref<LoadToken>> &r_tokens) {
+	List<String> dependencies;
+	get_dependencies(p_local_path, &dependencies, true);
+
+	for (const String &dependency : dependencies) {
+		// Dependencies are listed as "path::type", or "uid::type::fallback_path", where the type may be empty.
+		Vector<String> slices = dependency.split("::");
+		String path = slices[0];
+		String type = slices.size() > 1 ? slices[1] : String();
+		String fallback_path = slices.size() > 2 ? slices[2] : String();
+
+		if (path.begins_with("uid://")) {
+			ResourceUID::ID uid = ResourceUID::get_singleton()->text_to_id(path);
+			if (uid != ResourceUID::INVALID_ID && ResourceUID::get_singleton()->has_id(uid)) {
+				path = ResourceUID::get_singleton()->get_id_path(uid);
+			} else if (!fallback_path.is_empty()) {
+				path = fallback_path;
+			} else {
+				continue;
+			}
+		} else if (!path.contains("://") && path.is_relative_path()) {
+			path = ProjectSettings::get_singleton()->localize_path(p_local_path.get_base_dir().path_join(path));
+		}
+
+		if (r_visited.has(path)) {
+			continue;
+		}
+		r_visited.insert(path);
+
+		if (ResourceCache::has(path)) {
+			continue; // Already loaded, and so are its dependencies.
+		}
+
+		_schedule_dependencies(path, r_visited, r_tokens);
+
+		Ref<LoadToken> token = _load_start(path, type, LOAD_THREAD_DISTRIBUTE, ResourceFormatLoader::CACHE_MODE_REUSE);
+		if (token.is_valid()) {
+			r_tokens.push_back(token);
+		}
+	}
+}
+
 String ResourceLoader::_validate_local_path(const String &p_path) {
 	ResourceUID::ID uid = ResourceUID::get_singleton()->text_to_id(p_path);
 	if (uid != ResourceUID::INVALID_ID) {
@@ -612,6 +681,13 @@ Ref<ResourceLoader::LoadToken> ResourceLoader::_load_start(const String &p_path,
 			load_task.type_hint = p_type_hint;
 			load_task.cache_mode = p_cache_mode;
 			load_task.use_sub_threads = p_thread_mode == LOAD_THREAD_DISTRIBUTE;
+			if (profiling_enabled.is_set()) {
+				load_task.queued_usec = OS::get_singleton()->get_ticks_usec();
+				load_task.requester = curr_load_task ? curr_load_task->local_path : String();
+			}
+			// Only user requests plan ahead, the tasks they start are already part of the plan.
+			// Deep cache modes must not share dependencies with other loads.
+			load_task.schedule_dependencies = p_for_user && load_task.use_sub_threads && p_cache_mode != ResourceFormatLoader::CACHE_MODE_IGNORE_DEEP && p_cache_mode != ResourceFormatLoader::CACHE_MODE_REPLACE_DEEP;
 			if (p_cache_mode == ResourceFormatLoader::CACHE_MODE_REUSE) {
 				Ref<Resource> existing = ResourceCache::get_ref(local_path);
 				if (existing.is_valid()) {
@@ -1547,6 +1623,91 @@ Vector<String> ResourceLoader::list_directory(const String &p_directory) {
 	return ret;
 }
 
+ResourceLoader::LoadProfileScope::LoadProfileScope(const String &p_path, const char *p_phase) {
+	if (profiling_enabled.is_set()) {
+		path = p_path;
+		phase = p_phase;
+		begin_usec = OS::get_singleton()->get_ticks_usec();
+	}
+}
+
+ResourceLoader::LoadProfileScope::~LoadProfileScope() {
+	if (phase) {
+		_profile_record(path, curr_load_task ? curr_load_task->requester : String(), phase, begin_usec, OS::get_singleton()->get_ticks_usec());
+	}
+}
+
+void ResourceLoader::_profile_record(const String &p_path, const String &p_parent, const String &p_phase, uint64_t p_begin_usec, uint64_t p_end_usec) {
+	LoadProfileEvent event;
+	event.path = p_path;
+	event.parent = p_parent;
+	event.phase = p_phase;
+	event.thread_id = Thread::get_caller_id();
+	event.begin_usec = p_begin_usec;
+	event.end_usec = p_end_usec;
+
+	MutexLock lock(profile_mutex);
+	if (profile_events.size() < PROFILE_MAX_EVENTS) {
+		profile_events.push_back(event);
+	} else {
+		profile_events[profile_events_first] = event;
+		profile_events_first = (profile_events_first + 1) % PROFILE_MAX_EVENTS;
+	}
+}
+
+void ResourceLoader::set_profiling_enabled(bool p_enabled) {
+	profiling_enabled.set_to(p_enabled);
+}
+
+Vector<ResourceLoader::LoadProfileEvent> ResourceLoader::get_profile_events(bool p_clear) {
+	MutexLock lock(profile_mutex);
+	Vector<LoadProfileEvent> ret;
+	ret.resize(profile_events.size());
+	LoadProfileEvent *w = ret.ptrw();
+	for (uint32_t i = 0; i < profile_events.size(); i++) {
+		w[i] = profile_events[(profile_events_first + i) % profile_events.size()];
+	}
+	if (p_clear) {
+		profile_events.clear();
+		profile_events_first = 0;
+	}
+	return ret;
+}
+
+void ResourceLoader::clear_profile() {
+	MutexLock lock(profile_mutex);
+	profile_events.clear();
+	profile_events_first = 0;
+}
+
+// Produces the Trace Event Format used by chrome://tracing and Perfetto.
+String ResourceLoader::get_profile_as_chrome_trace() {
+	Array trace_events;
+	for (const LoadProfileEvent &event : get_profile_events()) {
+		Dictionary args;
+		args["path"] = event.path;
+		if (!event.parent.is_empty()) {
+			args["parent"] = event.parent;
+		}
+
+		Dictionary trace_event;
+		trace_event["name"] = event.phase + " " + event.path.get_file();
+		trace_event["cat"] = event.phase;
+		trace_event["ph"] = "X";
+		trace_event["ts"] = event.begin_usec;
+		trace_event["dur"] = event.end_usec - event.begin_usec;
+		trace_event["pid"] = OS::get_singleton()->get_process_id();
+		trace_event["tid"] = event.thread_id;
+		trace_event["args"] = args;
+		trace_events.push_back(trace_event);
+	}
+
+	Dictionary trace;
+	trace["traceEvents"] = trace_events;
+	trace["displayTimeUnit"] = "ms";
+	return JSON::stringify(trace, "", false, true);
+}
+
 void ResourceLoader::initialize() {}
 
 void ResourceLoader::finalize() {}
@@ -1564,13 +1725,18 @@ thread_local Vector<String> ResourceLoader::load_paths_stack;
 thread_local HashMap<int, HashMap<String, Ref<Resource>>> ResourceLoader::res_ref_overrides;
 thread_local ResourceLoader::ThreadLoadTask *ResourceLoader::curr_load_task = nullptr;
 
+SafeFlag ResourceLoader::profiling_enabled;
+Mutex ResourceLoader::profile_mutex;
+LocalVector<ResourceLoader::LoadProfileEvent> ResourceLoader::profile_events;
+uint32_t ResourceLoader::profile_events_first = 0;
+
 SafeBinaryMutex<ResourceLoader::BINARY_MUTEX_TAG> &_get_res_loader_mutex() {
 	return ResourceLoader::thread_load_mutex;
 }
 
 template <>
 thread_local SafeBinaryMutex<ResourceLoader::BINARY_MUTEX_TAG>::TLSData SafeBinaryMutex<ResourceLoader::BINARY_MUTEX_TAG>::tls_data(_get_res_loader_mutex());
-SafeBinaryMutex<ResourceLoader::BINARY_MUTEX_TAG> ResourceLoader::thread_load_mutex;
+SafeBinaryMutex<ResourceLoader::BINARY_MUTEX_TAG> ResourceLoader::thread_load_mutex("ResourceLoader");
 HashMap<String, ResourceLoader::ThreadLoadTask> ResourceLoader::thread_load_tasks;
 bool ResourceLoader::cleaning_tasks = false;
 
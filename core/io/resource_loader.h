@@ -191,6 +191,9 @@ private:
 		Error error = OK;
 		Ref<Resource> resource;
 		bool use_sub_threads = false;
+		bool schedule_dependencies = false; // Start loading the whole dependency tree before parsing.
+		uint64_t queued_usec = 0; // Only set while profiling.
+		String requester; // Only set while profiling.
 		HashSet<String> sub_tasks;
 
 		struct ResourceChangedConnection {
@@ -202,6 +205,7 @@ private:
 	};
 
 	static void _run_load_task(void *p_userdata);
+	static void _schedule_dependencies(const String &p_local_path, HashSet<String> &r_visited, Vector<Ref<LoadToken>> &r_tokens);
 
 	static thread_local bool import_thread;
 	static thread_local int load_nesting;
@@ -223,6 +227,37 @@ private:
 
 	static String _validate_local_path(const String &p_path);
 
+public:
+	struct LoadProfileEvent {
+		String path;
+		String parent; // Resource whose load requested this one, if any.
+		String phase;
+		Thread::ID thread_id = 0;
+		uint64_t begin_usec = 0;
+		uint64_t end_usec = 0;
+	};
+
+	// Records a loader-specific phase, such as reading or parsing, while profiling is enabled.
+	class LoadProfileScope {
+		String path;
+		const char *phase = nullptr;
+		uint64_t begin_usec = 0;
+
+	public:
+		LoadProfileScope(const String &p_path, const char *p_phase);
+		~LoadProfileScope();
+	};
+
+	static constexpr uint32_t PROFILE_MAX_EVENTS = 16384;
+
+private:
+	static SafeFlag profiling_enabled;
+	static Mutex profile_mutex;
+	static LocalVector<LoadProfileEvent> profile_events; // Ring buffer, the oldest events are overwritten once full.
+	static uint32_t profile_events_first;
+
+	static void _profile_record(const String &p_path, const String &p_parent, const String &p_phase, uint64_t p_begin_usec, uint64_t p_end_usec);
+
 public:
 	static Error load_threaded_request(const String &p_path, const String &p_type_hint = "", bool p_use_sub_threads = false, ResourceFormatLoader::CacheMode p_cache_mode = ResourceFormatLoader::CACHE_MODE_REUSE);
 	static ThreadLoadStatus load_threaded_get_status(const String &p_path, float *r_progress = nullptr);
@@ -311,6 +346,12 @@ public:
 
 	static Vector<String> list_directory(const String &p_directory);
 
+	static void set_profiling_enabled(bool p_enabled);
+	static bool is_profiling_enabled() { return profiling_enabled.is_set(); }
+	static Vector<LoadProfileEvent> get_profile_events(bool p_clear = false);
+	static void clear_profile();
+	static String get_profile_as_chrome_trace();
+
 	static void initialize();
 	static void finalize();
 };
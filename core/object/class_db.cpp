@@ -1361,6 +1361,35 @@ void ClassDB::add_signal(const StringName &p_class, const MethodInfo &p_signal)
 	type->signal_map[sname] = p_signal;
 }
 
+void ClassDB::_build_signal_indices(ClassInfo *p_class) {
+	if (p_class->signal_indices_built) {
+		return;
+	}
+
+	if (p_class->inherits_ptr) {
+		_build_signal_indices(p_class->inherits_ptr);
+		p_class->signal_indices = p_class->inherits_ptr->signal_indices;
+	}
+	for (const KeyValue<StringName, MethodInfo> &E : p_class->signal_map) {
+		if (!p_class->signal_indices.has(E.key)) {
+			p_class->signal_indices.insert(E.key, p_class->signal_indices.size());
+		}
+	}
+	p_class->signal_indices_built = true;
+}
+
+int ClassDB::get_signal_index(const StringName &p_class, const StringName &p_signal) {
+	Locker::Lock lock(Locker::STATE_READ);
+
+	ClassInfo *type = classes.getptr(p_class);
+	ERR_FAIL_NULL_V(type, -1);
+
+	MutexLock signal_indices_lock(signal_indices_mutex);
+	_build_signal_indices(type);
+	const int *index = type->signal_indices.getptr(p_signal);
+	return index ? *index : -1;
+}
+
 void ClassDB::get_signal_list(const StringName &p_class, List<MethodInfo> *p_signals, bool p_no_inheritance) {
 	Locker::Lock lock(Locker::STATE_READ);
 
@@ -2383,7 +2412,11 @@ bool ClassDB::is_default_array_arg(const Array &p_array) {
 
 //
 
+#ifdef LOCK_PROFILING_ENABLED
+ClassDB::Locker::Lock::Lock(Locker::State p_state, const char *p_file, int p_line) {
+#else
 ClassDB::Locker::Lock::Lock(Locker::State p_state) {
+#endif // LOCK_PROFILING_ENABLED
 	DEV_ASSERT(p_state != STATE_UNLOCKED);
 	if (p_state == STATE_READ) {
 		if (Locker::thread_state == STATE_UNLOCKED) {
@@ -2395,7 +2428,11 @@ ClassDB::Locker::Lock::Lock(Locker::State p_state) {
 		if (Locker::thread_state == STATE_UNLOCKED) {
 			state = STATE_WRITE;
 			Locker::thread_state = STATE_WRITE;
+#ifdef LOCK_PROFILING_ENABLED
+			Locker::lock.write_lock(p_file, p_line);
+#else
 			Locker::lock.write_lock();
+#endif // LOCK_PROFILING_ENABLED
 		} else if (Locker::thread_state == STATE_READ) {
 			CRASH_NOW_MSG("Lock can't be upgraded from read to write.");
 		}
@@ -116,6 +116,10 @@ public:
 
 		HashMap<StringName, EnumInfo> enum_map;
 		HashMap<StringName, MethodInfo> signal_map;
+		// Signals of this class and its bases, numbered base first so indices are shared with derived classes.
+		// Built on first use, signals added afterwards aren't numbered.
+		HashMap<StringName, int> signal_indices;
+		bool signal_indices_built = false;
 		List<PropertyInfo> property_list;
 		HashMap<StringName, PropertyInfo> property_map;
 #ifdef DEBUG_METHODS_ENABLED
@@ -165,7 +169,7 @@ public:
 		};
 
 	private:
-		inline static RWLock lock;
+		inline static RWLock lock{ "ClassDB" };
 		inline thread_local static State thread_state = STATE_UNLOCKED;
 
 	public:
@@ -173,7 +177,11 @@ public:
 			State state = STATE_UNLOCKED;
 
 		public:
+#ifdef LOCK_PROFILING_ENABLED
+			explicit Lock(State p_state, const char *p_file = __builtin_FILE(), int p_line = __builtin_LINE());
+#else
 			explicit Lock(State p_state);
+#endif // LOCK_PROFILING_ENABLED
 			~Lock();
 		};
 	};
@@ -196,6 +204,8 @@ public:
 	static HashMap<APIType, uint32_t> api_hashes_cache;
 
 	static void _add_class(const StringName &p_class, const StringName &p_inherits);
+	static void _build_signal_indices(ClassInfo *p_class);
+	static inline Mutex signal_indices_mutex;
 
 	static HashMap<StringName, HashMap<StringName, Variant>> default_values;
 	static HashSet<StringName> default_values_cached;
@@ -438,6 +448,7 @@ public:
 
 	static void add_signal(const StringName &p_class, const MethodInfo &p_signal);
 	static bool has_signal(const StringName &p_class, const StringName &p_signal, bool p_no_inheritance = false);
+	static int get_signal_index(const StringName &p_class, const StringName &p_signal);
 	static bool get_signal(const StringName &p_class, const StringName &p_signal, MethodInfo *r_signal);
 	static void get_signal_list(const StringName &p_class, List<MethodInfo> *p_signals, bool p_no_inheritance = false);
 
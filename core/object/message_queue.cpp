@@ -33,6 +33,7 @@
 #include "core/config/project_settings.h"
 #include "core/object/class_db.h"
 #include "core/object/script_language.h"
+#include "core/os/thread.h"
 
 #include <stdio.h>
 
@@ -58,6 +59,145 @@
 		mutex.unlock();                           \
 	}
 
+thread_local CallQueue::RemotePageHolder CallQueue::remote_page;
+
+CallQueue::RemotePageHolder::~RemotePageHolder() {
+	if (page) {
+		_unref_remote_page(page);
+	}
+}
+
+void CallQueue::_unref_remote_page(RemotePage *p_page) {
+	if (p_page->refcount.decrement() == 0) {
+		p_page->~RemotePage();
+		memfree(p_page);
+	}
+}
+
+CallQueue::RemoteMessage *CallQueue::_alloc_remote_message(uint32_t p_room) {
+	// The room of a message includes `Message`, which is the last member of `RemoteMessage`.
+	const uint32_t size = sizeof(RemoteMessage) - sizeof(Message) + p_room;
+
+	RemotePage *page = remote_page.page;
+	if (!page || page->used + size > uint32_t(PAGE_SIZE_BYTES)) {
+		if (page) {
+			_unref_remote_page(page);
+		}
+		page = memnew_placement(memalloc(sizeof(RemotePage)), RemotePage);
+		page->refcount.set(1); // Held by this thread until the page is full.
+		remote_page.page = page;
+	}
+
+	RemoteMessage *remote = memnew_placement(&page->data[page->used], RemoteMessage);
+	remote->page = page;
+	remote->size = size;
+	page->used += size;
+	page->refcount.increment();
+	remote_bytes_max.exchange_if_greater(remote_bytes.add(size));
+	return remote;
+}
+
+void CallQueue::_push_remote_message(RemoteMessage *p_remote) {
+	RemoteMessage *head = remote_head.load(std::memory_order_relaxed);
+	do {
+		p_remote->next = head;
+	} while (!remote_head.compare_exchange_weak(head, p_remote, std::memory_order_release, std::memory_order_relaxed));
+}
+
+void CallQueue::_free_remote_message(RemoteMessage *p_remote) {
+	remote_bytes.sub(p_remote->size);
+	RemotePage *page = p_remote->page;
+	p_remote->~RemoteMessage();
+	_unref_remote_page(page);
+}
+
+CallQueue::RemoteMessage *CallQueue::_take_remote_messages() {
+	RemoteMessage *remote = remote_head.exchange(nullptr, std::memory_order_acquire);
+
+	// The list is built newest first, reverse it so messages are flushed in the order they were pushed.
+	RemoteMessage *ordered = nullptr;
+	while (remote) {
+		RemoteMessage *next = remote->next;
+		remote->next = ordered;
+		ordered = remote;
+		remote = next;
+	}
+	return ordered;
+}
+
+bool CallQueue::_is_owner_thread() const {
+	// A thread singleton override is owned by the thread that set it, the main queue by the main thread.
+	return this == MessageQueue::get_singleton() && (MessageQueue::thread_singleton || Thread::is_main_thread());
+}
+
+uint8_t *CallQueue::_reserve_message(uint32_t p_room, RemoteMessage *&r_remote) {
+	if (!_is_owner_thread()) {
+		if (remote_bytes.get() + p_room > uint64_t(max_pages) * PAGE_SIZE_BYTES) {
+			return nullptr;
+		}
+		r_remote = _alloc_remote_message(p_room);
+		return (uint8_t *)&r_remote->message;
+	}
+
+	// Only the thread that owns the queue writes to its pages.
+	DEV_ASSERT(is_current_thread_override || this == MessageQueue::main_singleton);
+	r_remote = nullptr;
+
+	_ensure_first_page();
+
+	if ((page_bytes[pages_used - 1] + p_room) > uint32_t(PAGE_SIZE_BYTES)) {
+		if (pages_used == max_pages) {
+			return nullptr;
+		}
+		_add_page();
+	}
+
+	return &pages[pages_used - 1]->data[page_bytes[pages_used - 1]];
+}
+
+void CallQueue::_commit_message(uint32_t p_room, RemoteMessage *p_remote) {
+	if (p_remote) {
+		_push_remote_message(p_remote);
+	} else {
+		page_bytes[pages_used - 1] += p_room;
+	}
+}
+
+void CallQueue::_call_message(Message *p_message) {
+	Object *target = p_message->callable.get_object();
+
+	switch (p_message->type & FLAG_MASK) {
+		case TYPE_CALL: {
+			if (target || (p_message->type & FLAG_NULL_IS_OK)) {
+				Variant *args = (Variant *)(p_message + 1);
+				_call_function(p_message->callable, args, p_message->args, p_message->type & FLAG_SHOW_ERROR);
+			}
+		} break;
+		case TYPE_NOTIFICATION: {
+			if (target) {
+				target->notification(p_message->notification);
+			}
+		} break;
+		case TYPE_SET: {
+			if (target) {
+				Variant *arg = (Variant *)(p_message + 1);
+				target->set(p_message->callable.get_method(), *arg);
+			}
+		} break;
+	}
+}
+
+void CallQueue::_destroy_message(Message *p_message) {
+	if ((p_message->type & FLAG_MASK) != TYPE_NOTIFICATION) {
+		Variant *args = (Variant *)(p_message + 1);
+		for (int k = 0; k < p_message->args; k++) {
+			args[k].~Variant();
+		}
+	}
+
+	p_message->~Message();
+}
+
 void CallQueue::_add_page() {
 	if (pages_used == page_bytes.size()) {
 		pages.push_back(allocator->alloc());
@@ -86,26 +226,16 @@ Error CallQueue::push_set(Object *p_object, const StringName &p_prop, const Vari
 Error CallQueue::push_callablep(const Callable &p_callable, const Variant **p_args, int p_argcount, bool p_show_error) {
 	uint32_t room_needed = sizeof(Message) + sizeof(Variant) * p_argcount;
 
-	ERR_FAIL_COND_V_MSG(room_needed > uint32_t(PAGE_SIZE_BYTES), ERR_INVALID_PARAMETER, "Message is too large to fit on a page (" + itos(PAGE_SIZE_BYTES) + " bytes), consider passing less arguments.");
+	ERR_FAIL_COND_V_MSG(sizeof(RemoteMessage) - sizeof(Message) + room_needed > uint32_t(PAGE_SIZE_BYTES), ERR_INVALID_PARAMETER, "Message is too large to fit on a page (" + itos(PAGE_SIZE_BYTES) + " bytes), consider passing less arguments.");
 
-	LOCK_MUTEX;
-
-	_ensure_first_page();
-
-	if ((page_bytes[pages_used - 1] + room_needed) > uint32_t(PAGE_SIZE_BYTES)) {
-		if (pages_used == max_pages) {
-			fprintf(stderr, "Failed method: %s. Message queue out of memory. %s\n", String(p_callable).utf8().get_data(), error_text.utf8().get_data());
-			statistics();
-			UNLOCK_MUTEX;
-			return ERR_OUT_OF_MEMORY;
-		}
-		_add_page();
+	RemoteMessage *remote = nullptr;
+	uint8_t *buffer_end = _reserve_message(room_needed, remote);
+	if (!buffer_end) {
+		fprintf(stderr, "Failed method: %s. Message queue out of memory. %s\n", String(p_callable).utf8().get_data(), error_text.utf8().get_data());
+		statistics();
+		return ERR_OUT_OF_MEMORY;
 	}
 
-	Page *page = pages[pages_used - 1];
-
-	uint8_t *buffer_end = &page->data[page_bytes[pages_used - 1]];
-
 	Message *msg = memnew_placement(buffer_end, Message);
 	msg->args = p_argcount;
 	msg->callable = p_callable;
@@ -126,37 +256,26 @@ Error CallQueue::push_callablep(const Callable &p_callable, const Variant **p_ar
 		*v = *p_args[i];
 	}
 
-	page_bytes[pages_used - 1] += room_needed;
-
-	UNLOCK_MUTEX;
+	_commit_message(room_needed, remote);
 
 	return OK;
 }
 
 Error CallQueue::push_set(ObjectID p_id, const StringName &p_prop, const Variant &p_value) {
-	LOCK_MUTEX;
 	uint32_t room_needed = sizeof(Message) + sizeof(Variant);
 
-	_ensure_first_page();
-
-	if ((page_bytes[pages_used - 1] + room_needed) > uint32_t(PAGE_SIZE_BYTES)) {
-		if (pages_used == max_pages) {
-			String type;
-			if (ObjectDB::get_instance(p_id)) {
-				type = ObjectDB::get_instance(p_id)->get_class();
-			}
-			fprintf(stderr, "Failed set: %s: %s target ID: %s. Message queue out of memory. %s\n", type.utf8().get_data(), String(p_prop).utf8().get_data(), itos(p_id).utf8().get_data(), error_text.utf8().get_data());
-			statistics();
-
-			UNLOCK_MUTEX;
-			return ERR_OUT_OF_MEMORY;
+	RemoteMessage *remote = nullptr;
+	uint8_t *buffer_end = _reserve_message(room_needed, remote);
+	if (!buffer_end) {
+		String type;
+		if (ObjectDB::get_instance(p_id)) {
+			type = ObjectDB::get_instance(p_id)->get_class();
 		}
-		_add_page();
+		fprintf(stderr, "Failed set: %s: %s target ID: %s. Message queue out of memory. %s\n", type.utf8().get_data(), String(p_prop).utf8().get_data(), itos(p_id).utf8().get_data(), error_text.utf8().get_data());
+		statistics();
+		return ERR_OUT_OF_MEMORY;
 	}
 
-	Page *page = pages[pages_used - 1];
-	uint8_t *buffer_end = &page->data[page_bytes[pages_used - 1]];
-
 	Message *msg = memnew_placement(buffer_end, Message);
 	msg->args = 1;
 	msg->callable = Callable(p_id, p_prop);
@@ -167,32 +286,23 @@ Error CallQueue::push_set(ObjectID p_id, const StringName &p_prop, const Variant
 	Variant *v = memnew_placement(buffer_end, Variant);
 	*v = p_value;
 
-	page_bytes[pages_used - 1] += room_needed;
-	UNLOCK_MUTEX;
+	_commit_message(room_needed, remote);
 
 	return OK;
 }
 
 Error CallQueue::push_notification(ObjectID p_id, int p_notification) {
 	ERR_FAIL_COND_V(p_notification < 0, ERR_INVALID_PARAMETER);
-	LOCK_MUTEX;
 	uint32_t room_needed = sizeof(Message);
 
-	_ensure_first_page();
-
-	if ((page_bytes[pages_used - 1] + room_needed) > uint32_t(PAGE_SIZE_BYTES)) {
-		if (pages_used == max_pages) {
-			fprintf(stderr, "Failed notification: %d target ID: %s. Message queue out of memory. %s\n", p_notification, itos(p_id).utf8().get_data(), error_text.utf8().get_data());
-			statistics();
-			UNLOCK_MUTEX;
-			return ERR_OUT_OF_MEMORY;
-		}
-		_add_page();
+	RemoteMessage *remote = nullptr;
+	uint8_t *buffer_end = _reserve_message(room_needed, remote);
+	if (!buffer_end) {
+		fprintf(stderr, "Failed notification: %d target ID: %s. Message queue out of memory. %s\n", p_notification, itos(p_id).utf8().get_data(), error_text.utf8().get_data());
+		statistics();
+		return ERR_OUT_OF_MEMORY;
 	}
 
-	Page *page = pages[pages_used - 1];
-	uint8_t *buffer_end = &page->data[page_bytes[pages_used - 1]];
-
 	Message *msg = memnew_placement(buffer_end, Message);
 
 	msg->type = TYPE_NOTIFICATION;
@@ -200,8 +310,7 @@ Error CallQueue::push_notification(ObjectID p_id, int p_notification) {
 	//msg->target;
 	msg->notification = p_notification;
 
-	page_bytes[pages_used - 1] += room_needed;
-	UNLOCK_MUTEX;
+	_commit_message(room_needed, remote);
 
 	return OK;
 }
@@ -226,7 +335,7 @@ void CallQueue::_call_function(const Callable &p_callable, const Variant *p_args
 Error CallQueue::flush() {
 	LOCK_MUTEX;
 
-	if (pages.is_empty()) {
+	if (pages.is_empty() && remote_head.load(std::memory_order_relaxed) == nullptr) {
 		// Never allocated
 		UNLOCK_MUTEX;
 		return OK; // Do nothing.
@@ -239,66 +348,58 @@ Error CallQueue::flush() {
 
 	flushing = true;
 
-	uint32_t i = 0;
-	uint32_t offset = 0;
+	bool pending = true;
+	while (pending) {
+		uint32_t i = 0;
+		uint32_t offset = 0;
 
-	while (i < pages_used && offset < page_bytes[i]) {
-		Page *page = pages[i];
+		while (i < pages_used && offset < page_bytes[i]) {
+			Page *page = pages[i];
 
-		//lock on each iteration, so a call can re-add itself to the message queue
+			//lock on each iteration, so a call can re-add itself to the message queue
 
-		Message *message = (Message *)&page->data[offset];
+			Message *message = (Message *)&page->data[offset];
 
-		uint32_t advance = sizeof(Message);
-		if ((message->type & FLAG_MASK) != TYPE_NOTIFICATION) {
-			advance += sizeof(Variant) * message->args;
-		}
+			uint32_t advance = sizeof(Message);
+			if ((message->type & FLAG_MASK) != TYPE_NOTIFICATION) {
+				advance += sizeof(Variant) * message->args;
+			}
 
-		//pre-advance so this function is reentrant
-		offset += advance;
+			//pre-advance so this function is reentrant
+			offset += advance;
 
-		Object *target = message->callable.get_object();
+			UNLOCK_MUTEX;
 
-		UNLOCK_MUTEX;
+			_call_message(message);
+			_destroy_message(message);
 
-		switch (message->type & FLAG_MASK) {
-			case TYPE_CALL: {
-				if (target || (message->type & FLAG_NULL_IS_OK)) {
-					Variant *args = (Variant *)(message + 1);
-					_call_function(message->callable, args, message->args, message->type & FLAG_SHOW_ERROR);
-				}
-			} break;
-			case TYPE_NOTIFICATION: {
-				if (target) {
-					target->notification(message->notification);
-				}
-			} break;
-			case TYPE_SET: {
-				if (target) {
-					Variant *arg = (Variant *)(message + 1);
-					target->set(message->callable.get_method(), *arg);
-				}
-			} break;
+			LOCK_MUTEX;
+			if (offset == page_bytes[i]) {
+				i++;
+				offset = 0;
+			}
 		}
 
-		if ((message->type & FLAG_MASK) != TYPE_NOTIFICATION) {
-			Variant *args = (Variant *)(message + 1);
-			for (int k = 0; k < message->args; k++) {
-				args[k].~Variant();
-			}
+		if (!pages.is_empty()) {
+			page_bytes[0] = 0;
+			pages_used = 1;
 		}
 
-		message->~Message();
+		UNLOCK_MUTEX;
 
-		LOCK_MUTEX;
-		if (offset == page_bytes[i]) {
-			i++;
-			offset = 0;
+		// Messages pushed by other threads, including those pushed while flushing.
+		RemoteMessage *remote = _take_remote_messages();
+		while (remote) {
+			RemoteMessage *next = remote->next;
+			_call_message(&remote->message);
+			_destroy_message(&remote->message);
+			_free_remote_message(remote);
+			remote = next;
 		}
-	}
 
-	page_bytes[0] = 0;
-	pages_used = 1;
+		LOCK_MUTEX;
+		pending = remote_head.load(std::memory_order_acquire) != nullptr || (!pages.is_empty() && page_bytes[0] > 0);
+	}
 
 	flushing = false;
 	UNLOCK_MUTEX;
@@ -308,6 +409,14 @@ Error CallQueue::flush() {
 void CallQueue::clear() {
 	LOCK_MUTEX;
 
+	RemoteMessage *remote = _take_remote_messages();
+	while (remote) {
+		RemoteMessage *next = remote->next;
+		_destroy_message(&remote->message);
+		_free_remote_message(remote);
+		remote = next;
+	}
+
 	if (pages.is_empty()) {
 		UNLOCK_MUTEX;
 		return; // Nothing to clear.
@@ -329,14 +438,7 @@ void CallQueue::clear() {
 
 			offset += advance;
 
-			if ((message->type & FLAG_MASK) != TYPE_NOTIFICATION) {
-				Variant *args = (Variant *)(message + 1);
-				for (int k = 0; k < message->args; k++) {
-					args[k].~Variant();
-				}
-			}
-
-			message->~Message();
+			_destroy_message(message);
 		}
 	}
 
@@ -425,6 +527,7 @@ void CallQueue::statistics() {
 
 	fprintf(stdout, "TOTAL PAGES: %d (%d bytes).\n", pages_used, pages_used * PAGE_SIZE_BYTES);
 	fprintf(stdout, "NULL count: %d.\n", null_count);
+	fprintf(stdout, "Pushed from other threads: %s bytes.\n", itos(remote_bytes.get()).utf8().get_data());
 
 	for (const KeyValue<StringName, int> &E : set_count) {
 		fprintf(stdout, "SET %s: %d.\n", String(E.key).utf8().get_data(), E.value);
@@ -446,6 +549,9 @@ bool CallQueue::is_flushing() const {
 }
 
 bool CallQueue::has_messages() const {
+	if (remote_head.load(std::memory_order_relaxed) != nullptr) {
+		return true;
+	}
 	if (pages_used == 0) {
 		return false;
 	}
@@ -457,7 +563,7 @@ bool CallQueue::has_messages() const {
 }
 
 int CallQueue::get_max_buffer_usage() const {
-	return pages.size() * PAGE_SIZE_BYTES;
+	return pages.size() * PAGE_SIZE_BYTES + remote_bytes_max.get();
 }
 
 CallQueue::CallQueue(Allocator *p_custom_allocator, uint32_t p_max_pages, const String &p_error_text) {
@@ -32,14 +32,18 @@
 
 #include "core/object/object_id.h"
 #include "core/os/thread_safe.h"
+#include "core/templates/safe_refcount.h"
 #include "core/templates/local_vector.h"
 #include "core/templates/paged_allocator.h"
 #include "core/variant/variant.h"
 
+#include <atomic>
+
 class Object;
 
 class CallQueue {
 	friend class MessageQueue;
+	friend class TestCallQueueInternalsAccessor;
 
 public:
 	enum {
@@ -89,6 +93,45 @@ private:
 		};
 	};
 
+	// Threads that don't own the queue write messages to pages of their own, and link them into a
+	// lock-free list that `flush()` takes as a whole. Pushing from several threads doesn't contend
+	// on the mutex, and a page is freed once all its messages have been flushed, in any queue.
+	struct RemotePage {
+		uint8_t data[PAGE_SIZE_BYTES];
+		uint32_t used = 0;
+		SafeNumeric<uint32_t> refcount;
+	};
+
+	struct RemoteMessage {
+		RemoteMessage *next = nullptr;
+		RemotePage *page = nullptr;
+		uint32_t size = 0;
+		Message message;
+	};
+
+	struct RemotePageHolder {
+		RemotePage *page = nullptr;
+		~RemotePageHolder();
+	};
+
+	static thread_local RemotePageHolder remote_page;
+
+	std::atomic<RemoteMessage *> remote_head = nullptr;
+	SafeNumeric<uint64_t> remote_bytes;
+	SafeNumeric<uint64_t> remote_bytes_max;
+
+	static void _unref_remote_page(RemotePage *p_page);
+	RemoteMessage *_alloc_remote_message(uint32_t p_room);
+	void _push_remote_message(RemoteMessage *p_remote);
+	void _free_remote_message(RemoteMessage *p_remote);
+	RemoteMessage *_take_remote_messages();
+
+	bool _is_owner_thread() const;
+	uint8_t *_reserve_message(uint32_t p_room, RemoteMessage *&r_remote);
+	void _commit_message(uint32_t p_room, RemoteMessage *p_remote);
+	void _call_message(Message *p_message);
+	void _destroy_message(Message *p_message);
+
 	_FORCE_INLINE_ void _ensure_first_page() {
 		if (unlikely(pages.is_empty())) {
 			pages.push_back(allocator->alloc());
@@ -1207,7 +1207,20 @@ Error Object::_emit_signal(const Variant **p_args, int p_argcount, Callable::Cal
 	return emit_signalp(signal, args, argc);
 }
 
+Object::SignalHandle::SignalHandle(const StringName &p_class, const char *p_signal) {
+	name = StringName(p_signal, true);
+	index = ClassDB::get_signal_index(p_class, name);
+}
+
 Error Object::emit_signalp(const StringName &p_name, const Variant **p_args, int p_argcount) {
+	return _emit_signalp(p_name, -1, p_args, p_argcount);
+}
+
+Error Object::emit_signalp(const SignalHandle &p_signal, const Variant **p_args, int p_argcount) {
+	return _emit_signalp(p_signal.name, p_signal.index, p_args, p_argcount);
+}
+
+Error Object::_emit_signalp(const StringName &p_name, int p_index, const Variant **p_args, int p_argcount) {
 	if (_block_signals) {
 		return ERR_CANT_ACQUIRE_RESOURCE; //no emit, signals blocked
 	}
@@ -1219,7 +1232,18 @@ Error Object::emit_signalp(const StringName &p_name, const Variant **p_args, int
 	{
 		OBJ_SIGNAL_LOCK
 
-		SignalData *s = signal_map.getptr(p_name);
+		SignalData *s = nullptr;
+		if (p_index >= 0) {
+			// Class signals that aren't connected have an empty slot, and were validated when resolving the handle.
+			if ((uint32_t)p_index >= indexed_signals.size() || !indexed_signals[p_index]) {
+				return ERR_UNAVAILABLE;
+			}
+			KeyValue<StringName, SignalData> *E = indexed_signals[p_index];
+			DEV_ASSERT(E->key == p_name);
+			s = &E->value;
+		} else {
+			s = signal_map.getptr(p_name);
+		}
 		if (!s) {
 #ifdef DEBUG_ENABLED
 			bool signal_is_valid = ClassDB::has_signal(get_class_name(), p_name);
@@ -1468,6 +1492,24 @@ void Object::get_signals_connected_to_this(List<Connection> *p_connections) cons
 	}
 }
 
+void Object::_index_signal(const StringName &p_signal) {
+	const int index = ClassDB::get_signal_index(get_class_name(), p_signal);
+	if (index < 0) {
+		return;
+	}
+
+	HashMap<StringName, SignalData>::Iterator E = signal_map.find(p_signal);
+	E->value.index = index;
+	const uint32_t size = indexed_signals.size();
+	if ((uint32_t)index >= size) {
+		indexed_signals.resize(index + 1);
+		for (uint32_t i = size; i < indexed_signals.size(); i++) {
+			indexed_signals[i] = nullptr;
+		}
+	}
+	indexed_signals[index] = &(*E);
+}
+
 Error Object::connect(const StringName &p_signal, const Callable &p_callable, uint32_t p_flags) {
 	ERR_FAIL_COND_V_MSG(p_callable.is_null(), ERR_INVALID_PARAMETER, vformat("Cannot connect to '%s': the provided callable is null.", p_signal));
 	OBJ_SIGNAL_LOCK
@@ -1483,7 +1525,8 @@ Error Object::connect(const StringName &p_signal, const Callable &p_callable, ui
 
 	SignalData *s = signal_map.getptr(p_signal);
 	if (!s) {
-		bool signal_is_valid = ClassDB::has_signal(get_class_name(), p_signal);
+		const bool is_class_signal = ClassDB::has_signal(get_class_name(), p_signal);
+		bool signal_is_valid = is_class_signal;
 		//check in script
 		if (!signal_is_valid && !script.is_null()) {
 			if (Ref<Script>(script)->has_script_signal(p_signal)) {
@@ -1503,6 +1546,9 @@ Error Object::connect(const StringName &p_signal, const Callable &p_callable, ui
 
 		signal_map[p_signal] = SignalData();
 		s = &signal_map[p_signal];
+		if (is_class_signal) {
+			_index_signal(p_signal);
+		}
 	}
 
 	//compare with the base callable, so binds can be ignored
@@ -1616,6 +1662,9 @@ bool Object::_disconnect(const StringName &p_signal, const Callable &p_callable,
 
 	if (s->slot_map.is_empty() && ClassDB::has_signal(get_class_name(), p_signal)) {
 		//not user signal, delete
+		if (s->index >= 0) {
+			indexed_signals[s->index] = nullptr;
+		}
 		signal_map.erase(p_signal);
 	}
 
@@ -2288,6 +2337,7 @@ Object::~Object() {
 
 			signal_map.erase(E.key);
 		}
+		indexed_signals.reset();
 
 		// Disconnect signals that connect to this object.
 		while (connections.size()) {
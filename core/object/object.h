@@ -39,6 +39,7 @@
 #include "core/templates/hash_map.h"
 #include "core/templates/hash_set.h"
 #include "core/templates/list.h"
+#include "core/templates/local_vector.h"
 #include "core/templates/rb_map.h"
 #include "core/templates/safe_refcount.h"
 #include "core/variant/callable_bind.h"
@@ -588,6 +589,16 @@ public:
 		Connection(const Variant &p_variant);
 	};
 
+	// A signal registered in ClassDB, resolved once to its index in the class signal table, so
+	// emitting it doesn't need a lookup by name. Meant to be kept in a static variable, like `SNAME`.
+	// It can be emitted on instances of the class it was resolved for, and of derived classes.
+	struct SignalHandle {
+		StringName name;
+		int index = -1;
+
+		SignalHandle(const StringName &p_class, const char *p_signal);
+	};
+
 private:
 #ifdef DEBUG_ENABLED
 	friend struct _ObjectDebugLock;
@@ -608,10 +619,13 @@ private:
 		MethodInfo user;
 		HashMap<Callable, Slot, HashableHasher<Callable>> slot_map;
 		bool removable = false;
+		int index = -1;
 	};
 	friend struct _ObjectSignalLock;
 	mutable Mutex *signal_mutex = nullptr;
 	HashMap<StringName, SignalData> signal_map;
+	// Connected class signals by their index in the class signal table, see `SignalHandle`.
+	LocalVector<KeyValue<StringName, SignalData> *> indexed_signals;
 	List<Connection> connections;
 #ifdef DEBUG_ENABLED
 	SafeRefCount _lock_index;
@@ -639,6 +653,8 @@ private:
 	bool _has_user_signal(const StringName &p_name) const;
 	void _remove_user_signal(const StringName &p_name);
 	Error _emit_signal(const Variant **p_args, int p_argcount, Callable::CallError &r_error);
+	Error _emit_signalp(const StringName &p_name, int p_index, const Variant **p_args, int p_argcount);
+	void _index_signal(const StringName &p_signal);
 	TypedArray<Dictionary> _get_signal_list() const;
 	TypedArray<Dictionary> _get_signal_connection_list(const StringName &p_signal) const;
 	TypedArray<Dictionary> _get_incoming_connections() const;
@@ -929,7 +945,18 @@ public:
 		return emit_signalp(p_name, sizeof...(p_args) == 0 ? nullptr : (const Variant **)argptrs, sizeof...(p_args));
 	}
 
+	template <typename... VarArgs>
+	Error emit_signal(const SignalHandle &p_signal, VarArgs... p_args) {
+		Variant args[sizeof...(p_args) + 1] = { p_args..., Variant() }; // +1 makes sure zero sized arrays are also supported.
+		const Variant *argptrs[sizeof...(p_args) + 1];
+		for (uint32_t i = 0; i < sizeof...(p_args); i++) {
+			argptrs[i] = &args[i];
+		}
+		return emit_signalp(p_signal, sizeof...(p_args) == 0 ? nullptr : (const Variant **)argptrs, sizeof...(p_args));
+	}
+
 	MTVIRTUAL Error emit_signalp(const StringName &p_name, const Variant **p_args, int p_argcount);
+	MTVIRTUAL Error emit_signalp(const SignalHandle &p_signal, const Variant **p_args, int p_argcount);
 	MTVIRTUAL bool has_signal(const StringName &p_name) const;
 	MTVIRTUAL void get_signal_list(List<MethodInfo> *p_signals) const;
 	MTVIRTUAL void get_signal_connection_list(const StringName &p_signal, List<Connection> *p_connections) const;
@@ -414,6 +414,9 @@ public:
 	virtual void reload_all_scripts() = 0;
 	virtual void reload_scripts(const Array &p_scripts, bool p_soft_reload) = 0;
 	virtual void reload_tool_script(const Ref<Script> &p_script, bool p_soft_reload) = 0;
+	// Called around loading many scripts at once, so a language can prepare them concurrently.
+	virtual void begin_batch_load(const Vector<String> &p_paths) {}
+	virtual void end_batch_load(const Vector<String> &p_paths) {}
 	/* LOADER FUNCTIONS */
 
 	virtual void get_recognized_extensions(List<String> *p_extensions) const = 0;
@@ -46,6 +46,41 @@ void WorkerThreadPool::Task::free_template_userdata() {
 	memdelete(btu);
 }
 
+void WorkerThreadPool::TaskDeque::push_back(Task *p_task) {
+	uint32_t capacity = buffer.size();
+	if (count == capacity) {
+		// Grow, unwrapping the tasks to the start of the new buffer.
+		LocalVector<Task *> new_buffer;
+		new_buffer.resize(MAX(capacity * 2, 64u));
+		for (uint32_t i = 0; i < count; i++) {
+			new_buffer[i] = buffer[(front + i) & (capacity - 1)];
+		}
+		buffer = std::move(new_buffer);
+		front = 0;
+		capacity = buffer.size();
+	}
+	buffer[(front + count) & (capacity - 1)] = p_task;
+	count++;
+}
+
+WorkerThreadPool::Task *WorkerThreadPool::TaskDeque::pop_back() {
+	if (count == 0) {
+		return nullptr;
+	}
+	count--;
+	return buffer[(front + count) & (buffer.size() - 1)];
+}
+
+WorkerThreadPool::Task *WorkerThreadPool::TaskDeque::pop_front() {
+	if (count == 0) {
+		return nullptr;
+	}
+	Task *task = buffer[front];
+	front = (front + 1) & (buffer.size() - 1);
+	count--;
+	return task;
+}
+
 WorkerThreadPool *WorkerThreadPool::singleton = nullptr;
 
 #ifdef THREADS_ENABLED
@@ -165,7 +200,7 @@ void WorkerThreadPool::_process_task(Task *p_task) {
 		if (low_priority) {
 			low_priority_threads_used--;
 
-			if (_try_promote_low_priority_task()) {
+			if (_try_promote_low_priority_task(&curr_thread)) {
 				if (prev_task) { // Otherwise, this thread will catch it.
 					_notify_threads(&curr_thread, 1, 0);
 				}
@@ -186,7 +221,14 @@ void WorkerThreadPool::_thread_function(void *p_user) {
 
 	while (true) {
 		Task *task_to_process = nullptr;
-		{
+
+		// Most of the time there's a task in this thread's queue, or one to steal from another thread,
+		// so try that first without contending for the pool lock.
+		if (likely(thread_data->pool->lock_free_pop_allowed.is_set())) {
+			task_to_process = thread_data->pool->_pop_task(thread_data);
+		}
+
+		if (!task_to_process) {
 			// Create the lock outside the inner loop so it isn't needlessly unlocked and relocked
 			//  when no task was found to process, and the loop is re-entered.
 			MutexLock lock(thread_data->pool->task_mutex);
@@ -199,16 +241,16 @@ void WorkerThreadPool::_thread_function(void *p_user) {
 
 				thread_data->signaled = false;
 
-				if (!thread_data->pool->task_queue.first()) {
+				// Tasks are only pushed with the lock held, so none can be missed between this check and the wait.
+				task_to_process = thread_data->pool->_pop_task(thread_data);
+				if (!task_to_process) {
 					// There wasn't a task available yet.
 					// Let's wait for the next notification, then recheck.
 					thread_data->cond_var.wait(lock);
 					continue;
 				}
 
-				// Got a task to process! Remove it from the queue, then break into the task handling section.
-				task_to_process = thread_data->pool->task_queue.first()->self();
-				thread_data->pool->task_queue.remove(thread_data->pool->task_queue.first());
+				// Got a task to process! Break into the task handling section.
 				break;
 			}
 		}
@@ -244,7 +286,14 @@ void WorkerThreadPool::_post_tasks(Task **p_tasks, uint32_t p_count, bool p_high
 	for (uint32_t i = 0; i < p_count; i++) {
 		p_tasks[i]->low_priority = !p_high_priority;
 		if (p_high_priority || low_priority_threads_used < max_low_priority_threads) {
-			task_queue.add_last(&p_tasks[i]->task_elem);
+			// Pool threads keep their own tasks, to be stolen by idle threads.
+			// Tasks from other threads are spread across the queues.
+			if (caller_pool_thread) {
+				_push_task(caller_pool_thread, p_tasks[i]);
+			} else {
+				_push_task(&threads[post_index], p_tasks[i]);
+				post_index = (post_index + 1) % threads.size();
+			}
 			if (!p_high_priority) {
 				low_priority_threads_used++;
 			}
@@ -323,11 +372,49 @@ void WorkerThreadPool::_notify_threads(const ThreadData *p_current_thread_data,
 	}
 }
 
-bool WorkerThreadPool::_try_promote_low_priority_task() {
+void WorkerThreadPool::_push_task(ThreadData *p_thread_data, Task *p_task) {
+	// Counted before it's visible, so the count is never lower than the amount of queued tasks.
+	queued_tasks.increment();
+
+	p_thread_data->queue_lock.lock();
+	p_thread_data->queues[p_task->low_priority ? LANE_LOW_PRIORITY : LANE_HIGH_PRIORITY].push_back(p_task);
+	p_thread_data->queue_lock.unlock();
+}
+
+WorkerThreadPool::Task *WorkerThreadPool::_pop_task(ThreadData *p_thread_data) {
+	if (queued_tasks.get() == 0) {
+		return nullptr;
+	}
+
+	uint32_t thread_count = threads.size();
+	for (uint32_t lane = 0; lane < LANE_MAX; lane++) {
+		// Newest task of this thread first, since it's the most likely to have its data in cache.
+		p_thread_data->queue_lock.lock();
+		Task *task = p_thread_data->queues[lane].pop_back();
+		p_thread_data->queue_lock.unlock();
+
+		// Otherwise, steal the oldest task of another thread.
+		for (uint32_t i = 1; i < thread_count && !task; i++) {
+			ThreadData &victim = threads[(p_thread_data->index + i) % thread_count];
+			victim.queue_lock.lock();
+			task = victim.queues[lane].pop_front();
+			victim.queue_lock.unlock();
+		}
+
+		if (task) {
+			queued_tasks.decrement();
+			return task;
+		}
+	}
+
+	return nullptr;
+}
+
+bool WorkerThreadPool::_try_promote_low_priority_task(ThreadData *p_thread_data) {
 	if (low_priority_task_queue.first()) {
 		Task *low_prio_task = low_priority_task_queue.first()->self();
 		low_priority_task_queue.remove(low_priority_task_queue.first());
-		task_queue.add_last(&low_prio_task->task_elem);
+		_push_task(p_thread_data, low_prio_task);
 		low_priority_threads_used++;
 		return true;
 	} else {
@@ -490,7 +577,7 @@ void WorkerThreadPool::_wait_collaboratively(ThreadData *p_caller_pool_thread, T
 				if (was_signaled) {
 					// This thread was awaken for some additional reason, but it's about to exit.
 					// Let's find out what may be pending and forward the requests.
-					uint32_t to_process = task_queue.first() ? 1 : 0;
+					uint32_t to_process = queued_tasks.get() ? 1 : 0;
 					uint32_t to_promote = p_caller_pool_thread->current_task->low_priority && low_priority_task_queue.first() ? 1 : 0;
 					if (to_process || to_promote) {
 						// This thread must be left alone since it won't loop again.
@@ -503,15 +590,12 @@ void WorkerThreadPool::_wait_collaboratively(ThreadData *p_caller_pool_thread, T
 			}
 
 			if (p_caller_pool_thread->current_task->low_priority && low_priority_task_queue.first()) {
-				if (_try_promote_low_priority_task()) {
+				if (_try_promote_low_priority_task(p_caller_pool_thread)) {
 					_notify_threads(p_caller_pool_thread, 1, 0);
 				}
 			}
 
-			if (p_caller_pool_thread->pool->task_queue.first()) {
-				task_to_process = task_queue.first()->self();
-				task_queue.remove(task_queue.first());
-			}
+			task_to_process = _pop_task(p_caller_pool_thread);
 
 			if (!task_to_process) {
 				p_caller_pool_thread->awaited_task = p_task;
@@ -540,6 +624,7 @@ void WorkerThreadPool::_wait_collaboratively(ThreadData *p_caller_pool_thread, T
 void WorkerThreadPool::_switch_runlevel(Runlevel p_runlevel) {
 	DEV_ASSERT(p_runlevel > runlevel);
 	runlevel = p_runlevel;
+	lock_free_pop_allowed.clear();
 	memset(&runlevel_data, 0, sizeof(runlevel_data));
 	for (uint32_t i = 0; i < threads.size(); i++) {
 		threads[i].cond_var.notify_one();
@@ -556,7 +641,7 @@ bool WorkerThreadPool::_handle_runlevel(ThreadData *p_thread_data, MutexLock<Bin
 		} break;
 		case RUNLEVEL_PRE_EXIT_LANGUAGES: {
 			if (!p_thread_data->pre_exited_languages) {
-				if (!task_queue.first() && !low_priority_task_queue.first()) {
+				if (queued_tasks.get() == 0 && !low_priority_task_queue.first()) {
 					p_thread_data->pre_exited_languages = true;
 					runlevel_data.pre_exit_languages.num_idle_threads++;
 					control_cond_var.notify_all();
@@ -770,6 +855,7 @@ void WorkerThreadPool::init(int p_thread_count, float p_low_priority_task_ratio)
 	ERR_FAIL_COND(threads.size() > 0);
 
 	runlevel = RUNLEVEL_NORMAL;
+	lock_free_pop_allowed.set();
 
 	if (p_thread_count < 0) {
 		p_thread_count = OS::get_singleton()->get_default_thread_pool_size();
@@ -844,6 +930,18 @@ void WorkerThreadPool::finish() {
 
 	{
 		MutexLock lock(task_mutex);
+		// Tasks of groups are not tracked by ID, so free the ones that never ran.
+		for (ThreadData &data : threads) {
+			for (uint32_t lane = 0; lane < LANE_MAX; lane++) {
+				while (Task *task = data.queues[lane].pop_front()) {
+					if (task->group) {
+						task_allocator.free(task);
+					}
+				}
+			}
+		}
+		queued_tasks.set(0);
+
 		for (KeyValue<TaskID, Task *> &E : tasks) {
 			task_allocator.free(E.value);
 		}
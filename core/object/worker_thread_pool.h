@@ -34,6 +34,7 @@
 #include "core/os/memory.h"
 #include "core/os/os.h"
 #include "core/os/semaphore.h"
+#include "core/os/spin_lock.h"
 #include "core/os/thread.h"
 #include "core/templates/local_vector.h"
 #include "core/templates/paged_allocator.h"
@@ -95,14 +96,33 @@ private:
 				task_elem(this) {}
 	};
 
+	// Ring buffer of tasks. The owner thread pushes and pops at the back (newest first),
+	// other threads steal from the front (oldest first).
+	struct TaskDeque {
+		LocalVector<Task *> buffer; // Size is zero or a power of two.
+		uint32_t front = 0;
+		uint32_t count = 0;
+
+		void push_back(Task *p_task);
+		Task *pop_back();
+		Task *pop_front();
+	};
+
+	// Runnable tasks are queued in lanes, and no low priority task is picked while a high priority one is queued anywhere.
+	enum Lane {
+		LANE_HIGH_PRIORITY,
+		LANE_LOW_PRIORITY,
+		LANE_MAX,
+	};
+
 	static const uint32_t TASKS_PAGE_SIZE = 1024;
 	static const uint32_t GROUPS_PAGE_SIZE = 256;
 
 	PagedAllocator<Task, false, TASKS_PAGE_SIZE> task_allocator;
 	PagedAllocator<Group, false, GROUPS_PAGE_SIZE> group_allocator;
 
+	// Low priority tasks beyond the allowed amount of threads wait here to be promoted to a lane.
 	SelfList<Task>::List low_priority_task_queue;
-	SelfList<Task>::List task_queue;
 
 	BinaryMutex task_mutex;
 
@@ -120,6 +140,10 @@ private:
 		ConditionVariable cond_var;
 		WorkerThreadPool *pool = nullptr;
 
+		// Pushing is done with `task_mutex` held; popping and stealing only take `queue_lock`.
+		SpinLock queue_lock;
+		TaskDeque queues[LANE_MAX];
+
 		ThreadData() :
 				signaled(false),
 				yield_is_over(false),
@@ -163,6 +187,10 @@ private:
 	uint32_t max_low_priority_threads = 0;
 	uint32_t low_priority_threads_used = 0;
 	uint32_t notify_index = 0; // For rotating across threads, no help distributing load.
+	uint32_t post_index = 0; // For rotating across thread queues when posting from outside the pool.
+
+	SafeNumeric<uint32_t> queued_tasks; // Across all thread queues; never lower than the actual amount.
+	SafeFlag lock_free_pop_allowed; // Only at the normal runlevel, so threads check runlevel changes.
 
 	uint64_t last_task = 1;
 
@@ -172,10 +200,13 @@ private:
 
 	void _process_task(Task *task);
 
+	void _push_task(ThreadData *p_thread_data, Task *p_task);
+	Task *_pop_task(ThreadData *p_thread_data);
+
 	void _post_tasks(Task **p_tasks, uint32_t p_count, bool p_high_priority, MutexLock<BinaryMutex> &p_lock);
 	void _notify_threads(const ThreadData *p_current_thread_data, uint32_t p_process_count, uint32_t p_promote_count);
 
-	bool _try_promote_low_priority_task();
+	bool _try_promote_low_priority_task(ThreadData *p_thread_data);
 
 	static WorkerThreadPool *singleton;
 
@@ -0,0 +1,154 @@
+/**************************************************************************/
+/*  lock_profiler.cpp                                                     */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GODOT ENGINE                               */
+/*                        https://godotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+
+#include "lock_profiler.h"
+
+#ifdef LOCK_PROFILING_ENABLED
+
+#include "core/os/mutex.h"
+
+#include <chrono>
+#include <cstring>
+
+struct LockProfileRegistry {
+	// Plain standard mutex, since Godot's own would be profiled.
+	THREADING_NAMESPACE::mutex mutex;
+	LockProfile profiles[LockProfiler::MAX_PROFILES];
+	SafeNumeric<uint32_t> profile_count;
+};
+
+// Named locks are created during static initialization of other translation units,
+// so the registry is built on first use rather than as a global of unspecified order.
+static LockProfileRegistry &_get_registry() {
+	static LockProfileRegistry registry;
+	return registry;
+}
+
+void LockProfile::_record_contention(const char *p_owner_file, int p_owner_line, uint64_t p_wait_usec) {
+	contended.increment();
+	wait_usec.add(p_wait_usec);
+	max_wait_usec.exchange_if_greater(p_wait_usec);
+
+	THREADING_NAMESPACE::lock_guard<THREADING_NAMESPACE::mutex> guard(_get_registry().mutex);
+	uint32_t i = 0;
+	while (i < site_count && (sites[i].file != p_owner_file || sites[i].line != p_owner_line)) {
+		i++;
+	}
+	if (i == site_count) {
+		if (site_count < MAX_SITES) {
+			site_count++;
+		} else {
+			// Table is full, replace the site that has waited the least.
+			i = MAX_SITES - 1;
+			for (uint32_t j = 0; j < MAX_SITES - 1; j++) {
+				if (sites[j].wait_usec < sites[i].wait_usec) {
+					i = j;
+				}
+			}
+		}
+		sites[i] = Site();
+		sites[i].file = p_owner_file;
+		sites[i].line = p_owner_line;
+	}
+	sites[i].contended++;
+	sites[i].wait_usec += p_wait_usec;
+}
+
+LockProfile *LockProfiler::get_profile(const char *p_name) {
+	LockProfileRegistry &registry = _get_registry();
+	LockProfile *profiles = registry.profiles;
+	THREADING_NAMESPACE::lock_guard<THREADING_NAMESPACE::mutex> guard(registry.mutex);
+	uint32_t count = registry.profile_count.get();
+	for (uint32_t i = 0; i < count; i++) {
+		if (strcmp(profiles[i].name, p_name) == 0) {
+			return &profiles[i];
+		}
+	}
+	if (count == MAX_PROFILES) {
+		// Can't report through the error macros, they may lock.
+		return nullptr;
+	}
+	profiles[count].name = p_name;
+	registry.profile_count.increment();
+	return &profiles[count];
+}
+
+uint64_t LockProfiler::get_ticks_usec() {
+	// Usable before the OS singleton exists, locks are created during static initialization.
+	return std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+uint32_t LockProfiler::get_profile_count() {
+	return _get_registry().profile_count.get();
+}
+
+LockProfile::Stats LockProfiler::get_stats(uint32_t p_index) {
+	LockProfileRegistry &registry = _get_registry();
+	LockProfile::Stats stats;
+	if (p_index >= registry.profile_count.get()) {
+		return stats;
+	}
+
+	LockProfile &profile = registry.profiles[p_index];
+	THREADING_NAMESPACE::lock_guard<THREADING_NAMESPACE::mutex> guard(registry.mutex);
+	stats.name = profile.name;
+	stats.acquisitions = profile.acquisitions.get();
+	stats.contended = profile.contended.get();
+	stats.wait_usec = profile.wait_usec.get();
+	stats.max_wait_usec = profile.max_wait_usec.get();
+	stats.site_count = profile.site_count;
+	for (uint32_t i = 0; i < profile.site_count; i++) {
+		// Insertion sort, there are only a handful of sites.
+		uint32_t j = i;
+		while (j > 0 && stats.sites[j - 1].wait_usec < profile.sites[i].wait_usec) {
+			stats.sites[j] = stats.sites[j - 1];
+			j--;
+		}
+		stats.sites[j] = profile.sites[i];
+	}
+	return stats;
+}
+
+void LockProfiler::reset() {
+	LockProfileRegistry &registry = _get_registry();
+	THREADING_NAMESPACE::lock_guard<THREADING_NAMESPACE::mutex> guard(registry.mutex);
+	uint32_t count = registry.profile_count.get();
+	for (uint32_t i = 0; i < count; i++) {
+		LockProfile &profile = registry.profiles[i];
+		profile.acquisitions.set(0);
+		profile.contended.set(0);
+		profile.wait_usec.set(0);
+		profile.max_wait_usec.set(0);
+		profile.site_count = 0;
+	}
+}
+
+#endif // LOCK_PROFILING_ENABLED
@@ -0,0 +1,182 @@
+/**************************************************************************/
+/*  lock_profiler.h                                                       */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GODOT ENGINE                               */
+/*                        https://godotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+
+#pragma once
+
+#include "core/typedefs.h"
+
+#ifdef LOCK_PROFILING_ENABLED
+
+#include "core/templates/safe_refcount.h"
+
+// Contention statistics for named locks, recorded in builds made with `lock_profiling=yes`.
+// Locks sharing a name share a profile, so per-instance locks (like the one each font has)
+// are reported as a single entry. Locks without a name are not tracked.
+class LockProfile {
+	friend class LockProfiler;
+	friend class LockProfileState;
+
+public:
+	static constexpr uint32_t MAX_SITES = 8;
+
+	// Call site that owned the lock while another thread waited for it.
+	struct Site {
+		const char *file = nullptr; // `nullptr` when held for reading.
+		int line = 0;
+		uint64_t contended = 0;
+		uint64_t wait_usec = 0;
+	};
+
+	struct Stats {
+		const char *name = nullptr;
+		uint64_t acquisitions = 0;
+		uint64_t contended = 0;
+		uint64_t wait_usec = 0;
+		uint64_t max_wait_usec = 0;
+		uint32_t site_count = 0;
+		Site sites[MAX_SITES]; // Sorted by wait time, longest first.
+	};
+
+private:
+	const char *name = nullptr;
+	SafeNumeric<uint64_t> acquisitions;
+	SafeNumeric<uint64_t> contended;
+	SafeNumeric<uint64_t> wait_usec;
+	SafeNumeric<uint64_t> max_wait_usec;
+
+	// Guarded by the profiler; only touched after a contended acquisition.
+	uint32_t site_count = 0;
+	Site sites[MAX_SITES];
+
+	void _record_contention(const char *p_owner_file, int p_owner_line, uint64_t p_wait_usec);
+};
+
+class LockProfiler {
+public:
+	static constexpr uint32_t MAX_PROFILES = 256;
+
+	// The name must outlive the profiler, string literals are expected.
+	static LockProfile *get_profile(const char *p_name);
+	static uint64_t get_ticks_usec();
+
+	static uint32_t get_profile_count();
+	static LockProfile::Stats get_stats(uint32_t p_index);
+	static void reset();
+};
+
+// Per-lock state, embedded in every lock type when profiling is enabled.
+class LockProfileState {
+	LockProfile *profile = nullptr;
+	std::atomic<const char *> owner_file = nullptr;
+	std::atomic<int> owner_line = 0;
+
+	_FORCE_INLINE_ void _set_owner(const char *p_file, int p_line) {
+		owner_file.store(p_file, std::memory_order_relaxed);
+		owner_line.store(p_line, std::memory_order_relaxed);
+	}
+
+	template <typename LockT, bool Shared>
+	void _lock_contended(LockT &p_lock) {
+		const char *waited_file = owner_file.load(std::memory_order_relaxed);
+		int waited_line = owner_line.load(std::memory_order_relaxed);
+		uint64_t begin = LockProfiler::get_ticks_usec();
+		if constexpr (Shared) {
+			p_lock.lock_shared();
+		} else {
+			p_lock.lock();
+		}
+		profile->_record_contention(waited_file, waited_line, LockProfiler::get_ticks_usec() - begin);
+	}
+
+public:
+	void set_name(const char *p_name) {
+		profile = p_name ? LockProfiler::get_profile(p_name) : nullptr;
+	}
+
+	// `LockT` is any standard lockable, locked exclusively.
+	template <typename LockT>
+	_ALWAYS_INLINE_ void lock(LockT &p_lock, const char *p_file, int p_line) {
+		if (likely(!profile)) {
+			p_lock.lock();
+			return;
+		}
+		if (!p_lock.try_lock()) {
+			_lock_contended<LockT, false>(p_lock);
+		}
+		profile->acquisitions.increment();
+		_set_owner(p_file, p_line);
+	}
+
+	template <typename LockT>
+	_ALWAYS_INLINE_ bool try_lock(LockT &p_lock, const char *p_file, int p_line) {
+		if (!p_lock.try_lock()) {
+			return false;
+		}
+		if (profile) {
+			profile->acquisitions.increment();
+			_set_owner(p_file, p_line);
+		}
+		return true;
+	}
+
+	// Readers don't become owners; a writer waiting on them is reported against a `nullptr` site.
+	template <typename LockT>
+	_ALWAYS_INLINE_ void lock_shared(LockT &p_lock) {
+		if (likely(!profile)) {
+			p_lock.lock_shared();
+			return;
+		}
+		if (!p_lock.try_lock_shared()) {
+			_lock_contended<LockT, true>(p_lock);
+		}
+		profile->acquisitions.increment();
+	}
+
+	template <typename LockT>
+	_ALWAYS_INLINE_ bool try_lock_shared(LockT &p_lock) {
+		if (!p_lock.try_lock_shared()) {
+			return false;
+		}
+		if (profile) {
+			profile->acquisitions.increment();
+		}
+		return true;
+	}
+
+	// Called before an exclusive lock that readers can also take is released.
+	_ALWAYS_INLINE_ void release_owner() {
+		if (profile) {
+			_set_owner(nullptr, 0);
+		}
+	}
+};
+
+#endif // LOCK_PROFILING_ENABLED
@@ -30,6 +30,7 @@
 
 #pragma once
 
+#include "core/os/lock_profiler.h"
 #include "core/typedefs.h"
 
 #ifdef MINGW_ENABLED
@@ -54,6 +55,27 @@ class MutexImpl {
 
 	mutable StdMutexT mutex;
 
+#ifdef LOCK_PROFILING_ENABLED
+	mutable LockProfileState profile;
+
+public:
+	_ALWAYS_INLINE_ void lock(const char *p_file = __builtin_FILE(), int p_line = __builtin_LINE()) const {
+		profile.lock(mutex, p_file, p_line);
+	}
+
+	_ALWAYS_INLINE_ void unlock() const {
+		mutex.unlock();
+	}
+
+	_ALWAYS_INLINE_ bool try_lock(const char *p_file = __builtin_FILE(), int p_line = __builtin_LINE()) const {
+		return profile.try_lock(mutex, p_file, p_line);
+	}
+
+	// Names the lock for contention statistics; locks with the same name are aggregated.
+	void set_profile_name(const char *p_name) {
+		profile.set_name(p_name);
+	}
+#else
 public:
 	_ALWAYS_INLINE_ void lock() const {
 		mutex.lock();
@@ -66,15 +88,34 @@ public:
 	_ALWAYS_INLINE_ bool try_lock() const {
 		return mutex.try_lock();
 	}
+
+	_ALWAYS_INLINE_ void set_profile_name(const char *p_name) {}
+#endif // LOCK_PROFILING_ENABLED
+
+	MutexImpl() = default;
+	explicit MutexImpl(const char *p_profile_name) {
+		set_profile_name(p_profile_name);
+	}
 };
 
 template <typename MutexT>
 class MutexLock {
 	mutable THREADING_NAMESPACE::unique_lock<typename MutexT::StdMutexType> lock;
 
+#ifdef LOCK_PROFILING_ENABLED
+	const MutexT &mutex;
+
+public:
+	explicit MutexLock(const MutexT &p_mutex, const char *p_file = __builtin_FILE(), int p_line = __builtin_LINE()) :
+			lock(p_mutex.mutex, THREADING_NAMESPACE::defer_lock),
+			mutex(p_mutex) {
+		p_mutex.profile.lock(lock, p_file, p_line);
+	}
+#else
 public:
 	explicit MutexLock(const MutexT &p_mutex) :
 			lock(p_mutex.mutex) {}
+#endif // LOCK_PROFILING_ENABLED
 
 	// Clarification: all the funny syntax is needed so this function exists only for binary mutexes.
 	template <typename T = MutexT>
@@ -83,9 +124,15 @@ public:
 		return lock;
 	}
 
+#ifdef LOCK_PROFILING_ENABLED
+	_ALWAYS_INLINE_ void temp_relock(const char *p_file = __builtin_FILE(), int p_line = __builtin_LINE()) const {
+		mutex.profile.lock(lock, p_file, p_line);
+	}
+#else
 	_ALWAYS_INLINE_ void temp_relock() const {
 		lock.lock();
 	}
+#endif // LOCK_PROFILING_ENABLED
 
 	_ALWAYS_INLINE_ void temp_unlock() const {
 		lock.unlock();
@@ -111,6 +158,10 @@ public:
 	void lock() const {}
 	void unlock() const {}
 	bool try_lock() const { return true; }
+	void set_profile_name(const char *p_name) {}
+
+	MutexImpl() = default;
+	explicit MutexImpl(const char *p_profile_name) {}
 };
 
 template <typename MutexT>
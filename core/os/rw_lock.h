@@ -30,6 +30,7 @@
 
 #pragma once
 
+#include "core/os/lock_profiler.h"
 #include "core/typedefs.h"
 
 #ifdef MINGW_ENABLED
@@ -44,6 +45,46 @@
 class RWLock {
 	mutable THREADING_NAMESPACE::shared_timed_mutex mutex;
 
+#ifdef LOCK_PROFILING_ENABLED
+	mutable LockProfileState profile;
+
+public:
+	// Lock the RWLock, block if locked by someone else.
+	_ALWAYS_INLINE_ void read_lock() const {
+		profile.lock_shared(mutex);
+	}
+
+	// Unlock the RWLock, let other threads continue.
+	_ALWAYS_INLINE_ void read_unlock() const {
+		mutex.unlock_shared();
+	}
+
+	// Attempt to lock the RWLock for reading. True on success, false means it can't lock.
+	_ALWAYS_INLINE_ bool read_try_lock() const {
+		return profile.try_lock_shared(mutex);
+	}
+
+	// Lock the RWLock, block if locked by someone else.
+	_ALWAYS_INLINE_ void write_lock(const char *p_file = __builtin_FILE(), int p_line = __builtin_LINE()) {
+		profile.lock(mutex, p_file, p_line);
+	}
+
+	// Unlock the RWLock, let other threads continue.
+	_ALWAYS_INLINE_ void write_unlock() {
+		profile.release_owner();
+		mutex.unlock();
+	}
+
+	// Attempt to lock the RWLock for writing. True on success, false means it can't lock.
+	_ALWAYS_INLINE_ bool write_try_lock(const char *p_file = __builtin_FILE(), int p_line = __builtin_LINE()) {
+		return profile.try_lock(mutex, p_file, p_line);
+	}
+
+	// Names the lock for contention statistics; locks with the same name are aggregated.
+	void set_profile_name(const char *p_name) {
+		profile.set_name(p_name);
+	}
+#else
 public:
 	// Lock the RWLock, block if locked by someone else.
 	_ALWAYS_INLINE_ void read_lock() const {
@@ -74,6 +115,14 @@ public:
 	_ALWAYS_INLINE_ bool write_try_lock() {
 		return mutex.try_lock();
 	}
+
+	_ALWAYS_INLINE_ void set_profile_name(const char *p_name) {}
+#endif // LOCK_PROFILING_ENABLED
+
+	RWLock() = default;
+	explicit RWLock(const char *p_profile_name) {
+		set_profile_name(p_profile_name);
+	}
 };
 
 class RWLockRead {
@@ -93,10 +142,17 @@ class RWLockWrite {
 	RWLock &lock;
 
 public:
+#ifdef LOCK_PROFILING_ENABLED
+	_ALWAYS_INLINE_ RWLockWrite(RWLock &p_lock, const char *p_file = __builtin_FILE(), int p_line = __builtin_LINE()) :
+			lock(p_lock) {
+		lock.write_lock(p_file, p_line);
+	}
+#else
 	_ALWAYS_INLINE_ RWLockWrite(RWLock &p_lock) :
 			lock(p_lock) {
 		lock.write_lock();
 	}
+#endif // LOCK_PROFILING_ENABLED
 	_ALWAYS_INLINE_ ~RWLockWrite() {
 		lock.write_unlock();
 	}
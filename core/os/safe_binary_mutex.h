@@ -63,6 +63,21 @@ class SafeBinaryMutex {
 	};
 	static thread_local TLSData tls_data;
 
+#ifdef LOCK_PROFILING_ENABLED
+	mutable LockProfileState profile;
+
+public:
+	_ALWAYS_INLINE_ void lock(const char *p_file = __builtin_FILE(), int p_line = __builtin_LINE()) const {
+		if (++tls_data.count == 1) {
+			profile.lock(tls_data.lock, p_file, p_line);
+		}
+	}
+
+	// Names the lock for contention statistics.
+	void set_profile_name(const char *p_name) {
+		profile.set_name(p_name);
+	}
+#else
 public:
 	_ALWAYS_INLINE_ void lock() const {
 		if (++tls_data.count == 1) {
@@ -70,6 +85,9 @@ public:
 		}
 	}
 
+	_ALWAYS_INLINE_ void set_profile_name(const char *p_name) {}
+#endif // LOCK_PROFILING_ENABLED
+
 	_ALWAYS_INLINE_ void unlock() const {
 		DEV_ASSERT(tls_data.count);
 		if (--tls_data.count == 0) {
@@ -84,6 +102,10 @@ public:
 	_ALWAYS_INLINE_ SafeBinaryMutex() {
 	}
 
+	_ALWAYS_INLINE_ explicit SafeBinaryMutex(const char *p_profile_name) {
+		set_profile_name(p_profile_name);
+	}
+
 	_ALWAYS_INLINE_ ~SafeBinaryMutex() {
 		DEV_ASSERT(!tls_data.count);
 	}
@@ -96,18 +118,31 @@ class MutexLock<SafeBinaryMutex<Tag>> {
 	const SafeBinaryMutex<Tag> &mutex;
 
 public:
+#ifdef LOCK_PROFILING_ENABLED
+	explicit MutexLock(const SafeBinaryMutex<Tag> &p_mutex, const char *p_file = __builtin_FILE(), int p_line = __builtin_LINE()) :
+			mutex(p_mutex) {
+		mutex.lock(p_file, p_line);
+	}
+#else
 	explicit MutexLock(const SafeBinaryMutex<Tag> &p_mutex) :
 			mutex(p_mutex) {
 		mutex.lock();
 	}
+#endif // LOCK_PROFILING_ENABLED
 
 	~MutexLock() {
 		mutex.unlock();
 	}
 
+#ifdef LOCK_PROFILING_ENABLED
+	_ALWAYS_INLINE_ void temp_relock(const char *p_file = __builtin_FILE(), int p_line = __builtin_LINE()) const {
+		mutex.lock(p_file, p_line);
+	}
+#else
 	_ALWAYS_INLINE_ void temp_relock() const {
 		mutex.lock();
 	}
+#endif // LOCK_PROFILING_ENABLED
 
 	_ALWAYS_INLINE_ void temp_unlock() const {
 		mutex.unlock();
@@ -130,6 +165,10 @@ class SafeBinaryMutex {
 public:
 	void lock() const {}
 	void unlock() const {}
+	void set_profile_name(const char *p_name) {}
+
+	SafeBinaryMutex() {}
+	explicit SafeBinaryMutex(const char *p_profile_name) {}
 };
 
 template <int Tag>
@@ -37,6 +37,7 @@
 
 #include <errno.h>
 #include <fcntl.h>
+#include <sys/mman.h>
 #include <sys/stat.h>
 #include <sys/types.h>
 #include <unistd.h>
@@ -171,6 +172,12 @@ void FileAccessUnix::_close() {
 		return;
 	}
 
+	if (mapped) {
+		munmap(mapped, mapped_length);
+		mapped = nullptr;
+		mapped_length = 0;
+	}
+
 	fclose(f);
 	f = nullptr;
 
@@ -262,6 +269,36 @@ uint64_t FileAccessUnix::get_length() const {
 	return size;
 }
 
+const uint8_t *FileAccessUnix::map_read_only() {
+	ERR_FAIL_NULL_V_MSG(f, nullptr, "File must be opened before use.");
+
+#if defined(WEB_ENABLED)
+	// Emscripten emulates mappings with heap copies, which defeats the purpose.
+	return nullptr;
+#else
+	if (mapped) {
+		return mapped;
+	}
+	if (flags != READ) {
+		return nullptr;
+	}
+
+	uint64_t length = get_length();
+	if (length == 0 || length > SIZE_MAX) {
+		return nullptr;
+	}
+
+	void *ptr = mmap(nullptr, length, PROT_READ, MAP_SHARED, fileno(f), 0);
+	if (ptr == MAP_FAILED) {
+		return nullptr;
+	}
+
+	mapped = (uint8_t *)ptr;
+	mapped_length = length;
+	return mapped;
+#endif
+}
+
 bool FileAccessUnix::eof_reached() const {
 	return feof(f);
 }
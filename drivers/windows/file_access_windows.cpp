@@ -238,6 +238,11 @@ void FileAccessWindows::_close() {
 		return;
 	}
 
+	if (mapped) {
+		UnmapViewOfFile(mapped);
+		mapped = nullptr;
+	}
+
 	fclose(f);
 	f = nullptr;
 
@@ -328,6 +333,35 @@ uint64_t FileAccessWindows::get_length() const {
 	return size;
 }
 
+const uint8_t *FileAccessWindows::map_read_only() {
+	ERR_FAIL_NULL_V_MSG(f, nullptr, "File must be opened before use.");
+
+	if (mapped) {
+		return mapped;
+	}
+	if (flags != READ || get_length() == 0) {
+		return nullptr;
+	}
+
+	HANDLE file_handle = (HANDLE)_get_osfhandle(_fileno(f));
+	if (file_handle == INVALID_HANDLE_VALUE) {
+		return nullptr;
+	}
+
+	HANDLE mapping = CreateFileMappingW(file_handle, nullptr, PAGE_READONLY, 0, 0, nullptr);
+	if (!mapping) {
+		return nullptr;
+	}
+	void *ptr = MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0);
+	CloseHandle(mapping); // The view keeps the mapping object alive.
+	if (!ptr) {
+		return nullptr;
+	}
+
+	mapped = (uint8_t *)ptr;
+	return mapped;
+}
+
 bool FileAccessWindows::eof_reached() const {
 	return feof(f);
 }
@@ -2184,6 +2184,30 @@ void EditorFileSystem::_update_script_documentation() {
 		}
 	}
 
+	// Every script is loaded when the editor starts, let languages prepare them all at once.
+	LocalVector<Vector<String>> batch_paths;
+	batch_paths.resize(ScriptServer::get_language_count());
+	if (update_script_paths_documentation.size() > 1) {
+		for (const String &path : update_script_paths_documentation) {
+			int index = -1;
+			EditorFileSystemDirectory *efd = find_file(path, &index);
+			if (!efd || index < 0) {
+				continue;
+			}
+			for (int i = 0; i < ScriptServer::get_language_count(); i++) {
+				ScriptLanguage *lang = ScriptServer::get_language(i);
+				if (lang->supports_documentation() && efd->files[index]->type == lang->get_type()) {
+					batch_paths[i].push_back(path);
+				}
+			}
+		}
+		for (int i = 0; i < ScriptServer::get_language_count(); i++) {
+			if (batch_paths[i].size() > 1) {
+				ScriptServer::get_language(i)->begin_batch_load(batch_paths[i]);
+			}
+		}
+	}
+
 	int step_count = 0;
 	for (const String &path : update_script_paths_documentation) {
 		int index = -1;
@@ -2223,6 +2247,12 @@ void EditorFileSystem::_update_script_documentation() {
 		}
 	}
 
+	for (uint32_t i = 0; i < batch_paths.size(); i++) {
+		if (batch_paths[i].size() > 1) {
+			ScriptServer::get_language(i)->end_batch_load(batch_paths[i]);
+		}
+	}
+
 	memdelete_notnull(ep);
 
 	update_script_paths_documentation.clear();
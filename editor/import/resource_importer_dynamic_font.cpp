@@ -244,17 +244,18 @@ Error ResourceImporterDynamicFont::import(ResourceUID::ID p_source_id, const Str
 
 		RID conf_rid = font->find_variation(variation, face_index, embolden, transform);
 
+		PackedInt32Array glyph_list;
 		Array chars = preload_config["chars"];
 		for (int j = 0; j < chars.size(); j++) {
 			char32_t c = chars[j].operator int();
-			TS->font_render_range(conf_rid, size, c, c);
+			glyph_list.push_back(TS->font_get_glyph_index(conf_rid, size.x, c, 0));
 		}
 
 		Array glyphs = preload_config["glyphs"];
 		for (int j = 0; j < glyphs.size(); j++) {
-			int32_t c = glyphs[j];
-			TS->font_render_glyph(conf_rid, size, c);
+			glyph_list.push_back(glyphs[j]);
 		}
+		TS->font_render_glyphs(conf_rid, size, glyph_list);
 	}
 
 	int flg = 0;
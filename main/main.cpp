@@ -2101,6 +2101,9 @@ Error Main::setup(const char *execpath, int argc, char *argv[], bool p_second_ph
 	}
 #endif
 
+	// Packs are mapped on first access, so this also applies to the main pack the settings were loaded from.
+	packed_data->set_use_mmap(GLOBAL_DEF_RST("filesystem/pck/use_memory_mapping", false));
+
 	GLOBAL_DEF("debug/file_logging/enable_file_logging", false);
 	// Only file logging by default on desktop platforms as logs can't be
 	// accessed easily on mobile/Web platforms (if at all).
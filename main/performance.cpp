@@ -30,6 +30,7 @@
 
 #include "performance.h"
 
+#include "core/os/lock_profiler.h"
 #include "core/os/os.h"
 #include "core/variant/typed_array.h"
 #include "scene/main/node.h"
@@ -548,6 +549,10 @@ Variant Performance::get_custom_monitor(const StringName &p_id) {
 }
 
 TypedArray<StringName> Performance::get_custom_monitor_names() {
+#ifdef LOCK_PROFILING_ENABLED
+	_update_lock_monitors();
+#endif // LOCK_PROFILING_ENABLED
+
 	if (!_monitor_map.size()) {
 		return TypedArray<StringName>();
 	}
@@ -565,6 +570,38 @@ uint64_t Performance::get_monitor_modification_time() {
 	return _monitor_modification_time;
 }
 
+#ifdef LOCK_PROFILING_ENABLED
+void Performance::_update_lock_monitors() {
+	uint32_t count = LockProfiler::get_profile_count();
+	if (_lock_monitor_count == count) {
+		return;
+	}
+
+	Callable callable = callable_mp(this, &Performance::_get_lock_monitor);
+	for (; _lock_monitor_count < count; _lock_monitor_count++) {
+		String prefix = "Locks/" + String(LockProfiler::get_stats(_lock_monitor_count).name);
+		int index = _lock_monitor_count;
+		_monitor_map.insert(prefix + " Acquisitions", MonitorCall(callable, { index, LOCK_MONITOR_ACQUISITIONS }));
+		_monitor_map.insert(prefix + " Contended", MonitorCall(callable, { index, LOCK_MONITOR_CONTENDED }));
+		_monitor_map.insert(prefix + " Wait (ms)", MonitorCall(callable, { index, LOCK_MONITOR_WAIT_TIME }));
+	}
+	_monitor_modification_time = OS::get_singleton()->get_ticks_usec();
+}
+
+double Performance::_get_lock_monitor(int p_index, int p_monitor) const {
+	LockProfile::Stats stats = LockProfiler::get_stats(p_index);
+	switch (p_monitor) {
+		case LOCK_MONITOR_ACQUISITIONS:
+			return stats.acquisitions;
+		case LOCK_MONITOR_CONTENDED:
+			return stats.contended;
+		case LOCK_MONITOR_WAIT_TIME:
+			return stats.wait_usec / 1000.0;
+	}
+	return 0;
+}
+#endif // LOCK_PROFILING_ENABLED
+
 Performance::Performance() {
 	_process_time = 0;
 	_physics_process_time = 0;
@@ -64,6 +64,20 @@ class Performance : public Object {
 	HashMap<StringName, MonitorCall> _monitor_map;
 	uint64_t _monitor_modification_time;
 
+#ifdef LOCK_PROFILING_ENABLED
+	enum LockMonitor {
+		LOCK_MONITOR_ACQUISITIONS,
+		LOCK_MONITOR_CONTENDED,
+		LOCK_MONITOR_WAIT_TIME,
+	};
+
+	uint32_t _lock_monitor_count = 0;
+
+	// Named locks are created at any time, their monitors are added as they show up.
+	void _update_lock_monitors();
+	double _get_lock_monitor(int p_index, int p_monitor) const;
+#endif // LOCK_PROFILING_ENABLED
+
 public:
 	enum Monitor {
 		TIME_FPS,
@@ -31,6 +31,7 @@
 #include "gdscript.h"
 
 #include "gdscript_analyzer.h"
+#include "gdscript_bytecode_cache.h"
 #include "gdscript_cache.h"
 #include "gdscript_compiler.h"
 #include "gdscript_parser.h"
@@ -812,12 +813,34 @@ Error GDScript::reload(bool p_keep_state) {
 #endif
 
 	valid = false;
-	GDScriptParser parser;
-	Error err;
-	if (!binary_tokens.is_empty()) {
-		err = parser.parse_binary(binary_tokens, path);
-	} else {
-		err = parser.parse(source, path, false);
+
+	if (!precompiled_bytecode.is_empty()) {
+		// Later reloads always go through the parser.
+		const Vector<uint8_t> bytecode = precompiled_bytecode;
+		precompiled_bytecode.clear();
+
+		if (GDScriptBytecodeCache::load(this, bytecode) == OK) {
+			Error err = OK;
+			if (ScriptServer::is_scripting_enabled() || is_tool()) {
+				err = _static_init();
+			}
+			reloading = false;
+			return err;
+		}
+		print_verbose(vformat(R"(GDScript: Precompiled bytecode for "%s" can't be used, compiling from source instead.)", path));
+	}
+
+	// Use the parse done by `GDScriptCache::parse_scripts()` if there is one for this exact source.
+	GDScriptParser own_parser;
+	Ref<GDScriptParserRef> parsed = GDScriptCache::take_parsed_script(path, GDScriptBytecodeCache::get_source_hash(source, binary_tokens));
+	GDScriptParser &parser = parsed.is_valid() ? *parsed->get_parser() : own_parser;
+	Error err = OK;
+	if (parsed.is_null()) {
+		if (!binary_tokens.is_empty()) {
+			err = parser.parse_binary(binary_tokens, path);
+		} else {
+			err = parser.parse(source, path, false);
+		}
 	}
 	if (err) {
 		if (EngineDebugger::is_active()) {
@@ -1149,6 +1172,14 @@ Vector<uint8_t> GDScript::get_as_binary_tokens() const {
 	return tokenizer.parse_code_string(source, GDScriptTokenizerBuffer::COMPRESS_NONE);
 }
 
+void GDScript::set_precompiled_bytecode_source(const Vector<uint8_t> &p_bytecode) {
+	precompiled_bytecode = p_bytecode;
+}
+
+const Vector<uint8_t> &GDScript::get_precompiled_bytecode_source() const {
+	return precompiled_bytecode;
+}
+
 const HashMap<StringName, GDScriptFunction *> &GDScript::debug_get_member_functions() const {
 	return member_functions;
 }
@@ -1661,6 +1692,9 @@ GDScript::~GDScript() {
 
 	cancel_pending_functions(false);
 
+	// Another script may be allocated at the same address.
+	GDScriptFunction::invalidate_inline_caches();
+
 	{
 		MutexLock lock(GDScriptLanguage::get_singleton()->mutex);
 
@@ -2640,6 +2674,14 @@ void GDScriptLanguage::reload_scripts(const Array &p_scripts, bool p_soft_reload
 		}
 	}
 
+	Vector<String> paths_to_reload;
+	for (const KeyValue<Ref<GDScript>, HashMap<ObjectID, List<Pair<StringName, Variant>>>> &E : to_reload) {
+		if (!E.key->is_built_in()) {
+			paths_to_reload.push_back(E.key->get_path());
+		}
+	}
+	GDScriptCache::parse_scripts(paths_to_reload, true);
+
 	for (KeyValue<Ref<GDScript>, HashMap<ObjectID, List<Pair<StringName, Variant>>>> &E : to_reload) {
 		Ref<GDScript> scr = E.key;
 		print_verbose("GDScript: Reloading: " + scr->get_path());
@@ -2700,6 +2742,8 @@ void GDScriptLanguage::reload_scripts(const Array &p_scripts, bool p_soft_reload
 		//if instance states were saved, set them!
 	}
 
+	GDScriptCache::discard_parsed_scripts(paths_to_reload);
+
 #endif // DEBUG_ENABLED
 }
 
@@ -2708,6 +2752,14 @@ void GDScriptLanguage::reload_tool_script(const Ref<Script> &p_script, bool p_so
 	reload_scripts(scripts, p_soft_reload);
 }
 
+void GDScriptLanguage::begin_batch_load(const Vector<String> &p_paths) {
+	GDScriptCache::parse_scripts(p_paths);
+}
+
+void GDScriptLanguage::end_batch_load(const Vector<String> &p_paths) {
+	GDScriptCache::discard_parsed_scripts(p_paths);
+}
+
 void GDScriptLanguage::frame() {
 #ifdef DEBUG_ENABLED
 	if (profiling) {
@@ -2926,6 +2978,20 @@ String GDScriptLanguage::get_global_class_name(const String &p_path, String *r_b
 }
 
 thread_local GDScriptLanguage::CallStack GDScriptLanguage::_call_stack;
+Mutex GDScriptLanguage::call_stacks_mutex;
+bool GDScriptLanguage::sampling = false;
+LocalVector<GDScriptLanguage::CallStack *> GDScriptLanguage::call_stacks;
+
+void GDScriptLanguage::_register_call_stack(CallStack *p_call_stack) {
+	MutexLock lock(call_stacks_mutex);
+	p_call_stack->thread_id = Thread::get_caller_id();
+	call_stacks.push_back(p_call_stack);
+}
+
+void GDScriptLanguage::_unregister_call_stack(CallStack *p_call_stack) {
+	MutexLock lock(call_stacks_mutex);
+	call_stacks.erase(p_call_stack);
+}
 
 GDScriptLanguage::GDScriptLanguage() {
 	ERR_FAIL_COND(singleton);
@@ -38,6 +38,7 @@
 #include "core/io/resource_loader.h"
 #include "core/io/resource_saver.h"
 #include "core/object/script_language.h"
+#include "core/templates/local_vector.h"
 #include "core/templates/rb_set.h"
 
 class GDScriptNativeClass : public RefCounted {
@@ -83,6 +84,7 @@ class GDScript : public Script {
 	friend class GDScriptInstance;
 	friend class GDScriptFunction;
 	friend class GDScriptAnalyzer;
+	friend class GDScriptBytecodeCache;
 	friend class GDScriptCompiler;
 	friend class GDScriptDocGen;
 	friend class GDScriptLambdaCallable;
@@ -181,6 +183,7 @@ private:
 	//exported members
 	String source;
 	Vector<uint8_t> binary_tokens;
+	Vector<uint8_t> precompiled_bytecode; // Only used for the initial load, see `GDScriptBytecodeCache`.
 	String path;
 	bool path_valid = false; // False if using default path.
 	StringName local_name; // Inner class identifier or `class_name`.
@@ -318,6 +321,8 @@ public:
 	void set_binary_tokens_source(const Vector<uint8_t> &p_binary_tokens);
 	const Vector<uint8_t> &get_binary_tokens_source() const;
 	Vector<uint8_t> get_as_binary_tokens() const;
+	void set_precompiled_bytecode_source(const Vector<uint8_t> &p_bytecode);
+	const Vector<uint8_t> &get_precompiled_bytecode_source() const;
 
 	bool get_property_default_value(const StringName &p_property, Variant &r_value) const override;
 
@@ -436,6 +441,7 @@ class GDScriptLanguage : public ScriptLanguage {
 		GDScriptInstance *instance = nullptr;
 		int *ip = nullptr;
 		int *line = nullptr;
+		const MethodBind *native_call = nullptr;
 	};
 
 	static thread_local int _debug_parse_err_line;
@@ -444,9 +450,11 @@ class GDScriptLanguage : public ScriptLanguage {
 	struct CallStack {
 		CallLevel *levels = nullptr;
 		int stack_pos = 0;
+		Thread::ID thread_id = Thread::UNASSIGNED_ID;
 
 		void free() {
 			if (levels) {
+				_unregister_call_stack(this);
 				memdelete(levels);
 				levels = nullptr;
 			}
@@ -461,6 +469,14 @@ class GDScriptLanguage : public ScriptLanguage {
 	bool track_call_stack = false;
 	bool track_locals = false;
 
+	// Call stacks of all threads that run GDScript, inspected by the sampling profiler.
+	static Mutex call_stacks_mutex;
+	static LocalVector<CallStack *> call_stacks;
+	static bool sampling;
+
+	static void _register_call_stack(CallStack *p_call_stack);
+	static void _unregister_call_stack(CallStack *p_call_stack);
+
 	void _add_global(const StringName &p_name, const Variant &p_value);
 	void _remove_global(const StringName &p_name);
 
@@ -472,6 +488,7 @@ class GDScriptLanguage : public ScriptLanguage {
 
 	SelfList<GDScript>::List script_list;
 	friend class GDScriptFunction;
+	friend class GDScriptSamplingProfiler;
 
 	SelfList<GDScriptFunction>::List function_list;
 #ifdef DEBUG_ENABLED
@@ -498,6 +515,7 @@ public:
 
 		if (unlikely(_call_stack.levels == nullptr)) {
 			_call_stack.levels = memnew_arr(CallLevel, _debug_max_call_stack + 1);
+			_register_call_stack(&_call_stack);
 		}
 
 #ifdef DEBUG_ENABLED
@@ -525,9 +543,20 @@ public:
 		call_level.function = p_function;
 		call_level.ip = p_ip;
 		call_level.line = p_line;
+		call_level.native_call = nullptr;
 		_call_stack.stack_pos++;
 	}
 
+	// Whether a sampling profiler is running. The VM only records engine calls while it is.
+	_FORCE_INLINE_ static bool is_sampling() { return sampling; }
+
+	// Records the engine method called by the innermost function, so samples can be attributed to it.
+	_FORCE_INLINE_ void set_native_call(const MethodBind *p_method) {
+		if (_call_stack.stack_pos > 0) {
+			_call_stack.levels[_call_stack.stack_pos - 1].native_call = p_method;
+		}
+	}
+
 	_FORCE_INLINE_ void exit_function() {
 		if (!track_call_stack) {
 			return;
@@ -646,6 +675,8 @@ public:
 	virtual void reload_all_scripts() override;
 	virtual void reload_scripts(const Array &p_scripts, bool p_soft_reload) override;
 	virtual void reload_tool_script(const Ref<Script> &p_script, bool p_soft_reload) override;
+	virtual void begin_batch_load(const Vector<String> &p_paths) override;
+	virtual void end_batch_load(const Vector<String> &p_paths) override;
 
 	virtual void frame() override;
 
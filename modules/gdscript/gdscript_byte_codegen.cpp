@@ -152,6 +152,7 @@ void GDScriptByteCodeGenerator::start_parameters() {
 	if (function->_default_arg_count > 0) {
 		append(GDScriptFunction::OPCODE_JUMP_TO_DEF_ARGUMENT);
 		function->default_arguments.push_back(opcodes.size());
+		mark_jump_target(opcodes.size());
 	}
 }
 
@@ -161,7 +162,7 @@ void GDScriptByteCodeGenerator::end_parameters() {
 
 void GDScriptByteCodeGenerator::write_start(GDScript *p_script, const StringName &p_function_name, bool p_static, Variant p_rpc_config, const GDScriptDataType &p_return_type) {
 	function = memnew(GDScriptFunction);
-	debug_stack = GDScriptLanguage::get_singleton()->should_track_locals();
+	debug_stack = debug_stack || GDScriptLanguage::get_singleton()->should_track_locals();
 
 	function->name = p_function_name;
 	function->_script = p_script;
@@ -395,6 +396,14 @@ GDScriptFunction *GDScriptByteCodeGenerator::write_end() {
 		function->_lambdas_count = 0;
 	}
 
+	if (inline_cache_count) {
+		function->_inline_cache_count = inline_cache_count;
+		function->_inline_caches_ptr = memnew_arr(GDScriptFunction::InlineCache, inline_cache_count);
+	} else {
+		function->_inline_cache_count = 0;
+		function->_inline_caches_ptr = nullptr;
+	}
+
 	if (debug_stack) {
 		function->stack_debug = stack_debug;
 	}
@@ -584,6 +593,44 @@ void GDScriptByteCodeGenerator::write_unary_operator(const Address &p_target, Va
 	}
 }
 
+GDScriptFunction::Opcode GDScriptByteCodeGenerator::get_typed_operator_opcode(Variant::Operator p_operator, Variant::Type p_left_type, Variant::Type p_right_type) {
+	switch (p_operator) {
+		case Variant::OP_EQUAL:
+		case Variant::OP_NOT_EQUAL:
+		case Variant::OP_LESS:
+		case Variant::OP_LESS_EQUAL:
+		case Variant::OP_GREATER:
+		case Variant::OP_GREATER_EQUAL:
+		case Variant::OP_ADD:
+		case Variant::OP_SUBTRACT:
+		case Variant::OP_MULTIPLY:
+			break;
+		case Variant::OP_BIT_AND:
+		case Variant::OP_BIT_OR:
+		case Variant::OP_BIT_XOR:
+			if (p_left_type == Variant::INT && p_right_type == Variant::INT) {
+				return GDScriptFunction::OPCODE_OPERATOR_INT;
+			}
+			return GDScriptFunction::OPCODE_OPERATOR_VALIDATED;
+		case Variant::OP_DIVIDE:
+			// Integer division needs the zero check of the evaluator.
+			if ((p_left_type == Variant::FLOAT && p_right_type == Variant::INT) || (p_left_type == Variant::INT && p_right_type == Variant::FLOAT) || (p_left_type == Variant::FLOAT && p_right_type == Variant::FLOAT)) {
+				return GDScriptFunction::OPCODE_OPERATOR_FLOAT;
+			}
+			return GDScriptFunction::OPCODE_OPERATOR_VALIDATED;
+		default:
+			return GDScriptFunction::OPCODE_OPERATOR_VALIDATED;
+	}
+
+	if (p_left_type == Variant::INT && p_right_type == Variant::INT) {
+		return GDScriptFunction::OPCODE_OPERATOR_INT;
+	}
+	if ((p_left_type == Variant::FLOAT || p_left_type == Variant::INT) && (p_right_type == Variant::FLOAT || p_right_type == Variant::INT)) {
+		return GDScriptFunction::OPCODE_OPERATOR_FLOAT;
+	}
+	return GDScriptFunction::OPCODE_OPERATOR_VALIDATED;
+}
+
 void GDScriptByteCodeGenerator::write_binary_operator(const Address &p_target, Variant::Operator p_operator, const Address &p_left_operand, const Address &p_right_operand) {
 	bool valid = HAS_BUILTIN_TYPE(p_left_operand) && HAS_BUILTIN_TYPE(p_right_operand);
 
@@ -612,10 +659,31 @@ void GDScriptByteCodeGenerator::write_binary_operator(const Address &p_target, V
 			}
 		}
 
+		bool fuse_get_named = can_fuse(last_get_named_pos, 4);
+
+		// Int and float operators work directly on the stack slot payloads.
+		GDScriptFunction::Opcode typed_opcode = fuse_get_named ? GDScriptFunction::OPCODE_OPERATOR_VALIDATED : get_typed_operator_opcode(p_operator, p_left_operand.type.builtin_type, p_right_operand.type.builtin_type);
+		if (typed_opcode != GDScriptFunction::OPCODE_OPERATOR_VALIDATED) {
+			append_opcode(typed_opcode);
+			set_last_operator(typed_opcode, p_operator, p_left_operand, p_right_operand, p_target);
+			append(p_left_operand);
+			append(p_right_operand);
+			append(p_target);
+			append(p_operator);
+			return;
+		}
+
 		// Gather specific operator.
 		Variant::ValidatedOperatorEvaluator op_func = Variant::get_validated_operator_evaluator(p_operator, p_left_operand.type.builtin_type, p_right_operand.type.builtin_type);
 
-		append_opcode(GDScriptFunction::OPCODE_OPERATOR_VALIDATED);
+		if (fuse_get_named) {
+			// Load member and operate: the getter is followed directly by the operator.
+			opcodes.write[last_get_named_pos] = GDScriptFunction::OPCODE_GET_NAMED_VALIDATED_OPERATOR_VALIDATED;
+			last_get_named_pos = -1;
+		} else {
+			append_opcode(GDScriptFunction::OPCODE_OPERATOR_VALIDATED);
+			set_last_operator(GDScriptFunction::OPCODE_OPERATOR_VALIDATED, p_operator, p_left_operand, p_right_operand, p_target);
+		}
 		append(p_left_operand);
 		append(p_right_operand);
 		append(p_target);
@@ -692,16 +760,38 @@ void GDScriptByteCodeGenerator::write_type_test(const Address &p_target, const A
 	}
 }
 
+void GDScriptByteCodeGenerator::append_conditional_jump(GDScriptFunction::Opcode p_jump, const Address &p_condition) {
+	// Compare and branch: jump directly on the result of a typed comparison.
+	// The jump target is appended by the caller in both cases.
+	if (can_fuse(last_operator_pos, 5) && is_same_address(last_operator_target, p_condition) && Variant::get_operator_return_type(last_operator, last_operator_left_type, last_operator_right_type) == Variant::BOOL) {
+		bool jump_if = p_jump == GDScriptFunction::OPCODE_JUMP_IF;
+		switch (last_operator_opcode) {
+			case GDScriptFunction::OPCODE_OPERATOR_INT:
+				opcodes.write[last_operator_pos] = jump_if ? GDScriptFunction::OPCODE_OPERATOR_INT_JUMP_IF : GDScriptFunction::OPCODE_OPERATOR_INT_JUMP_IF_NOT;
+				break;
+			case GDScriptFunction::OPCODE_OPERATOR_FLOAT:
+				opcodes.write[last_operator_pos] = jump_if ? GDScriptFunction::OPCODE_OPERATOR_FLOAT_JUMP_IF : GDScriptFunction::OPCODE_OPERATOR_FLOAT_JUMP_IF_NOT;
+				break;
+			default:
+				opcodes.write[last_operator_pos] = jump_if ? GDScriptFunction::OPCODE_OPERATOR_VALIDATED_JUMP_IF : GDScriptFunction::OPCODE_OPERATOR_VALIDATED_JUMP_IF_NOT;
+				break;
+		}
+		last_operator_pos = -1;
+		return;
+	}
+
+	append_opcode(p_jump);
+	append(p_condition);
+}
+
 void GDScriptByteCodeGenerator::write_and_left_operand(const Address &p_left_operand) {
-	append_opcode(GDScriptFunction::OPCODE_JUMP_IF_NOT);
-	append(p_left_operand);
+	append_conditional_jump(GDScriptFunction::OPCODE_JUMP_IF_NOT, p_left_operand);
 	logic_op_jump_pos1.push_back(opcodes.size());
 	append(0); // Jump target, will be patched.
 }
 
 void GDScriptByteCodeGenerator::write_and_right_operand(const Address &p_right_operand) {
-	append_opcode(GDScriptFunction::OPCODE_JUMP_IF_NOT);
-	append(p_right_operand);
+	append_conditional_jump(GDScriptFunction::OPCODE_JUMP_IF_NOT, p_right_operand);
 	logic_op_jump_pos2.push_back(opcodes.size());
 	append(0); // Jump target, will be patched.
 }
@@ -713,6 +803,7 @@ void GDScriptByteCodeGenerator::write_end_and(const Address &p_target) {
 	// Jump away from the fail condition.
 	append_opcode(GDScriptFunction::OPCODE_JUMP);
 	append(opcodes.size() + 3);
+	mark_jump_target(opcodes.size() + 2);
 	// Here it means one of operands is false.
 	patch_jump(logic_op_jump_pos1.back()->get());
 	patch_jump(logic_op_jump_pos2.back()->get());
@@ -723,15 +814,13 @@ void GDScriptByteCodeGenerator::write_end_and(const Address &p_target) {
 }
 
 void GDScriptByteCodeGenerator::write_or_left_operand(const Address &p_left_operand) {
-	append_opcode(GDScriptFunction::OPCODE_JUMP_IF);
-	append(p_left_operand);
+	append_conditional_jump(GDScriptFunction::OPCODE_JUMP_IF, p_left_operand);
 	logic_op_jump_pos1.push_back(opcodes.size());
 	append(0); // Jump target, will be patched.
 }
 
 void GDScriptByteCodeGenerator::write_or_right_operand(const Address &p_right_operand) {
-	append_opcode(GDScriptFunction::OPCODE_JUMP_IF);
-	append(p_right_operand);
+	append_conditional_jump(GDScriptFunction::OPCODE_JUMP_IF, p_right_operand);
 	logic_op_jump_pos2.push_back(opcodes.size());
 	append(0); // Jump target, will be patched.
 }
@@ -743,6 +832,7 @@ void GDScriptByteCodeGenerator::write_end_or(const Address &p_target) {
 	// Jump away from the success condition.
 	append_opcode(GDScriptFunction::OPCODE_JUMP);
 	append(opcodes.size() + 3);
+	mark_jump_target(opcodes.size() + 2);
 	// Here it means one of operands is true.
 	patch_jump(logic_op_jump_pos1.back()->get());
 	patch_jump(logic_op_jump_pos2.back()->get());
@@ -757,8 +847,7 @@ void GDScriptByteCodeGenerator::write_start_ternary(const Address &p_target) {
 }
 
 void GDScriptByteCodeGenerator::write_ternary_condition(const Address &p_condition) {
-	append_opcode(GDScriptFunction::OPCODE_JUMP_IF_NOT);
-	append(p_condition);
+	append_conditional_jump(GDScriptFunction::OPCODE_JUMP_IF_NOT, p_condition);
 	ternary_jump_fail_pos.push_back(opcodes.size());
 	append(0); // Jump target, will be patched.
 }
@@ -867,6 +956,7 @@ void GDScriptByteCodeGenerator::write_get_named(const Address &p_target, const S
 	if (HAS_BUILTIN_TYPE(p_source) && Variant::get_member_validated_getter(p_source.type.builtin_type, p_name)) {
 		Variant::ValidatedGetter getter = Variant::get_member_validated_getter(p_source.type.builtin_type, p_name);
 		append_opcode(GDScriptFunction::OPCODE_GET_NAMED_VALIDATED);
+		last_get_named_pos = last_opcode_pos;
 		append(p_source);
 		append(p_target);
 		append(getter);
@@ -879,6 +969,7 @@ void GDScriptByteCodeGenerator::write_get_named(const Address &p_target, const S
 	append(p_source);
 	append(p_target);
 	append(p_name);
+	append(inline_cache_count++);
 }
 
 void GDScriptByteCodeGenerator::write_set_member(const Address &p_value, const StringName &p_name) {
@@ -994,6 +1085,11 @@ void GDScriptByteCodeGenerator::write_assign(const Address &p_target, const Addr
 		append(p_target);
 		append(p_source);
 		append(p_target.type.builtin_type);
+	} else if (HAS_BUILTIN_TYPE(p_target) && p_target.type.builtin_type == Variant::INT && can_fuse(last_operator_pos, 5) && is_same_address(last_operator_target, p_source) && (last_operator == Variant::OP_ADD || last_operator == Variant::OP_SUBTRACT) && last_operator_left_type == Variant::INT && last_operator_right_type == Variant::INT) {
+		// Increment typed int: `i += n` stores the result without a separate assign.
+		opcodes.write[last_operator_pos] = last_operator == Variant::OP_ADD ? GDScriptFunction::OPCODE_ADD_INT_ASSIGN : GDScriptFunction::OPCODE_SUBTRACT_INT_ASSIGN;
+		last_operator_pos = -1;
+		append(p_target);
 	} else {
 		append_opcode(GDScriptFunction::OPCODE_ASSIGN);
 		append(p_target);
@@ -1023,11 +1119,13 @@ void GDScriptByteCodeGenerator::write_assign_default_parameter(const Address &p_
 		write_assign(p_dst, p_src);
 	}
 	function->default_arguments.push_back(opcodes.size());
+	mark_jump_target(opcodes.size());
 }
 
 void GDScriptByteCodeGenerator::write_store_global(const Address &p_dst, int p_global_index) {
 	append_opcode(GDScriptFunction::OPCODE_STORE_GLOBAL);
 	append(p_dst);
+	function->global_index_positions.push_back(opcodes.size());
 	append(p_global_index);
 }
 
@@ -1093,6 +1191,7 @@ void GDScriptByteCodeGenerator::write_call(const Address &p_target, const Addres
 	append(ct.target);
 	append(p_arguments.size());
 	append(p_function_name);
+	append(inline_cache_count++);
 	ct.cleanup();
 }
 
@@ -1118,6 +1217,7 @@ void GDScriptByteCodeGenerator::write_call_async(const Address &p_target, const
 	append(ct.target);
 	append(p_arguments.size());
 	append(p_function_name);
+	append(inline_cache_count++);
 	ct.cleanup();
 }
 
@@ -1352,6 +1452,7 @@ void GDScriptByteCodeGenerator::write_call_self(const Address &p_target, const S
 	append(ct.target);
 	append(p_arguments.size());
 	append(p_function_name);
+	append(inline_cache_count++);
 	ct.cleanup();
 }
 
@@ -1365,6 +1466,7 @@ void GDScriptByteCodeGenerator::write_call_self_async(const Address &p_target, c
 	append(ct.target);
 	append(p_arguments.size());
 	append(p_function_name);
+	append(inline_cache_count++);
 	ct.cleanup();
 }
 
@@ -1378,6 +1480,7 @@ void GDScriptByteCodeGenerator::write_call_script_function(const Address &p_targ
 	append(ct.target);
 	append(p_arguments.size());
 	append(p_function_name);
+	append(inline_cache_count++);
 	ct.cleanup();
 }
 
@@ -1512,8 +1615,7 @@ void GDScriptByteCodeGenerator::write_await(const Address &p_target, const Addre
 }
 
 void GDScriptByteCodeGenerator::write_if(const Address &p_condition) {
-	append_opcode(GDScriptFunction::OPCODE_JUMP_IF_NOT);
-	append(p_condition);
+	append_conditional_jump(GDScriptFunction::OPCODE_JUMP_IF_NOT, p_condition);
 	if_jmp_addrs.push_back(opcodes.size());
 	append(0); // Jump destination, will be patched.
 }
@@ -1674,10 +1776,12 @@ void GDScriptByteCodeGenerator::write_for(const Address &p_variable, bool p_use_
 	append(0); // End of loop address, will be patched.
 	append_opcode(GDScriptFunction::OPCODE_JUMP);
 	append(opcodes.size() + 6); // Skip over 'continue' code.
+	mark_jump_target(opcodes.size() + 5);
 
 	// Next iteration.
 	int continue_addr = opcodes.size();
 	continue_addrs.push_back(continue_addr);
+	mark_jump_target(continue_addr);
 	append_opcode(iterate_opcode);
 	append(counter);
 	append(container);
@@ -1719,12 +1823,12 @@ void GDScriptByteCodeGenerator::write_endfor() {
 void GDScriptByteCodeGenerator::start_while_condition() {
 	current_breaks_to_patch.push_back(List<int>());
 	continue_addrs.push_back(opcodes.size());
+	mark_jump_target(opcodes.size());
 }
 
 void GDScriptByteCodeGenerator::write_while(const Address &p_condition) {
 	// Condition check.
-	append_opcode(GDScriptFunction::OPCODE_JUMP_IF_NOT);
-	append(p_condition);
+	append_conditional_jump(GDScriptFunction::OPCODE_JUMP_IF_NOT, p_condition);
 	while_jmp_addrs.push_back(opcodes.size());
 	append(0); // End of loop address, will be patched.
 }
@@ -97,6 +97,19 @@ class GDScriptByteCodeGenerator : public GDScriptCodeGenerator {
 	int max_locals = 0;
 	int current_line = 0;
 	int instr_args_max = 0;
+	int inline_cache_count = 0;
+
+	// Superinstruction fusion. The last emitted instruction may be rewritten into a
+	// combined one as long as no jump lands right after it.
+	int last_opcode_pos = -1;
+	int fusion_barrier = 0;
+	int last_operator_pos = -1;
+	GDScriptFunction::Opcode last_operator_opcode = GDScriptFunction::OPCODE_OPERATOR_VALIDATED;
+	Variant::Operator last_operator = Variant::OP_MAX;
+	Variant::Type last_operator_left_type = Variant::NIL;
+	Variant::Type last_operator_right_type = Variant::NIL;
+	Address last_operator_target;
+	int last_get_named_pos = -1;
 
 #ifdef DEBUG_ENABLED
 	List<int> temp_stack;
@@ -373,10 +386,12 @@ class GDScriptByteCodeGenerator : public GDScriptCodeGenerator {
 	}
 
 	void append_opcode(GDScriptFunction::Opcode p_code) {
+		last_opcode_pos = opcodes.size();
 		opcodes.push_back(p_code);
 	}
 
 	void append_opcode_and_argcount(GDScriptFunction::Opcode p_code, int p_argument_count) {
+		last_opcode_pos = opcodes.size();
 		opcodes.push_back(p_code);
 		opcodes.push_back(p_argument_count);
 		instr_args_max = MAX(instr_args_max, p_argument_count);
@@ -448,9 +463,37 @@ class GDScriptByteCodeGenerator : public GDScriptCodeGenerator {
 
 	void patch_jump(int p_address) {
 		opcodes.write[p_address] = opcodes.size();
+		mark_jump_target(opcodes.size());
 	}
 
+	void mark_jump_target(int p_address) {
+		fusion_barrier = MAX(fusion_barrier, p_address);
+	}
+
+	// Whether the instruction of `p_size` words at `p_pos` is the last one emitted and can be fused with the next.
+	bool can_fuse(int p_pos, int p_size) const {
+		return p_pos >= 0 && p_pos == last_opcode_pos && p_pos + p_size == opcodes.size() && fusion_barrier <= p_pos;
+	}
+
+	static bool is_same_address(const Address &p_a, const Address &p_b) {
+		return p_a.mode == p_b.mode && p_a.address == p_b.address;
+	}
+
+	void set_last_operator(GDScriptFunction::Opcode p_opcode, Variant::Operator p_operator, const Address &p_left_operand, const Address &p_right_operand, const Address &p_target) {
+		last_operator_pos = last_opcode_pos;
+		last_operator_opcode = p_opcode;
+		last_operator = p_operator;
+		last_operator_left_type = p_left_operand.type.builtin_type;
+		last_operator_right_type = p_right_operand.type.builtin_type;
+		last_operator_target = p_target;
+	}
+
+	static GDScriptFunction::Opcode get_typed_operator_opcode(Variant::Operator p_operator, Variant::Type p_left_type, Variant::Type p_right_type);
+	void append_conditional_jump(GDScriptFunction::Opcode p_jump, const Address &p_condition);
+
 public:
+	void set_track_locals(bool p_enabled) { debug_stack = p_enabled; }
+
 	virtual uint32_t add_parameter(const StringName &p_name, bool p_is_optional, const GDScriptDataType &p_type) override;
 	virtual uint32_t add_local(const StringName &p_name, const GDScriptDataType &p_type) override;
 	virtual uint32_t add_local_constant(const StringName &p_name, const Variant &p_constant) override;
@@ -0,0 +1,1804 @@
+/**************************************************************************/
+/*  gdscript_bytecode_cache.cpp                                           */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GODOT ENGINE                               */
+/*                        https://godotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#include "gdscript_bytecode_cache.h"
+
+#include "gdscript_cache.h"
+
+#ifdef TOOLS_ENABLED
+#include "gdscript_analyzer.h"
+#include "gdscript_compiler.h"
+#include "gdscript_parser.h"
+#endif
+
+#include "core/io/compression.h"
+#include "core/io/marshalls.h"
+#include "core/version.h"
+
+#define BYTECODE_VERSION 1
+#define BYTECODE_HEADER_SIZE 24
+#define BYTECODE_NONE 0xFFFFFFFF
+
+enum BytecodeScriptRef {
+	BYTECODE_SCRIPT_NONE,
+	BYTECODE_SCRIPT_LOCAL, // Class of the same file, by index.
+	BYTECODE_SCRIPT_EXTERNAL, // GDScript class of another file, by path and inner class names.
+	BYTECODE_SCRIPT_RESOURCE, // Any other script, by path.
+};
+
+enum BytecodeVariant {
+	BYTECODE_VARIANT_PLAIN,
+	BYTECODE_VARIANT_ARRAY,
+	BYTECODE_VARIANT_DICTIONARY,
+	BYTECODE_VARIANT_NULL_OBJECT,
+	BYTECODE_VARIANT_SCRIPT,
+	BYTECODE_VARIANT_GLOBAL,
+	BYTECODE_VARIANT_RESOURCE,
+};
+
+enum BytecodeContainerFlags {
+	BYTECODE_CONTAINER_TYPED = 1 << 0,
+	BYTECODE_CONTAINER_READ_ONLY = 1 << 1,
+};
+
+uint32_t GDScriptBytecodeCache::get_engine_hash() {
+	// Bytecode refers to opcodes, operators and types by value, so any other build may disagree on them.
+	uint32_t hash = hash_murmur3_one_32(BYTECODE_VERSION);
+	hash = hash_murmur3_one_32(String(GODOT_VERSION_FULL_BUILD).hash(), hash);
+	hash = hash_murmur3_one_32(String(GODOT_VERSION_HASH).hash(), hash);
+	hash = hash_murmur3_one_32(GDScriptFunction::OPCODE_END, hash);
+	hash = hash_murmur3_one_32(Variant::VARIANT_MAX, hash);
+	hash = hash_murmur3_one_32(Variant::OP_MAX, hash);
+	return hash_fmix32(hash);
+}
+
+uint32_t GDScriptBytecodeCache::get_source_hash(const String &p_source, const Vector<uint8_t> &p_binary_tokens) {
+	// Same as the parser cache check in `GDScript::reload()`.
+	if (!p_binary_tokens.is_empty()) {
+		return hash_djb2_buffer(p_binary_tokens.ptr(), p_binary_tokens.size());
+	}
+	return p_source.hash();
+}
+
+/////////////////////////////////////////////////////////////////////////////
+
+class GDScriptBytecodeCache::Reader {
+	struct LambdaData {
+		int function = 0;
+		GDScript::LambdaInfo info;
+	};
+
+	struct ClassData {
+		bool tool = false;
+		Ref<GDScriptNativeClass> native;
+		Ref<GDScript> base;
+		int local_base = -1;
+		Vector<Pair<StringName, GDScript::MemberInfo>> members;
+		Vector<Pair<StringName, GDScript::MemberInfo>> static_members;
+		Vector<Pair<StringName, Variant>> constants;
+		Vector<MethodInfo> signals;
+		Dictionary rpc_config;
+		Vector<GDScriptFunction *> functions;
+		Vector<Vector<uint32_t>> function_lambdas;
+		Vector<Pair<StringName, int>> member_functions;
+		int initializer = -1;
+		int implicit_initializer = -1;
+		int implicit_ready = -1;
+		int static_initializer = -1;
+		Vector<LambdaData> lambda_info;
+	};
+
+	Vector<uint8_t> contents;
+	const uint8_t *data = nullptr;
+	uint32_t size = 0;
+	uint32_t position = 0;
+	uint32_t flags = 0;
+
+	GDScript *root = nullptr;
+	Vector<GDScript *> classes;
+	Vector<ClassData> class_data;
+
+	bool failed = false;
+	String error;
+
+	void _fail(const String &p_error) {
+		if (!failed) {
+			failed = true;
+			error = p_error;
+		}
+	}
+
+	uint32_t _get_32() {
+		if (failed || size - position < 4) {
+			_fail("Unexpected end of data.");
+			return 0;
+		}
+		uint32_t value = decode_uint32(&data[position]);
+		position += 4;
+		return value;
+	}
+
+	// Element counts are validated against the remaining data, every element takes at least 4 bytes.
+	uint32_t _get_count() {
+		uint32_t count = _get_32();
+		if (count > (size - position) / 4) {
+			_fail("Invalid element count.");
+			return 0;
+		}
+		return count;
+	}
+
+	int _get_index(int p_size) {
+		uint32_t index = _get_32();
+		if (index == BYTECODE_NONE) {
+			return -1;
+		}
+		if (index >= (uint32_t)p_size) {
+			_fail("Invalid index.");
+			return -1;
+		}
+		return index;
+	}
+
+	String _get_string() {
+		uint32_t length = _get_32();
+		if (failed || length > size - position) {
+			_fail("Unexpected end of data.");
+			return String();
+		}
+		String string;
+		if (string.append_utf8((const char *)&data[position], length) != OK) {
+			_fail("Invalid string.");
+		}
+		position += length;
+		return string;
+	}
+
+	StringName _get_string_name() {
+		String string = _get_string();
+		return string.is_empty() ? StringName() : StringName(string);
+	}
+
+	Ref<GDScript> _get_external_class(bool p_full) {
+		String path = _get_string();
+		uint32_t name_count = _get_count();
+		if (failed) {
+			return Ref<GDScript>();
+		}
+
+		Error err = OK;
+		Ref<GDScript> script = p_full ? GDScriptCache::get_full_script(path, err, root->path) : GDScriptCache::get_shallow_script(path, err, root->path);
+		if (err != OK || script.is_null()) {
+			_fail(vformat(R"(Could not load script "%s".)", path));
+			return Ref<GDScript>();
+		}
+
+		GDScript *result = script.ptr();
+		for (uint32_t i = 0; i < name_count; i++) {
+			StringName name = _get_string_name();
+			const Ref<GDScript> *subclass = result->subclasses.getptr(name);
+			if (failed || subclass == nullptr) {
+				_fail(vformat(R"(Could not find inner class "%s" in "%s".)", name, path));
+				return Ref<GDScript>();
+			}
+			result = subclass->ptr();
+		}
+		return Ref<GDScript>(result);
+	}
+
+	Ref<Script> _get_script(bool &r_local) {
+		r_local = false;
+		switch (_get_32()) {
+			case BYTECODE_SCRIPT_NONE:
+				return Ref<Script>();
+			case BYTECODE_SCRIPT_LOCAL: {
+				int index = _get_index(classes.size());
+				if (index < 0) {
+					_fail("Invalid local class.");
+					return Ref<Script>();
+				}
+				r_local = true;
+				return Ref<Script>(classes[index]);
+			}
+			case BYTECODE_SCRIPT_EXTERNAL:
+				return _get_external_class(false);
+			case BYTECODE_SCRIPT_RESOURCE: {
+				String path = _get_string();
+				if (failed) {
+					return Ref<Script>();
+				}
+				Ref<Script> script = ResourceLoader::load(path);
+				if (script.is_null()) {
+					_fail(vformat(R"(Could not load script "%s".)", path));
+				}
+				return script;
+			}
+			default:
+				_fail("Invalid script reference.");
+				return Ref<Script>();
+		}
+	}
+
+	Variant _get_variant() {
+		switch (_get_32()) {
+			case BYTECODE_VARIANT_PLAIN: {
+				uint32_t length = _get_32();
+				if (failed || length > size - position) {
+					_fail("Unexpected end of data.");
+					return Variant();
+				}
+				Variant value;
+				if (decode_variant(value, &data[position], length, nullptr, false) != OK) {
+					_fail("Invalid constant.");
+				}
+				position += length;
+				return value;
+			}
+			case BYTECODE_VARIANT_ARRAY: {
+				uint32_t container_flags = _get_32();
+				Array array;
+				if (container_flags & BYTECODE_CONTAINER_TYPED) {
+					uint32_t builtin_type = _get_32();
+					StringName class_name = _get_string_name();
+					bool local = false;
+					Ref<Script> script = _get_script(local);
+					if (failed || builtin_type >= Variant::VARIANT_MAX) {
+						_fail("Invalid typed array.");
+						return Variant();
+					}
+					array.set_typed(builtin_type, class_name, script);
+				}
+				uint32_t count = _get_count();
+				array.resize(count);
+				for (uint32_t i = 0; i < count && !failed; i++) {
+					array[i] = _get_variant();
+				}
+				if (container_flags & BYTECODE_CONTAINER_READ_ONLY) {
+					array.make_read_only();
+				}
+				return array;
+			}
+			case BYTECODE_VARIANT_DICTIONARY: {
+				uint32_t container_flags = _get_32();
+				Dictionary dictionary;
+				if (container_flags & BYTECODE_CONTAINER_TYPED) {
+					uint32_t key_type = _get_32();
+					StringName key_class_name = _get_string_name();
+					bool local = false;
+					Ref<Script> key_script = _get_script(local);
+					uint32_t value_type = _get_32();
+					StringName value_class_name = _get_string_name();
+					Ref<Script> value_script = _get_script(local);
+					if (failed || key_type >= Variant::VARIANT_MAX || value_type >= Variant::VARIANT_MAX) {
+						_fail("Invalid typed dictionary.");
+						return Variant();
+					}
+					dictionary.set_typed(key_type, key_class_name, key_script, value_type, value_class_name, value_script);
+				}
+				uint32_t count = _get_count();
+				for (uint32_t i = 0; i < count && !failed; i++) {
+					Variant key = _get_variant();
+					dictionary[key] = _get_variant();
+				}
+				if (container_flags & BYTECODE_CONTAINER_READ_ONLY) {
+					dictionary.make_read_only();
+				}
+				return dictionary;
+			}
+			case BYTECODE_VARIANT_NULL_OBJECT:
+				return Variant((Object *)nullptr);
+			case BYTECODE_VARIANT_SCRIPT: {
+				bool local = false;
+				return _get_script(local);
+			}
+			case BYTECODE_VARIANT_GLOBAL: {
+				StringName name = _get_string_name();
+				const int *index = GDScriptLanguage::get_singleton()->get_global_map().getptr(name);
+				if (failed || index == nullptr) {
+					_fail(vformat(R"(Unknown global "%s".)", name));
+					return Variant();
+				}
+				return GDScriptLanguage::get_singleton()->get_global_array()[*index];
+			}
+			case BYTECODE_VARIANT_RESOURCE: {
+				String path = _get_string();
+				if (failed) {
+					return Variant();
+				}
+				Ref<Resource> resource = ResourceLoader::load(path);
+				if (resource.is_null()) {
+					_fail(vformat(R"(Could not load resource "%s".)", path));
+				}
+				return resource;
+			}
+			default:
+				_fail("Invalid constant.");
+				return Variant();
+		}
+	}
+
+	GDScriptDataType _get_data_type() {
+		GDScriptDataType type;
+		type.has_type = _get_32();
+		uint32_t kind = _get_32();
+		uint32_t builtin_type = _get_32();
+		type.native_type = _get_string_name();
+		if (kind > GDScriptDataType::GDSCRIPT || builtin_type >= Variant::VARIANT_MAX) {
+			_fail("Invalid data type.");
+			return GDScriptDataType();
+		}
+		type.kind = (GDScriptDataType::Kind)kind;
+		type.builtin_type = (Variant::Type)builtin_type;
+
+		// Like the compiler, don't hold references to classes of the same file to avoid cycles.
+		bool local = false;
+		Ref<Script> script = _get_script(local);
+		type.script_type = script.ptr();
+		if (!local) {
+			type.script_type_ref = script;
+		}
+
+		uint32_t container_count = _get_count();
+		for (uint32_t i = 0; i < container_count && !failed; i++) {
+			type.set_container_element_type(i, _get_data_type());
+		}
+		return type;
+	}
+
+	PropertyInfo _get_property_info() {
+		PropertyInfo info;
+		info.type = (Variant::Type)_get_32();
+		info.name = _get_string();
+		info.class_name = _get_string_name();
+		info.hint = (PropertyHint)_get_32();
+		info.hint_string = _get_string();
+		info.usage = _get_32();
+		if (info.type >= Variant::VARIANT_MAX) {
+			_fail("Invalid property type.");
+		}
+		return info;
+	}
+
+	MethodInfo _get_method_info() {
+		MethodInfo info;
+		info.name = _get_string();
+		info.return_val = _get_property_info();
+		info.flags = _get_32();
+		info.id = _get_32();
+		uint32_t argument_count = _get_count();
+		for (uint32_t i = 0; i < argument_count && !failed; i++) {
+			info.arguments.push_back(_get_property_info());
+		}
+		uint32_t default_count = _get_count();
+		for (uint32_t i = 0; i < default_count && !failed; i++) {
+			info.default_arguments.push_back(_get_variant());
+		}
+		info.return_val_metadata = _get_32();
+		uint32_t metadata_count = _get_count();
+		for (uint32_t i = 0; i < metadata_count && !failed; i++) {
+			info.arguments_metadata.push_back(_get_32());
+		}
+		return info;
+	}
+
+	Variant::Type _get_variant_type() {
+		uint32_t type = _get_32();
+		if (type >= Variant::VARIANT_MAX) {
+			_fail("Invalid type.");
+			return Variant::NIL;
+		}
+		return (Variant::Type)type;
+	}
+
+	template <typename T>
+	void _check_resolved(const Vector<T> &p_table, const char *p_what) {
+		for (const T &E : p_table) {
+			if (E == nullptr) {
+				_fail(vformat("Could not resolve %s.", p_what));
+				return;
+			}
+		}
+	}
+
+	GDScriptFunction *_get_function(GDScript *p_class, Vector<uint32_t> &r_lambdas) {
+		GDScriptFunction *function = memnew(GDScriptFunction);
+		function->_script = p_class;
+		function->source = p_class->get_script_path();
+		function->name = _get_string_name();
+		function->_static = _get_32();
+		function->_initial_line = _get_32();
+		function->_argument_count = _get_32();
+		function->_stack_size = _get_32();
+		function->_instruction_args_size = _get_32();
+
+		uint32_t argument_count = _get_count();
+		for (uint32_t i = 0; i < argument_count && !failed; i++) {
+			function->argument_types.push_back(_get_data_type());
+		}
+		function->return_type = _get_data_type();
+		function->method_info = _get_method_info();
+		function->rpc_config = _get_variant();
+
+		uint32_t temporary_count = _get_count();
+		for (uint32_t i = 0; i < temporary_count && !failed; i++) {
+			int slot = _get_32();
+			function->temporary_slots[slot] = _get_variant_type();
+		}
+
+		uint32_t stack_debug_count = _get_count();
+		for (uint32_t i = 0; i < stack_debug_count && !failed; i++) {
+			GDScriptFunction::StackDebug stack_debug;
+			stack_debug.line = _get_32();
+			stack_debug.pos = _get_32();
+			stack_debug.added = _get_32();
+			stack_debug.identifier = _get_string_name();
+			function->stack_debug.push_back(stack_debug);
+		}
+
+		uint32_t code_size = _get_count();
+		function->code.resize(code_size);
+		for (uint32_t i = 0; i < code_size && !failed; i++) {
+			function->code.write[i] = _get_32();
+		}
+
+		uint32_t default_count = _get_count();
+		for (uint32_t i = 0; i < default_count && !failed; i++) {
+			function->default_arguments.push_back(_get_32());
+		}
+
+		uint32_t constant_count = _get_count();
+		for (uint32_t i = 0; i < constant_count && !failed; i++) {
+			function->constants.push_back(_get_variant());
+		}
+
+		uint32_t global_name_count = _get_count();
+		for (uint32_t i = 0; i < global_name_count && !failed; i++) {
+			function->global_names.push_back(_get_string_name());
+		}
+
+		// Global array indices depend on what the running build registered, look them up again.
+		uint32_t global_index_count = _get_count();
+		for (uint32_t i = 0; i < global_index_count && !failed; i++) {
+			uint32_t code_position = _get_32();
+			StringName global = _get_string_name();
+			const int *index = GDScriptLanguage::get_singleton()->get_global_map().getptr(global);
+			if (failed || index == nullptr || code_position >= code_size) {
+				_fail(vformat(R"(Unknown global "%s".)", global));
+				break;
+			}
+			function->code.write[code_position] = *index;
+			function->global_index_positions.push_back(code_position);
+		}
+
+#ifdef DEBUG_ENABLED
+#define BYTECODE_DEBUG_NAME(m_names, m_name) function->m_names.push_back(m_name)
+#else
+#define BYTECODE_DEBUG_NAME(m_names, m_name)
+#endif
+
+		uint32_t operator_count = _get_count();
+		for (uint32_t i = 0; i < operator_count && !failed; i++) {
+			uint32_t op = _get_32();
+			Variant::Type left = _get_variant_type();
+			Variant::Type right = _get_variant_type();
+			if (op >= Variant::OP_MAX) {
+				_fail("Invalid operator.");
+				break;
+			}
+			function->operator_funcs.push_back(Variant::get_validated_operator_evaluator((Variant::Operator)op, left, right));
+			BYTECODE_DEBUG_NAME(operator_names, Variant::get_operator_name((Variant::Operator)op));
+		}
+		_check_resolved(function->operator_funcs, "operator");
+
+		uint32_t setter_count = _get_count();
+		for (uint32_t i = 0; i < setter_count && !failed; i++) {
+			Variant::Type type = _get_variant_type();
+			StringName member = _get_string_name();
+			function->setters.push_back(Variant::get_member_validated_setter(type, member));
+			BYTECODE_DEBUG_NAME(setter_names, member);
+		}
+		_check_resolved(function->setters, "setter");
+
+		uint32_t getter_count = _get_count();
+		for (uint32_t i = 0; i < getter_count && !failed; i++) {
+			Variant::Type type = _get_variant_type();
+			StringName member = _get_string_name();
+			function->getters.push_back(Variant::get_member_validated_getter(type, member));
+			BYTECODE_DEBUG_NAME(getter_names, member);
+		}
+		_check_resolved(function->getters, "getter");
+
+		uint32_t keyed_setter_count = _get_count();
+		for (uint32_t i = 0; i < keyed_setter_count && !failed; i++) {
+			function->keyed_setters.push_back(Variant::get_member_validated_keyed_setter(_get_variant_type()));
+		}
+		_check_resolved(function->keyed_setters, "keyed setter");
+
+		uint32_t keyed_getter_count = _get_count();
+		for (uint32_t i = 0; i < keyed_getter_count && !failed; i++) {
+			function->keyed_getters.push_back(Variant::get_member_validated_keyed_getter(_get_variant_type()));
+		}
+		_check_resolved(function->keyed_getters, "keyed getter");
+
+		uint32_t indexed_setter_count = _get_count();
+		for (uint32_t i = 0; i < indexed_setter_count && !failed; i++) {
+			function->indexed_setters.push_back(Variant::get_member_validated_indexed_setter(_get_variant_type()));
+		}
+		_check_resolved(function->indexed_setters, "indexed setter");
+
+		uint32_t indexed_getter_count = _get_count();
+		for (uint32_t i = 0; i < indexed_getter_count && !failed; i++) {
+			function->indexed_getters.push_back(Variant::get_member_validated_indexed_getter(_get_variant_type()));
+		}
+		_check_resolved(function->indexed_getters, "indexed getter");
+
+		uint32_t builtin_method_count = _get_count();
+		for (uint32_t i = 0; i < builtin_method_count && !failed; i++) {
+			Variant::Type type = _get_variant_type();
+			StringName method = _get_string_name();
+			function->builtin_methods.push_back(Variant::get_validated_builtin_method(type, method));
+			BYTECODE_DEBUG_NAME(builtin_methods_names, method);
+		}
+		_check_resolved(function->builtin_methods, "built-in method");
+
+		uint32_t constructor_count = _get_count();
+		for (uint32_t i = 0; i < constructor_count && !failed; i++) {
+			Variant::Type type = _get_variant_type();
+			uint32_t constructor = _get_32();
+			if (failed || constructor >= (uint32_t)Variant::get_constructor_count(type)) {
+				_fail("Invalid constructor.");
+				break;
+			}
+			function->constructors.push_back(Variant::get_validated_constructor(type, constructor));
+			BYTECODE_DEBUG_NAME(constructors_names, Variant::get_type_name(type));
+		}
+		_check_resolved(function->constructors, "constructor");
+
+		uint32_t utility_count = _get_count();
+		for (uint32_t i = 0; i < utility_count && !failed; i++) {
+			StringName utility = _get_string_name();
+			function->utilities.push_back(Variant::get_validated_utility_function(utility));
+			BYTECODE_DEBUG_NAME(utilities_names, utility);
+		}
+		_check_resolved(function->utilities, "utility function");
+
+		uint32_t gds_utility_count = _get_count();
+		for (uint32_t i = 0; i < gds_utility_count && !failed; i++) {
+			StringName utility = _get_string_name();
+			function->gds_utilities.push_back(GDScriptUtilityFunctions::get_function(utility));
+			BYTECODE_DEBUG_NAME(gds_utilities_names, utility);
+		}
+		_check_resolved(function->gds_utilities, "GDScript utility function");
+
+#undef BYTECODE_DEBUG_NAME
+
+		uint32_t method_count = _get_count();
+		for (uint32_t i = 0; i < method_count && !failed; i++) {
+			StringName class_name = _get_string_name();
+			StringName method = _get_string_name();
+			function->methods.push_back(ClassDB::get_method(class_name, method));
+		}
+		_check_resolved(function->methods, "native method");
+
+		uint32_t lambda_count = _get_count();
+		for (uint32_t i = 0; i < lambda_count && !failed; i++) {
+			r_lambdas.push_back(_get_32());
+		}
+
+		function->_inline_cache_count = _get_count();
+
+		return function;
+	}
+
+	void _read_class(int p_index) {
+		GDScript *script = classes[p_index];
+		ClassData &class_data_entry = class_data.write[p_index];
+
+		class_data_entry.tool = _get_32();
+
+		StringName native = _get_string_name();
+		const int *native_index = GDScriptLanguage::get_singleton()->get_global_map().getptr(native);
+		if (failed || native_index == nullptr) {
+			_fail(vformat(R"(Unknown native class "%s".)", native));
+			return;
+		}
+		class_data_entry.native = GDScriptLanguage::get_singleton()->get_global_array()[*native_index];
+		if (class_data_entry.native.is_null()) {
+			_fail(vformat(R"(Unknown native class "%s".)", native));
+			return;
+		}
+
+		switch (_get_32()) {
+			case BYTECODE_SCRIPT_NONE:
+				break;
+			case BYTECODE_SCRIPT_LOCAL:
+				class_data_entry.local_base = _get_index(classes.size());
+				if (class_data_entry.local_base < 0 || class_data_entry.local_base == p_index) {
+					_fail("Invalid base class.");
+					return;
+				}
+				class_data_entry.base = Ref<GDScript>(classes[class_data_entry.local_base]);
+				break;
+			case BYTECODE_SCRIPT_EXTERNAL:
+				// The member layout continues the one of the base, so it has to be compiled first.
+				class_data_entry.base = _get_external_class(true);
+				if (class_data_entry.base.is_valid() && !class_data_entry.base->is_valid()) {
+					_fail(vformat(R"(Base class "%s" is not compiled yet.)", class_data_entry.base->fully_qualified_name));
+				}
+				break;
+			default:
+				_fail("Invalid base class.");
+				return;
+		}
+
+		for (int is_static = 0; is_static < 2; is_static++) {
+			Vector<Pair<StringName, GDScript::MemberInfo>> &members = is_static ? class_data_entry.static_members : class_data_entry.members;
+			uint32_t member_count = _get_count();
+			for (uint32_t i = 0; i < member_count && !failed; i++) {
+				Pair<StringName, GDScript::MemberInfo> member;
+				member.first = _get_string_name();
+				member.second.index = _get_32();
+				member.second.setter = _get_string_name();
+				member.second.getter = _get_string_name();
+				member.second.data_type = _get_data_type();
+				member.second.property_info = _get_property_info();
+				members.push_back(member);
+			}
+		}
+
+		uint32_t constant_count = _get_count();
+		for (uint32_t i = 0; i < constant_count && !failed; i++) {
+			StringName name = _get_string_name();
+			class_data_entry.constants.push_back(Pair<StringName, Variant>(name, _get_variant()));
+		}
+
+		uint32_t signal_count = _get_count();
+		for (uint32_t i = 0; i < signal_count && !failed; i++) {
+			class_data_entry.signals.push_back(_get_method_info());
+		}
+
+		class_data_entry.rpc_config = _get_variant();
+
+		uint32_t function_count = _get_count();
+		class_data_entry.function_lambdas.resize(function_count);
+		for (uint32_t i = 0; i < function_count && !failed; i++) {
+			class_data_entry.functions.push_back(_get_function(script, class_data_entry.function_lambdas.write[i]));
+		}
+		if (failed) {
+			return;
+		}
+
+		for (uint32_t i = 0; i < function_count; i++) {
+			for (uint32_t lambda : class_data_entry.function_lambdas[i]) {
+				if (lambda >= function_count) {
+					_fail("Invalid lambda.");
+					return;
+				}
+			}
+		}
+
+		uint32_t member_function_count = _get_count();
+		for (uint32_t i = 0; i < member_function_count && !failed; i++) {
+			StringName name = _get_string_name();
+			int function = _get_index(function_count);
+			if (function < 0) {
+				_fail("Invalid member function.");
+				return;
+			}
+			class_data_entry.member_functions.push_back(Pair<StringName, int>(name, function));
+		}
+
+		class_data_entry.initializer = _get_index(function_count);
+		class_data_entry.implicit_initializer = _get_index(function_count);
+		class_data_entry.implicit_ready = _get_index(function_count);
+		class_data_entry.static_initializer = _get_index(function_count);
+
+		uint32_t lambda_info_count = _get_count();
+		for (uint32_t i = 0; i < lambda_info_count && !failed; i++) {
+			LambdaData lambda;
+			lambda.function = _get_index(function_count);
+			lambda.info.capture_count = _get_32();
+			lambda.info.use_self = _get_32();
+			if (lambda.function < 0) {
+				_fail("Invalid lambda.");
+				return;
+			}
+			class_data_entry.lambda_info.push_back(lambda);
+		}
+	}
+
+	void _validate_members() {
+		for (int i = 0; i < classes.size() && !failed; i++) {
+			// Members of local bases are added on top of their own base.
+			int inherited = 0;
+			int current = i;
+			for (int depth = 0; depth < classes.size() && class_data[current].local_base >= 0; depth++) {
+				current = class_data[current].local_base;
+				inherited += class_data[current].members.size();
+			}
+			if (class_data[current].local_base >= 0) {
+				_fail("Cyclic inheritance.");
+				return;
+			}
+			if (class_data[current].base.is_valid()) {
+				inherited += class_data[current].base->member_indices.size();
+			}
+
+			const ClassData &data_entry = class_data[i];
+			for (int j = 0; j < data_entry.members.size(); j++) {
+				if (data_entry.members[j].second.index != inherited + j) {
+					_fail("Member layout doesn't match the base class.");
+					return;
+				}
+			}
+			for (int j = 0; j < data_entry.static_members.size(); j++) {
+				if (data_entry.static_members[j].second.index != j) {
+					_fail("Invalid static variable index.");
+					return;
+				}
+			}
+		}
+	}
+
+	void _commit_class(int p_index, Vector<bool> &r_committed) {
+		if (r_committed[p_index]) {
+			return;
+		}
+		r_committed.write[p_index] = true;
+
+		ClassData &data_entry = class_data.write[p_index];
+		if (data_entry.local_base >= 0) {
+			_commit_class(data_entry.local_base, r_committed);
+		}
+
+		GDScript *script = classes[p_index];
+		script->tool = data_entry.tool;
+		script->native = data_entry.native;
+		script->base = data_entry.base;
+		script->_base = data_entry.base.ptr();
+
+		script->member_indices.clear();
+		script->members.clear();
+		if (script->base.is_valid()) {
+			script->member_indices = script->base->member_indices;
+		}
+		for (const Pair<StringName, GDScript::MemberInfo> &E : data_entry.members) {
+			script->member_indices[E.first] = E.second;
+			script->members.insert(E.first);
+		}
+
+		script->static_variables_indices.clear();
+		for (const Pair<StringName, GDScript::MemberInfo> &E : data_entry.static_members) {
+			script->static_variables_indices[E.first] = E.second;
+		}
+		script->static_variables.resize(script->static_variables_indices.size());
+
+		script->constants.clear();
+		for (const Pair<StringName, Variant> &E : data_entry.constants) {
+			script->constants.insert(E.first, E.second);
+		}
+
+		script->_signals.clear();
+		for (const MethodInfo &E : data_entry.signals) {
+			script->_signals[E.name] = E;
+		}
+		script->rpc_config = data_entry.rpc_config;
+
+		for (int i = 0; i < data_entry.functions.size(); i++) {
+			GDScriptFunction *function = data_entry.functions[i];
+			for (uint32_t lambda : data_entry.function_lambdas[i]) {
+				function->lambdas.push_back(data_entry.functions[lambda]);
+			}
+			_update_function_pointers(function);
+		}
+
+		script->member_functions.clear();
+		for (const Pair<StringName, int> &E : data_entry.member_functions) {
+			script->member_functions[E.first] = data_entry.functions[E.second];
+		}
+		script->initializer = data_entry.initializer >= 0 ? data_entry.functions[data_entry.initializer] : nullptr;
+		script->implicit_initializer = data_entry.implicit_initializer >= 0 ? data_entry.functions[data_entry.implicit_initializer] : nullptr;
+		script->implicit_ready = data_entry.implicit_ready >= 0 ? data_entry.functions[data_entry.implicit_ready] : nullptr;
+		script->static_initializer = data_entry.static_initializer >= 0 ? data_entry.functions[data_entry.static_initializer] : nullptr;
+
+		script->lambda_info.clear();
+		for (const LambdaData &E : data_entry.lambda_info) {
+			script->lambda_info.insert(data_entry.functions[E.function], E.info);
+		}
+
+#ifdef DEBUG_ENABLED
+		for (GDScriptFunction *function : data_entry.functions) {
+			function->func_cname = (String(function->source) + " - " + String(function->name)).utf8();
+			function->_func_cname = function->func_cname.get_data();
+
+			if (EngineDebugger::is_active()) {
+				String signature = script->get_script_path() + "::" + itos(function->_initial_line) + "::";
+				if (script->local_name != StringName()) {
+					signature += String(script->local_name) + ".";
+				}
+				signature += String(function->name);
+				if (script->lambda_info.has(function)) {
+					signature += "(lambda)";
+				}
+				function->profile.signature = signature;
+			}
+		}
+#endif
+
+		// Ownership moved to the script.
+		data_entry.functions.clear();
+	}
+
+	static void _update_function_pointers(GDScriptFunction *p_function) {
+		// Mirrors `GDScriptByteCodeGenerator::write_end()`.
+#define BYTECODE_TABLE(m_table, m_count, m_ptr) \
+	p_function->m_count = p_function->m_table.size(); \
+	p_function->m_ptr = p_function->m_table.is_empty() ? nullptr : p_function->m_table.ptrw();
+
+		BYTECODE_TABLE(constants, _constant_count, _constants_ptr);
+		BYTECODE_TABLE(code, _code_size, _code_ptr);
+		BYTECODE_TABLE(operator_funcs, _operator_funcs_count, _operator_funcs_ptr);
+		BYTECODE_TABLE(setters, _setters_count, _setters_ptr);
+		BYTECODE_TABLE(getters, _getters_count, _getters_ptr);
+		BYTECODE_TABLE(keyed_setters, _keyed_setters_count, _keyed_setters_ptr);
+		BYTECODE_TABLE(keyed_getters, _keyed_getters_count, _keyed_getters_ptr);
+		BYTECODE_TABLE(indexed_setters, _indexed_setters_count, _indexed_setters_ptr);
+		BYTECODE_TABLE(indexed_getters, _indexed_getters_count, _indexed_getters_ptr);
+		BYTECODE_TABLE(builtin_methods, _builtin_methods_count, _builtin_methods_ptr);
+		BYTECODE_TABLE(constructors, _constructors_count, _constructors_ptr);
+		BYTECODE_TABLE(utilities, _utilities_count, _utilities_ptr);
+		BYTECODE_TABLE(gds_utilities, _gds_utilities_count, _gds_utilities_ptr);
+		BYTECODE_TABLE(methods, _methods_count, _methods_ptr);
+		BYTECODE_TABLE(lambdas, _lambdas_count, _lambdas_ptr);
+
+#undef BYTECODE_TABLE
+
+		p_function->_global_names_count = p_function->global_names.size();
+		p_function->_global_names_ptr = p_function->global_names.is_empty() ? nullptr : p_function->global_names.ptr();
+
+		if (p_function->default_arguments.is_empty()) {
+			p_function->_default_arg_count = 0;
+			p_function->_default_arg_ptr = nullptr;
+		} else {
+			p_function->_default_arg_count = p_function->default_arguments.size() - 1;
+			p_function->_default_arg_ptr = p_function->default_arguments.ptr();
+		}
+
+		if (p_function->_inline_cache_count) {
+			p_function->_inline_caches_ptr = memnew_arr(GDScriptFunction::InlineCache, p_function->_inline_cache_count);
+		}
+	}
+
+public:
+	~Reader() {
+		// Functions are only left here when loading failed.
+		for (ClassData &E : class_data) {
+			for (GDScriptFunction *function : E.functions) {
+				function->lambdas.clear(); // Deleted as part of the list.
+				memdelete(function);
+			}
+		}
+	}
+
+	const String &get_error() const { return error; }
+
+	Error open(GDScript *p_script, const Vector<uint8_t> &p_buffer) {
+		root = p_script;
+
+		const uint8_t *buf = p_buffer.ptr();
+		if (p_buffer.size() < BYTECODE_HEADER_SIZE || buf[0] != 'G' || buf[1] != 'D' || buf[2] != 'B' || buf[3] != 'C') {
+			_fail("Not a GDScript bytecode file.");
+			return ERR_FILE_UNRECOGNIZED;
+		}
+		if (decode_uint32(&buf[4]) != BYTECODE_VERSION || decode_uint32(&buf[8]) != GDScriptBytecodeCache::get_engine_hash()) {
+			_fail("Made by a different engine build.");
+			return ERR_FILE_UNRECOGNIZED;
+		}
+
+		flags = decode_uint32(&buf[12]);
+#ifdef DEBUG_ENABLED
+		const bool debug_build = true;
+#else
+		const bool debug_build = false;
+#endif
+		if (bool(flags & FLAG_DEBUG_CODEGEN) != debug_build) {
+			_fail(debug_build ? "Made for release builds." : "Made for debug builds.");
+			return ERR_INVALID_DATA;
+		}
+		if (GDScriptLanguage::get_singleton()->should_track_locals() && !(flags & FLAG_TRACK_LOCALS)) {
+			_fail("Made without local variable tracking.");
+			return ERR_INVALID_DATA;
+		}
+
+		if (decode_uint32(&buf[16]) != GDScriptBytecodeCache::get_source_hash(p_script->source, p_script->binary_tokens)) {
+			_fail("Made from a different source.");
+			return ERR_FILE_MISSING_DEPENDENCIES;
+		}
+
+		uint32_t decompressed_size = decode_uint32(&buf[20]);
+		contents.resize(decompressed_size);
+		int result = Compression::decompress(contents.ptrw(), contents.size(), &buf[BYTECODE_HEADER_SIZE], p_buffer.size() - BYTECODE_HEADER_SIZE, Compression::MODE_ZSTD);
+		if (result < 0 || (uint32_t)result != decompressed_size) {
+			_fail("Error decompressing.");
+			return ERR_FILE_CORRUPT;
+		}
+
+		data = contents.ptr();
+		size = contents.size();
+		return OK;
+	}
+
+	Error read_classes() {
+		uint32_t class_count = _get_count();
+		if (failed || class_count == 0) {
+			_fail("No classes.");
+			return ERR_FILE_CORRUPT;
+		}
+
+		// Keep the classes that were already made, other scripts may hold them, as in `GDScriptCompiler::make_scripts()`.
+		Vector<HashMap<StringName, Ref<GDScript>>> old_subclasses;
+
+		for (uint32_t i = 0; i < class_count && !failed; i++) {
+			int owner = _get_index(i);
+			StringName local_name = _get_string_name();
+			String fully_qualified_name = _get_string();
+			StringName global_name = _get_string_name();
+			String simplified_icon_path = _get_string();
+			if (failed || (i == 0) != (owner < 0)) {
+				_fail("Invalid class tree.");
+				break;
+			}
+
+			GDScript *script = nullptr;
+			if (i == 0) {
+				script = root;
+			} else {
+				GDScript *owner_script = classes[owner];
+				Ref<GDScript> subclass;
+				const Ref<GDScript> *old_subclass = old_subclasses[owner].getptr(local_name);
+				if (old_subclass != nullptr) {
+					subclass = *old_subclass;
+				} else {
+					subclass = GDScriptLanguage::get_singleton()->get_orphan_subclass(fully_qualified_name);
+				}
+				if (subclass.is_null()) {
+					subclass.instantiate();
+				}
+				subclass->_owner = owner_script;
+				subclass->path = owner_script->path;
+				owner_script->subclasses.insert(local_name, subclass);
+				script = subclass.ptr();
+			}
+			old_subclasses.push_back(script->subclasses);
+			script->subclasses.clear();
+
+			script->fully_qualified_name = fully_qualified_name;
+			script->local_name = local_name;
+			script->global_name = global_name;
+			script->simplified_icon_path = simplified_icon_path;
+			classes.push_back(script);
+		}
+
+		return failed ? ERR_FILE_CORRUPT : OK;
+	}
+
+	Error load() {
+		class_data.resize(classes.size());
+		for (int i = 0; i < classes.size() && !failed; i++) {
+			_read_class(i);
+		}
+		if (!failed && position != size) {
+			_fail("Unexpected trailing data.");
+		}
+		if (!failed) {
+			_validate_members();
+		}
+		if (failed) {
+			return ERR_FILE_CORRUPT;
+		}
+
+		Vector<bool> committed;
+		committed.resize(classes.size());
+		committed.fill(false);
+		bool has_static_data = false;
+		for (int i = 0; i < classes.size(); i++) {
+			_commit_class(i, committed);
+			has_static_data = has_static_data || classes[i]->static_initializer != nullptr;
+		}
+
+		// Inner classes are finished before their owners, as in `GDScriptCompiler::_compile_class()`.
+		for (int i = classes.size() - 1; i >= 0; i--) {
+			classes[i]->_static_default_init();
+			classes[i]->valid = true;
+		}
+
+		GDScriptFunction::invalidate_inline_caches();
+
+		if (has_static_data && !(flags & FLAG_STATIC_UNLOAD)) {
+			GDScriptCache::add_static_script(root);
+		}
+
+		return GDScriptCache::finish_compiling(root->path);
+	}
+};
+
+Error GDScriptBytecodeCache::make_scripts(GDScript *p_script, const Vector<uint8_t> &p_buffer) {
+	Reader reader;
+	Error err = reader.open(p_script, p_buffer);
+	if (err == OK) {
+		err = reader.read_classes();
+	}
+	if (err != OK) {
+		print_verbose(vformat(R"(GDScript: Ignoring precompiled bytecode for "%s": %s)", p_script->path, reader.get_error()));
+	}
+	return err;
+}
+
+Error GDScriptBytecodeCache::load(GDScript *p_script, const Vector<uint8_t> &p_buffer) {
+	ERR_FAIL_NULL_V(p_script, ERR_INVALID_PARAMETER);
+	ERR_FAIL_COND_V_MSG(!p_script->member_functions.is_empty() || p_script->implicit_initializer, ERR_ALREADY_IN_USE, "Precompiled bytecode can only be loaded into a script that was never compiled.");
+
+	Reader reader;
+	Error err = reader.open(p_script, p_buffer);
+	if (err == OK) {
+		err = reader.read_classes();
+	}
+	if (err == OK) {
+		err = reader.load();
+	}
+	if (err != OK) {
+		print_verbose(vformat(R"(GDScript: Ignoring precompiled bytecode for "%s": %s)", p_script->path, reader.get_error()));
+	}
+	return err;
+}
+
+#ifdef TOOLS_ENABLED
+
+class GDScriptBytecodeCache::Writer {
+	struct OperatorKey {
+		Variant::Operator op = Variant::OP_MAX;
+		Variant::Type left = Variant::NIL;
+		Variant::Type right = Variant::NIL;
+	};
+
+	// Maps the validated call pointers used by the code generator back to what they were made from.
+	struct CallTables {
+		RBMap<Variant::ValidatedOperatorEvaluator, OperatorKey> operators;
+		RBMap<Variant::ValidatedSetter, Pair<Variant::Type, StringName>> setters;
+		RBMap<Variant::ValidatedGetter, Pair<Variant::Type, StringName>> getters;
+		RBMap<Variant::ValidatedKeyedSetter, Variant::Type> keyed_setters;
+		RBMap<Variant::ValidatedKeyedGetter, Variant::Type> keyed_getters;
+		RBMap<Variant::ValidatedIndexedSetter, Variant::Type> indexed_setters;
+		RBMap<Variant::ValidatedIndexedGetter, Variant::Type> indexed_getters;
+		RBMap<Variant::ValidatedBuiltInMethod, Pair<Variant::Type, StringName>> builtin_methods;
+		RBMap<Variant::ValidatedConstructor, Pair<Variant::Type, int>> constructors;
+		RBMap<Variant::ValidatedUtilityFunction, StringName> utilities;
+		RBMap<GDScriptUtilityFunctions::FunctionPtr, StringName> gds_utilities;
+
+		CallTables() {
+			for (int type = 0; type < Variant::VARIANT_MAX; type++) {
+				const Variant::Type variant_type = (Variant::Type)type;
+
+				for (int op = 0; op < Variant::OP_MAX; op++) {
+					for (int right = 0; right < Variant::VARIANT_MAX; right++) {
+						Variant::ValidatedOperatorEvaluator evaluator = Variant::get_validated_operator_evaluator((Variant::Operator)op, variant_type, (Variant::Type)right);
+						if (evaluator != nullptr && !operators.has(evaluator)) {
+							operators.insert(evaluator, { (Variant::Operator)op, variant_type, (Variant::Type)right });
+						}
+					}
+				}
+
+				List<StringName> members;
+				Variant::get_member_list(variant_type, &members);
+				for (const StringName &E : members) {
+					setters.insert(Variant::get_member_validated_setter(variant_type, E), Pair<Variant::Type, StringName>(variant_type, E));
+					getters.insert(Variant::get_member_validated_getter(variant_type, E), Pair<Variant::Type, StringName>(variant_type, E));
+				}
+
+				if (Variant::get_member_validated_keyed_setter(variant_type) != nullptr) {
+					keyed_setters.insert(Variant::get_member_validated_keyed_setter(variant_type), variant_type);
+					keyed_getters.insert(Variant::get_member_validated_keyed_getter(variant_type), variant_type);
+				}
+				if (Variant::get_member_validated_indexed_setter(variant_type) != nullptr) {
+					indexed_setters.insert(Variant::get_member_validated_indexed_setter(variant_type), variant_type);
+					indexed_getters.insert(Variant::get_member_validated_indexed_getter(variant_type), variant_type);
+				}
+
+				List<StringName> methods;
+				Variant::get_builtin_method_list(variant_type, &methods);
+				for (const StringName &E : methods) {
+					builtin_methods.insert(Variant::get_validated_builtin_method(variant_type, E), Pair<Variant::Type, StringName>(variant_type, E));
+				}
+
+				for (int i = 0; i < Variant::get_constructor_count(variant_type); i++) {
+					Variant::ValidatedConstructor constructor = Variant::get_validated_constructor(variant_type, i);
+					if (!constructors.has(constructor)) {
+						constructors.insert(constructor, Pair<Variant::Type, int>(variant_type, i));
+					}
+				}
+			}
+
+			List<StringName> functions;
+			Variant::get_utility_function_list(&functions);
+			for (const StringName &E : functions) {
+				utilities.insert(Variant::get_validated_utility_function(E), E);
+			}
+
+			functions.clear();
+			GDScriptUtilityFunctions::get_function_list(&functions);
+			for (const StringName &E : functions) {
+				gds_utilities.insert(GDScriptUtilityFunctions::get_function(E), E);
+			}
+		}
+	};
+
+	Vector<uint8_t> contents;
+
+	GDScript *root = nullptr;
+	Vector<GDScript *> classes;
+	HashMap<GDScript *, int> class_indices;
+	HashMap<String, int> class_names;
+	HashMap<int, StringName> global_names;
+	HashMap<Object *, StringName> global_objects;
+
+	bool failed = false;
+	String error;
+
+	void _fail(const String &p_error) {
+		if (!failed) {
+			failed = true;
+			error = p_error;
+		}
+	}
+
+	void _put_32(uint32_t p_value) {
+		int position = contents.size();
+		contents.resize(position + 4);
+		encode_uint32(p_value, &contents.write[position]);
+	}
+
+	void _put_string(const String &p_string) {
+		CharString utf8 = p_string.utf8();
+		_put_32(utf8.length());
+		int position = contents.size();
+		contents.resize(position + utf8.length());
+		memcpy(&contents.write[position], utf8.get_data(), utf8.length());
+	}
+
+	void _put_index(int p_index) {
+		_put_32(p_index < 0 ? BYTECODE_NONE : (uint32_t)p_index);
+	}
+
+	int _get_local_class(const Script *p_script) const {
+		const int *index = class_indices.getptr(const_cast<GDScript *>(Object::cast_to<GDScript>(p_script)));
+		if (index != nullptr) {
+			return *index;
+		}
+		// Classes of the same file seen through the script cache, as opposed to the copy being compiled.
+		const GDScript *gdscript = Object::cast_to<GDScript>(p_script);
+		if (gdscript != nullptr && gdscript->path == root->path) {
+			index = class_names.getptr(gdscript->fully_qualified_name);
+			if (index != nullptr) {
+				return *index;
+			}
+		}
+		return -1;
+	}
+
+	void _put_script(const Script *p_script) {
+		if (p_script == nullptr) {
+			_put_32(BYTECODE_SCRIPT_NONE);
+			return;
+		}
+
+		int local = _get_local_class(p_script);
+		if (local >= 0) {
+			_put_32(BYTECODE_SCRIPT_LOCAL);
+			_put_32(local);
+			return;
+		}
+
+		const GDScript *gdscript = Object::cast_to<GDScript>(p_script);
+		if (gdscript != nullptr) {
+			Vector<StringName> names;
+			for (const GDScript *E = gdscript; E->_owner != nullptr; E = E->_owner) {
+				names.push_back(E->local_name);
+			}
+			if (!gdscript->path.is_resource_file()) {
+				_fail(vformat(R"(Can't refer to built-in script "%s".)", gdscript->fully_qualified_name));
+				return;
+			}
+			_put_32(BYTECODE_SCRIPT_EXTERNAL);
+			_put_string(gdscript->path);
+			_put_32(names.size());
+			for (int i = names.size() - 1; i >= 0; i--) {
+				_put_string(names[i]);
+			}
+			return;
+		}
+
+		if (!p_script->get_path().is_resource_file()) {
+			_fail(vformat(R"(Can't refer to built-in script "%s".)", p_script->get_path()));
+			return;
+		}
+		_put_32(BYTECODE_SCRIPT_RESOURCE);
+		_put_string(p_script->get_path());
+	}
+
+	void _put_variant(const Variant &p_value) {
+		switch (p_value.get_type()) {
+			case Variant::OBJECT: {
+				Object *object = p_value.get_validated_object();
+				if (object == nullptr) {
+					_put_32(BYTECODE_VARIANT_NULL_OBJECT);
+					return;
+				}
+				const StringName *global = global_objects.getptr(object);
+				if (global != nullptr) {
+					_put_32(BYTECODE_VARIANT_GLOBAL);
+					_put_string(*global);
+					return;
+				}
+				Script *script = Object::cast_to<Script>(object);
+				if (script != nullptr) {
+					_put_32(BYTECODE_VARIANT_SCRIPT);
+					_put_script(script);
+					return;
+				}
+				Resource *resource = Object::cast_to<Resource>(object);
+				if (resource != nullptr && resource->get_path().is_resource_file()) {
+					_put_32(BYTECODE_VARIANT_RESOURCE);
+					_put_string(resource->get_path());
+					return;
+				}
+				_fail(vformat(R"(Can't store constant of type "%s".)", object->get_class()));
+			} break;
+			case Variant::ARRAY: {
+				Array array = p_value;
+				_put_32(BYTECODE_VARIANT_ARRAY);
+				_put_32((array.is_typed() ? BYTECODE_CONTAINER_TYPED : 0) | (array.is_read_only() ? BYTECODE_CONTAINER_READ_ONLY : 0));
+				if (array.is_typed()) {
+					_put_32(array.get_typed_builtin());
+					_put_string(array.get_typed_class_name());
+					_put_script(Ref<Script>(array.get_typed_script()).ptr());
+				}
+				_put_32(array.size());
+				for (int i = 0; i < array.size(); i++) {
+					_put_variant(array[i]);
+				}
+			} break;
+			case Variant::DICTIONARY: {
+				Dictionary dictionary = p_value;
+				_put_32(BYTECODE_VARIANT_DICTIONARY);
+				_put_32((dictionary.is_typed() ? BYTECODE_CONTAINER_TYPED : 0) | (dictionary.is_read_only() ? BYTECODE_CONTAINER_READ_ONLY : 0));
+				if (dictionary.is_typed()) {
+					_put_32(dictionary.get_typed_key_builtin());
+					_put_string(dictionary.get_typed_key_class_name());
+					_put_script(Ref<Script>(dictionary.get_typed_key_script()).ptr());
+					_put_32(dictionary.get_typed_value_builtin());
+					_put_string(dictionary.get_typed_value_class_name());
+					_put_script(Ref<Script>(dictionary.get_typed_value_script()).ptr());
+				}
+				_put_32(dictionary.size());
+				for (const KeyValue<Variant, Variant> &E : dictionary) {
+					_put_variant(E.key);
+					_put_variant(E.value);
+				}
+			} break;
+			case Variant::CALLABLE:
+			case Variant::SIGNAL:
+			case Variant::RID:
+				if (p_value.booleanize()) {
+					_fail(vformat(R"(Can't store constant of type "%s".)", Variant::get_type_name(p_value.get_type())));
+					return;
+				}
+				[[fallthrough]];
+			default: {
+				int length = 0;
+				Error err = encode_variant(p_value, nullptr, length, false);
+				if (err != OK) {
+					_fail(vformat(R"(Can't store constant of type "%s".)", Variant::get_type_name(p_value.get_type())));
+					return;
+				}
+				_put_32(BYTECODE_VARIANT_PLAIN);
+				_put_32(length);
+				int position = contents.size();
+				contents.resize(position + length);
+				encode_variant(p_value, &contents.write[position], length, false);
+			} break;
+		}
+	}
+
+	void _put_data_type(const GDScriptDataType &p_type) {
+		_put_32(p_type.has_type);
+		_put_32(p_type.kind);
+		_put_32(p_type.builtin_type);
+		_put_string(p_type.native_type);
+		_put_script(p_type.script_type);
+		_put_32(p_type.container_element_types.size());
+		for (const GDScriptDataType &E : p_type.container_element_types) {
+			_put_data_type(E);
+		}
+	}
+
+	void _put_property_info(const PropertyInfo &p_info) {
+		_put_32(p_info.type);
+		_put_string(p_info.name);
+		_put_string(p_info.class_name);
+		_put_32(p_info.hint);
+		_put_string(p_info.hint_string);
+		_put_32(p_info.usage);
+	}
+
+	void _put_method_info(const MethodInfo &p_info) {
+		_put_string(p_info.name);
+		_put_property_info(p_info.return_val);
+		_put_32(p_info.flags);
+		_put_32(p_info.id);
+		_put_32(p_info.arguments.size());
+		for (const PropertyInfo &E : p_info.arguments) {
+			_put_property_info(E);
+		}
+		_put_32(p_info.default_arguments.size());
+		for (const Variant &E : p_info.default_arguments) {
+			_put_variant(E);
+		}
+		_put_32(p_info.return_val_metadata);
+		_put_32(p_info.arguments_metadata.size());
+		for (int E : p_info.arguments_metadata) {
+			_put_32(E);
+		}
+	}
+
+	template <typename T, typename V>
+	const V *_find_call(const RBMap<T, V> &p_table, T p_ptr, const char *p_what) {
+		const typename RBMap<T, V>::Element *E = p_table.find(p_ptr);
+		if (E == nullptr) {
+			_fail(vformat("Unknown %s.", p_what));
+			return nullptr;
+		}
+		return &E->value();
+	}
+
+	void _put_function(const GDScriptFunction *p_function, const HashMap<const GDScriptFunction *, int> &p_function_indices) {
+		static const CallTables tables;
+
+		_put_string(p_function->name);
+		_put_32(p_function->_static);
+		_put_32(p_function->_initial_line);
+		_put_32(p_function->_argument_count);
+		_put_32(p_function->_stack_size);
+		_put_32(p_function->_instruction_args_size);
+
+		_put_32(p_function->argument_types.size());
+		for (const GDScriptDataType &E : p_function->argument_types) {
+			_put_data_type(E);
+		}
+		_put_data_type(p_function->return_type);
+		_put_method_info(p_function->method_info);
+		_put_variant(p_function->rpc_config);
+
+		_put_32(p_function->temporary_slots.size());
+		for (const KeyValue<int, Variant::Type> &E : p_function->temporary_slots) {
+			_put_32(E.key);
+			_put_32(E.value);
+		}
+
+		_put_32(p_function->stack_debug.size());
+		for (const GDScriptFunction::StackDebug &E : p_function->stack_debug) {
+			_put_32(E.line);
+			_put_32(E.pos);
+			_put_32(E.added);
+			_put_string(E.identifier);
+		}
+
+		_put_32(p_function->code.size());
+		for (int E : p_function->code) {
+			_put_32(E);
+		}
+
+		_put_32(p_function->default_arguments.size());
+		for (int E : p_function->default_arguments) {
+			_put_32(E);
+		}
+
+		_put_32(p_function->constants.size());
+		for (const Variant &E : p_function->constants) {
+			_put_variant(E);
+		}
+
+		_put_32(p_function->global_names.size());
+		for (const StringName &E : p_function->global_names) {
+			_put_string(E);
+		}
+
+		_put_32(p_function->global_index_positions.size());
+		for (int E : p_function->global_index_positions) {
+			const StringName *global = global_names.getptr(p_function->code[E]);
+			if (global == nullptr) {
+				_fail("Unknown global.");
+				return;
+			}
+			_put_32(E);
+			_put_string(*global);
+		}
+
+		_put_32(p_function->operator_funcs.size());
+		for (Variant::ValidatedOperatorEvaluator E : p_function->operator_funcs) {
+			const OperatorKey *key = _find_call(tables.operators, E, "operator");
+			if (key == nullptr) {
+				return;
+			}
+			_put_32(key->op);
+			_put_32(key->left);
+			_put_32(key->right);
+		}
+
+		_put_32(p_function->setters.size());
+		for (Variant::ValidatedSetter E : p_function->setters) {
+			const Pair<Variant::Type, StringName> *key = _find_call(tables.setters, E, "setter");
+			if (key == nullptr) {
+				return;
+			}
+			_put_32(key->first);
+			_put_string(key->second);
+		}
+
+		_put_32(p_function->getters.size());
+		for (Variant::ValidatedGetter E : p_function->getters) {
+			const Pair<Variant::Type, StringName> *key = _find_call(tables.getters, E, "getter");
+			if (key == nullptr) {
+				return;
+			}
+			_put_32(key->first);
+			_put_string(key->second);
+		}
+
+#define BYTECODE_PUT_TYPED_CALLS(m_list, m_type, m_what)                           \
+	_put_32(p_function->m_list.size());                                            \
+	for (Variant::m_type E : p_function->m_list) {                                 \
+		const Variant::Type *type = _find_call(tables.m_list, E, m_what);          \
+		if (type == nullptr) {                                                     \
+			return;                                                                \
+		}                                                                          \
+		_put_32(*type);                                                            \
+	}
+
+		BYTECODE_PUT_TYPED_CALLS(keyed_setters, ValidatedKeyedSetter, "keyed setter");
+		BYTECODE_PUT_TYPED_CALLS(keyed_getters, ValidatedKeyedGetter, "keyed getter");
+		BYTECODE_PUT_TYPED_CALLS(indexed_setters, ValidatedIndexedSetter, "indexed setter");
+		BYTECODE_PUT_TYPED_CALLS(indexed_getters, ValidatedIndexedGetter, "indexed getter");
+
+#undef BYTECODE_PUT_TYPED_CALLS
+
+		_put_32(p_function->builtin_methods.size());
+		for (Variant::ValidatedBuiltInMethod E : p_function->builtin_methods) {
+			const Pair<Variant::Type, StringName> *key = _find_call(tables.builtin_methods, E, "built-in method");
+			if (key == nullptr) {
+				return;
+			}
+			_put_32(key->first);
+			_put_string(key->second);
+		}
+
+		_put_32(p_function->constructors.size());
+		for (Variant::ValidatedConstructor E : p_function->constructors) {
+			const Pair<Variant::Type, int> *key = _find_call(tables.constructors, E, "constructor");
+			if (key == nullptr) {
+				return;
+			}
+			_put_32(key->first);
+			_put_32(key->second);
+		}
+
+		_put_32(p_function->utilities.size());
+		for (Variant::ValidatedUtilityFunction E : p_function->utilities) {
+			const StringName *name = _find_call(tables.utilities, E, "utility function");
+			if (name == nullptr) {
+				return;
+			}
+			_put_string(*name);
+		}
+
+		_put_32(p_function->gds_utilities.size());
+		for (GDScriptUtilityFunctions::FunctionPtr E : p_function->gds_utilities) {
+			const StringName *name = _find_call(tables.gds_utilities, E, "GDScript utility function");
+			if (name == nullptr) {
+				return;
+			}
+			_put_string(*name);
+		}
+
+		_put_32(p_function->methods.size());
+		for (const MethodBind *E : p_function->methods) {
+			_put_string(E->get_instance_class());
+			_put_string(E->get_name());
+		}
+
+		_put_32(p_function->lambdas.size());
+		for (const GDScriptFunction *E : p_function->lambdas) {
+			const int *index = p_function_indices.getptr(E);
+			if (index == nullptr) {
+				_fail("Unknown lambda.");
+				return;
+			}
+			_put_32(*index);
+		}
+
+		_put_32(p_function->_inline_cache_count);
+	}
+
+	static void _add_function(const GDScriptFunction *p_function, Vector<const GDScriptFunction *> &r_functions, HashMap<const GDScriptFunction *, int> &r_indices) {
+		if (p_function == nullptr || r_indices.has(p_function)) {
+			return;
+		}
+		r_indices.insert(p_function, r_functions.size());
+		r_functions.push_back(p_function);
+	}
+
+	void _put_class(const GDScript *p_script) {
+		_put_32(p_script->tool);
+		_put_string(p_script->native.is_valid() ? String(p_script->native->get_name()) : String());
+		_put_script(p_script->base.ptr());
+
+		// Own members only, inherited ones are taken from the base when loading.
+		Vector<Pair<int, StringName>> members;
+		for (const StringName &E : p_script->members) {
+			members.push_back(Pair<int, StringName>(p_script->member_indices[E].index, E));
+		}
+		members.sort_custom<PairSort<int, StringName>>();
+		_put_32(members.size());
+		for (const Pair<int, StringName> &E : members) {
+			const GDScript::MemberInfo &info = p_script->member_indices[E.second];
+			_put_string(E.second);
+			_put_32(info.index);
+			_put_string(info.setter);
+			_put_string(info.getter);
+			_put_data_type(info.data_type);
+			_put_property_info(info.property_info);
+		}
+
+		Vector<Pair<int, StringName>> static_members;
+		for (const KeyValue<StringName, GDScript::MemberInfo> &E : p_script->static_variables_indices) {
+			static_members.push_back(Pair<int, StringName>(E.value.index, E.key));
+		}
+		static_members.sort_custom<PairSort<int, StringName>>();
+		_put_32(static_members.size());
+		for (const Pair<int, StringName> &E : static_members) {
+			const GDScript::MemberInfo &info = p_script->static_variables_indices[E.second];
+			_put_string(E.second);
+			_put_32(info.index);
+			_put_string(info.setter);
+			_put_string(info.getter);
+			_put_data_type(info.data_type);
+			_put_property_info(info.property_info);
+		}
+
+		_put_32(p_script->constants.size());
+		for (const KeyValue<StringName, Variant> &E : p_script->constants) {
+			_put_string(E.key);
+			_put_variant(E.value);
+		}
+
+		_put_32(p_script->_signals.size());
+		for (const KeyValue<StringName, MethodInfo> &E : p_script->_signals) {
+			_put_method_info(E.value);
+		}
+
+		_put_variant(p_script->rpc_config);
+
+		Vector<const GDScriptFunction *> functions;
+		HashMap<const GDScriptFunction *, int> function_indices;
+		for (const KeyValue<StringName, GDScriptFunction *> &E : p_script->member_functions) {
+			_add_function(E.value, functions, function_indices);
+		}
+		_add_function(p_script->initializer, functions, function_indices);
+		_add_function(p_script->implicit_initializer, functions, function_indices);
+		_add_function(p_script->implicit_ready, functions, function_indices);
+		_add_function(p_script->static_initializer, functions, function_indices);
+		for (int i = 0; i < functions.size(); i++) {
+			for (const GDScriptFunction *E : functions[i]->lambdas) {
+				_add_function(E, functions, function_indices);
+			}
+		}
+
+		_put_32(functions.size());
+		for (const GDScriptFunction *E : functions) {
+			_put_function(E, function_indices);
+		}
+
+		_put_32(p_script->member_functions.size());
+		for (const KeyValue<StringName, GDScriptFunction *> &E : p_script->member_functions) {
+			_put_string(E.key);
+			_put_32(function_indices[E.value]);
+		}
+
+		_put_index(p_script->initializer ? function_indices[p_script->initializer] : -1);
+		_put_index(p_script->implicit_initializer ? function_indices[p_script->implicit_initializer] : -1);
+		_put_index(p_script->implicit_ready ? function_indices[p_script->implicit_ready] : -1);
+		_put_index(p_script->static_initializer ? function_indices[p_script->static_initializer] : -1);
+
+		_put_32(p_script->lambda_info.size());
+		for (const KeyValue<GDScriptFunction *, GDScript::LambdaInfo> &E : p_script->lambda_info) {
+			const int *index = function_indices.getptr(E.key);
+			if (index == nullptr) {
+				_fail("Unknown lambda.");
+				return;
+			}
+			_put_32(*index);
+			_put_32(E.value.capture_count);
+			_put_32(E.value.use_self);
+		}
+	}
+
+	void _add_class(GDScript *p_script) {
+		class_indices.insert(p_script, classes.size());
+		class_names.insert(p_script->fully_qualified_name, classes.size());
+		classes.push_back(p_script);
+		for (const KeyValue<StringName, Ref<GDScript>> &E : p_script->subclasses) {
+			_add_class(E.value.ptr());
+		}
+	}
+
+public:
+	const String &get_error() const { return error; }
+
+	Vector<uint8_t> write(GDScript *p_script, uint32_t p_source_hash, uint32_t p_flags) {
+		root = p_script;
+		_add_class(p_script);
+
+		const HashMap<StringName, int> &global_map = GDScriptLanguage::get_singleton()->get_global_map();
+		const Variant *global_array = GDScriptLanguage::get_singleton()->get_global_array();
+		for (const KeyValue<StringName, int> &E : global_map) {
+			global_names.insert(E.value, E.key);
+			Object *object = global_array[E.value].get_type() == Variant::OBJECT ? global_array[E.value].get_validated_object() : nullptr;
+			if (object != nullptr && !Object::cast_to<Script>(object)) {
+				global_objects.insert(object, E.key);
+			}
+		}
+
+		_put_32(classes.size());
+		for (const GDScript *E : classes) {
+			_put_index(E->_owner ? class_indices[E->_owner] : -1);
+			_put_string(E->local_name);
+			_put_string(E->fully_qualified_name);
+			_put_string(E->global_name);
+			_put_string(E->simplified_icon_path);
+		}
+
+		for (int i = 0; i < classes.size() && !failed; i++) {
+			_put_class(classes[i]);
+		}
+		if (failed) {
+			return Vector<uint8_t>();
+		}
+
+		Vector<uint8_t> buf;
+		buf.resize(BYTECODE_HEADER_SIZE);
+		uint8_t *header = buf.ptrw();
+		header[0] = 'G';
+		header[1] = 'D';
+		header[2] = 'B';
+		header[3] = 'C';
+		encode_uint32(BYTECODE_VERSION, &header[4]);
+		encode_uint32(GDScriptBytecodeCache::get_engine_hash(), &header[8]);
+		encode_uint32(p_flags, &header[12]);
+		encode_uint32(p_source_hash, &header[16]);
+		encode_uint32(contents.size(), &header[20]);
+
+		Vector<uint8_t> compressed;
+		compressed.resize(Compression::get_max_compressed_buffer_size(contents.size(), Compression::MODE_ZSTD));
+		int compressed_size = Compression::compress(compressed.ptrw(), contents.ptr(), contents.size(), Compression::MODE_ZSTD);
+		if (compressed_size < 0) {
+			_fail("Error compressing.");
+			return Vector<uint8_t>();
+		}
+		compressed.resize(compressed_size);
+		buf.append_array(compressed);
+
+		return buf;
+	}
+};
+
+Vector<uint8_t> GDScriptBytecodeCache::serialize(GDScript *p_script, uint32_t p_source_hash, uint32_t p_flags, String *r_error) {
+	ERR_FAIL_NULL_V(p_script, Vector<uint8_t>());
+	ERR_FAIL_COND_V_MSG(!p_script->is_valid(), Vector<uint8_t>(), "Can't serialize a script that isn't compiled.");
+
+	Writer writer;
+	Vector<uint8_t> buffer = writer.write(p_script, p_source_hash, p_flags);
+	if (buffer.is_empty() && r_error != nullptr) {
+		*r_error = writer.get_error();
+	}
+	return buffer;
+}
+
+void GDScriptBytecodeCache::_release_export_copy(GDScript *p_script) {
+	// `GDScript::clear()` evicts the scripts that member types refer to from the cache,
+	// but those belong to the project scripts that are still in use.
+	for (KeyValue<StringName, GDScript::MemberInfo> &E : p_script->member_indices) {
+		E.value.data_type.script_type_ref = Ref<Script>();
+	}
+	for (KeyValue<StringName, GDScript::MemberInfo> &E : p_script->static_variables_indices) {
+		E.value.data_type.script_type_ref = Ref<Script>();
+	}
+	for (KeyValue<StringName, Ref<GDScript>> &E : p_script->subclasses) {
+		_release_export_copy(E.value.ptr());
+	}
+}
+
+Vector<uint8_t> GDScriptBytecodeCache::compile_for_export(const String &p_path, const String &p_source, const Vector<uint8_t> &p_binary_tokens, bool p_debug) {
+	// Make sure other scripts of the project refer to the cached script while this copy is compiled.
+	Error err = OK;
+	Ref<GDScript> cached = GDScriptCache::get_full_script(p_path, err);
+	if (err != OK) {
+		return Vector<uint8_t>();
+	}
+
+	GDScriptParser parser;
+	err = parser.parse(p_source, p_path, false);
+	if (err == OK) {
+		GDScriptAnalyzer analyzer(&parser);
+		err = analyzer.analyze();
+	}
+	if (err != OK) {
+		return Vector<uint8_t>();
+	}
+
+	Ref<GDScript> script;
+	script.instantiate();
+	script->path = p_path;
+	script->path_valid = true;
+
+	GDScriptCompiler compiler;
+	compiler.set_export_target(p_debug);
+	err = compiler.compile(&parser, script.ptr(), false);
+	if (err != OK) {
+		_release_export_copy(script.ptr());
+		return Vector<uint8_t>();
+	}
+
+	uint32_t flags = 0;
+	if (p_debug) {
+		flags |= FLAG_DEBUG_CODEGEN | FLAG_TRACK_LOCALS;
+	}
+	if (parser.get_tree()->annotated_static_unload) {
+		flags |= FLAG_STATIC_UNLOAD;
+	}
+
+	String error;
+	Vector<uint8_t> buffer = serialize(script.ptr(), get_source_hash(p_source, p_binary_tokens), flags, &error);
+	_release_export_copy(script.ptr());
+	if (buffer.is_empty()) {
+		WARN_PRINT(vformat(R"(Could not precompile "%s", it will be compiled when loaded: %s)", p_path, error));
+	}
+	return buffer;
+}
+
+#endif // TOOLS_ENABLED
@@ -0,0 +1,65 @@
+/**************************************************************************/
+/*  gdscript_bytecode_cache.h                                             */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GODOT ENGINE                               */
+/*                        https://godotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#pragma once
+
+#include "gdscript.h"
+
+// Serialized form of fully compiled GDScript classes, written next to exported scripts so they can
+// skip parsing, analysis and compilation at load time. Blobs are only valid for the exact engine
+// build, target (debug or release) and source they were made from. Anything else is rejected and
+// the script is compiled from source as usual.
+class GDScriptBytecodeCache {
+	class Reader;
+#ifdef TOOLS_ENABLED
+	class Writer;
+
+	static void _release_export_copy(GDScript *p_script);
+#endif
+
+public:
+	enum Flags {
+		FLAG_DEBUG_CODEGEN = 1 << 0,
+		FLAG_TRACK_LOCALS = 1 << 1,
+		FLAG_STATIC_UNLOAD = 1 << 2,
+	};
+
+	static uint32_t get_engine_hash();
+	static uint32_t get_source_hash(const String &p_source, const Vector<uint8_t> &p_binary_tokens);
+
+	// Creates the inner class objects, like `GDScriptCompiler::make_scripts()` does for shallow scripts.
+	static Error make_scripts(GDScript *p_script, const Vector<uint8_t> &p_buffer);
+	static Error load(GDScript *p_script, const Vector<uint8_t> &p_buffer);
+
+#ifdef TOOLS_ENABLED
+	static Vector<uint8_t> serialize(GDScript *p_script, uint32_t p_source_hash, uint32_t p_flags, String *r_error = nullptr);
+	static Vector<uint8_t> compile_for_export(const String &p_path, const String &p_source, const Vector<uint8_t> &p_binary_tokens, bool p_debug);
+#endif
+};
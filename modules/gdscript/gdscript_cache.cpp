@@ -32,10 +32,13 @@
 
 #include "gdscript.h"
 #include "gdscript_analyzer.h"
+#include "gdscript_bytecode_cache.h"
 #include "gdscript_compiler.h"
 #include "gdscript_parser.h"
 
 #include "core/io/file_access.h"
+#include "core/object/worker_thread_pool.h"
+#include "core/os/os.h"
 #include "core/templates/vector.h"
 
 GDScriptParserRef::Status GDScriptParserRef::get_status() const {
@@ -64,6 +67,19 @@ GDScriptAnalyzer *GDScriptParserRef::get_analyzer() {
 	return analyzer;
 }
 
+void GDScriptParserRef::_parse() {
+	String remapped_path = ResourceLoader::path_remap(path);
+	if (remapped_path.get_extension().to_lower() == "gdc") {
+		Vector<uint8_t> tokens = GDScriptCache::get_binary_tokens(remapped_path);
+		source_hash = hash_djb2_buffer(tokens.ptr(), tokens.size());
+		result = get_parser()->parse_binary(tokens, path);
+	} else {
+		String source = GDScriptCache::get_source_code(remapped_path);
+		source_hash = source.hash();
+		result = get_parser()->parse(source, path, false);
+	}
+}
+
 Error GDScriptParserRef::raise_status(Status p_new_status) {
 	ERR_FAIL_COND_V(clearing, ERR_BUG);
 	ERR_FAIL_COND_V(parser == nullptr && status != EMPTY, ERR_BUG);
@@ -75,16 +91,7 @@ Error GDScriptParserRef::raise_status(Status p_new_status) {
 				// It's ok if its the first thing done here.
 				get_parser()->clear();
 				status = PARSED;
-				String remapped_path = ResourceLoader::path_remap(path);
-				if (remapped_path.get_extension().to_lower() == "gdc") {
-					Vector<uint8_t> tokens = GDScriptCache::get_binary_tokens(remapped_path);
-					source_hash = hash_djb2_buffer(tokens.ptr(), tokens.size());
-					result = get_parser()->parse_binary(tokens, path);
-				} else {
-					String source = GDScriptCache::get_source_code(remapped_path);
-					source_hash = source.hash();
-					result = get_parser()->parse(source, path, false);
-				}
+				_parse();
 			} break;
 			case PARSED: {
 				status = INHERITANCE_SOLVED;
@@ -207,6 +214,7 @@ void GDScriptCache::remove_script(const String &p_path) {
 	singleton->dependencies.erase(p_path);
 	singleton->shallow_gdscript_cache.erase(p_path);
 	singleton->full_gdscript_cache.erase(p_path);
+	singleton->parsed_scripts.erase(p_path);
 }
 
 Ref<GDScriptParserRef> GDScriptCache::get_parser(const String &p_path, GDScriptParserRef::Status p_status, Error &r_error, const String &p_owner) {
@@ -295,6 +303,100 @@ Vector<uint8_t> GDScriptCache::get_binary_tokens(const String &p_path) {
 	return buffer;
 }
 
+bool GDScriptCache::has_precompiled_bytecode(const String &p_path) {
+	// Only exports write bytecode next to scripts, don't probe the file system otherwise.
+	return OS::get_singleton()->has_feature("template") && FileAccess::exists(p_path.get_basename() + ".gdbc");
+}
+
+Vector<uint8_t> GDScriptCache::get_precompiled_bytecode(const String &p_path) {
+	if (!has_precompiled_bytecode(p_path)) {
+		return Vector<uint8_t>();
+	}
+	return FileAccess::get_file_as_bytes(p_path.get_basename() + ".gdbc");
+}
+
+void GDScriptCache::_parse_script_task(void *p_userdata, uint32_t p_index) {
+	ParseTask *tasks = static_cast<ParseTask *>(p_userdata);
+	GDScriptParserRef *parser_ref = tasks[p_index].parser_ref.ptr();
+	parser_ref->status = GDScriptParserRef::PARSED;
+	parser_ref->_parse();
+}
+
+void GDScriptCache::parse_scripts(const Vector<String> &p_paths, bool p_update_from_disk) {
+	// Tokenizing and parsing only depend on the file itself, so they can run without the cache lock
+	// and concurrently. Analysis and compilation still happen one script at a time in `GDScript::reload()`.
+	LocalVector<ParseTask> tasks;
+	{
+		MutexLock lock(singleton->mutex);
+
+		for (const String &path : p_paths) {
+			if (path.is_empty() || singleton->parsed_scripts.has(path)) {
+				continue;
+			}
+			if (!p_update_from_disk && singleton->full_gdscript_cache.has(path)) {
+				continue;
+			}
+			if (!FileAccess::exists(ResourceLoader::path_remap(path)) || has_precompiled_bytecode(path)) {
+				continue;
+			}
+
+			ParseTask task;
+			task.parser_ref.instantiate();
+			task.parser_ref->path = path;
+			task.parser_ref->abandoned = true; // Not part of `parser_map`.
+			// Create the parsers on this thread, the first one sets up tables shared by all of them.
+			task.parser_ref->get_parser();
+			tasks.push_back(task);
+		}
+	}
+
+	if (tasks.is_empty()) {
+		return;
+	}
+
+	// Also filled on first use.
+	GDScriptParser::get_builtin_type(StringName());
+
+	if (tasks.size() == 1) {
+		_parse_script_task(tasks.ptr(), 0);
+	} else {
+		WorkerThreadPool::GroupID group_task = WorkerThreadPool::get_singleton()->add_native_group_task(&_parse_script_task, tasks.ptr(), tasks.size(), -1, false, String("GDScriptParseScripts"));
+		WorkerThreadPool::get_singleton()->wait_for_group_task_completion(group_task);
+	}
+
+	MutexLock lock(singleton->mutex);
+	for (const ParseTask &task : tasks) {
+		// Scripts that failed to parse are parsed again when compiled, which reports the errors.
+		if (task.parser_ref->result == OK) {
+			singleton->parsed_scripts[task.parser_ref->path] = task.parser_ref;
+		}
+	}
+}
+
+Ref<GDScriptParserRef> GDScriptCache::take_parsed_script(const String &p_path, uint32_t p_source_hash) {
+	MutexLock lock(singleton->mutex);
+
+	HashMap<String, Ref<GDScriptParserRef>>::Iterator E = singleton->parsed_scripts.find(p_path);
+	if (!E) {
+		return Ref<GDScriptParserRef>();
+	}
+
+	Ref<GDScriptParserRef> parser_ref = E->value;
+	singleton->parsed_scripts.remove(E);
+	if (parser_ref->source_hash != p_source_hash) {
+		return Ref<GDScriptParserRef>(); // Changed since it was parsed.
+	}
+	return parser_ref;
+}
+
+void GDScriptCache::discard_parsed_scripts(const Vector<String> &p_paths) {
+	// Scripts of the batch that were never compiled, e.g. because they failed earlier or used bytecode.
+	MutexLock lock(singleton->mutex);
+	for (const String &path : p_paths) {
+		singleton->parsed_scripts.erase(path);
+	}
+}
+
 Ref<GDScript> GDScriptCache::get_shallow_script(const String &p_path, Error &r_error, const String &p_owner) {
 	MutexLock lock(singleton->mutex);
 
@@ -327,9 +429,14 @@ Ref<GDScript> GDScriptCache::get_shallow_script(const String &p_path, Error &r_e
 		return Ref<GDScript>(); // Returns null and does not cache when the script fails to load.
 	}
 
-	Ref<GDScriptParserRef> parser_ref = get_parser(p_path, GDScriptParserRef::PARSED, r_error);
-	if (r_error == OK) {
-		GDScriptCompiler::make_scripts(script.ptr(), parser_ref->get_parser()->get_tree(), true);
+	const Vector<uint8_t> bytecode = get_precompiled_bytecode(p_path);
+	if (!bytecode.is_empty() && GDScriptBytecodeCache::make_scripts(script.ptr(), bytecode) == OK) {
+		script->set_precompiled_bytecode_source(bytecode);
+	} else {
+		Ref<GDScriptParserRef> parser_ref = get_parser(p_path, GDScriptParserRef::PARSED, r_error);
+		if (r_error == OK) {
+			GDScriptCompiler::make_scripts(script.ptr(), parser_ref->get_parser()->get_tree(), true);
+		}
 	}
 
 	singleton->shallow_gdscript_cache[p_path] = script;
@@ -483,6 +590,7 @@ void GDScriptCache::clear() {
 	}
 
 	parser_map_refs.clear();
+	singleton->parsed_scripts.clear();
 	singleton->shallow_gdscript_cache.clear();
 	singleton->full_gdscript_cache.clear();
 	singleton->static_gdscript_cache.clear();
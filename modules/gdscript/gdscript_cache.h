@@ -65,6 +65,8 @@ private:
 	friend class GDScriptCache;
 	friend class GDScript;
 
+	void _parse();
+
 public:
 	Status get_status() const;
 	String get_path() const;
@@ -87,6 +89,7 @@ class GDScriptCache {
 	HashMap<String, Ref<GDScript>> static_gdscript_cache;
 	HashMap<String, HashSet<String>> dependencies;
 	HashMap<String, HashSet<String>> parser_inverse_dependencies;
+	HashMap<String, Ref<GDScriptParserRef>> parsed_scripts; // Parsed ahead of compilation, see `parse_scripts()`. Only holds the current batch.
 
 	friend class GDScript;
 	friend class GDScriptParserRef;
@@ -103,6 +106,12 @@ private:
 	static SafeBinaryMutex<BINARY_MUTEX_TAG> mutex;
 	friend SafeBinaryMutex<BINARY_MUTEX_TAG> &_get_gdscript_cache_mutex();
 
+	struct ParseTask {
+		Ref<GDScriptParserRef> parser_ref;
+	};
+
+	static void _parse_script_task(void *p_userdata, uint32_t p_index);
+
 public:
 	static void move_script(const String &p_from, const String &p_to);
 	static void remove_script(const String &p_path);
@@ -111,6 +120,11 @@ public:
 	static void remove_parser(const String &p_path);
 	static String get_source_code(const String &p_path);
 	static Vector<uint8_t> get_binary_tokens(const String &p_path);
+	static bool has_precompiled_bytecode(const String &p_path);
+	static Vector<uint8_t> get_precompiled_bytecode(const String &p_path);
+	static void parse_scripts(const Vector<String> &p_paths, bool p_update_from_disk = false);
+	static Ref<GDScriptParserRef> take_parsed_script(const String &p_path, uint32_t p_source_hash);
+	static void discard_parsed_scripts(const Vector<String> &p_paths);
 	static Ref<GDScript> get_shallow_script(const String &p_path, Error &r_error, const String &p_owner = String());
 	static Ref<GDScript> get_full_script(const String &p_path, Error &r_error, const String &p_owner = String(), bool p_update_from_disk = false);
 	static Ref<GDScript> get_cached_script(const String &p_path);
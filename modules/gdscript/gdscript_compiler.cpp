@@ -1905,7 +1905,9 @@ Error GDScriptCompiler::_parse_block(CodeGen &codegen, const GDScriptParser::Sui
 
 #ifdef DEBUG_ENABLED
 		// Add a newline before each statement, since the debugger needs those.
-		gen->write_newline(s->start_line);
+		if (debug_codegen) {
+			gen->write_newline(s->start_line);
+		}
 #endif
 
 		switch (s->type) {
@@ -1957,7 +1959,9 @@ Error GDScriptCompiler::_parse_block(CodeGen &codegen, const GDScriptParser::Sui
 
 #ifdef DEBUG_ENABLED
 					// Add a newline before each branch, since the debugger needs those.
-					gen->write_newline(branch->start_line);
+					if (debug_codegen) {
+						gen->write_newline(branch->start_line);
+					}
 #endif
 					// For each pattern in branch.
 					GDScriptCodeGenerator::Address pattern_result = codegen.add_temporary();
@@ -2145,6 +2149,10 @@ Error GDScriptCompiler::_parse_block(CodeGen &codegen, const GDScriptParser::Sui
 			} break;
 			case GDScriptParser::Node::ASSERT: {
 #ifdef DEBUG_ENABLED
+				if (!debug_codegen) {
+					break; // Assertions are stripped from release targets.
+				}
+
 				const GDScriptParser::AssertNode *as = static_cast<const GDScriptParser::AssertNode *>(s);
 
 				GDScriptCodeGenerator::Address condition = _parse_expression(codegen, err, as->condition);
@@ -2172,7 +2180,9 @@ Error GDScriptCompiler::_parse_block(CodeGen &codegen, const GDScriptParser::Sui
 			} break;
 			case GDScriptParser::Node::BREAKPOINT: {
 #ifdef DEBUG_ENABLED
-				gen->write_breakpoint();
+				if (debug_codegen) {
+					gen->write_breakpoint();
+				}
 #endif
 			} break;
 			case GDScriptParser::Node::VARIABLE: {
@@ -2252,7 +2262,9 @@ Error GDScriptCompiler::_parse_block(CodeGen &codegen, const GDScriptParser::Sui
 GDScriptFunction *GDScriptCompiler::_parse_function(Error &r_error, GDScript *p_script, const GDScriptParser::ClassNode *p_class, const GDScriptParser::FunctionNode *p_func, bool p_for_ready, bool p_for_lambda) {
 	r_error = OK;
 	CodeGen codegen;
-	codegen.generator = memnew(GDScriptByteCodeGenerator);
+	GDScriptByteCodeGenerator *generator = memnew(GDScriptByteCodeGenerator);
+	generator->set_track_locals(track_locals);
+	codegen.generator = generator;
 
 	codegen.class_node = p_class;
 	codegen.script = p_script;
@@ -2492,7 +2504,9 @@ GDScriptFunction *GDScriptCompiler::_parse_function(Error &r_error, GDScript *p_
 GDScriptFunction *GDScriptCompiler::_make_static_initializer(Error &r_error, GDScript *p_script, const GDScriptParser::ClassNode *p_class) {
 	r_error = OK;
 	CodeGen codegen;
-	codegen.generator = memnew(GDScriptByteCodeGenerator);
+	GDScriptByteCodeGenerator *generator = memnew(GDScriptByteCodeGenerator);
+	generator->set_track_locals(track_locals);
+	codegen.generator = generator;
 
 	codegen.class_node = p_class;
 	codegen.script = p_script;
@@ -2698,6 +2712,7 @@ Error GDScriptCompiler::_prepare_compilation(GDScript *p_script, const GDScriptP
 	p_script->member_functions.clear();
 	p_script->member_indices.clear();
 	p_script->static_variables_indices.clear();
+	GDScriptFunction::invalidate_inline_caches(); // Member layout changes.
 	p_script->static_variables.clear();
 	p_script->_signals.clear();
 	p_script->initializer = nullptr;
@@ -3285,8 +3300,9 @@ Error GDScriptCompiler::compile(const GDScriptParser *p_parser, GDScript *p_scri
 	HashMap<GDScriptFunction *, GDScriptFunction *> func_ptr_replacements;
 	_get_function_ptr_replacements(func_ptr_replacements, old_lambda_info, &new_lambda_info);
 	main_script->_recurse_replace_function_ptrs(func_ptr_replacements);
+	GDScriptFunction::invalidate_inline_caches();
 
-	if (has_static_data && !root->annotated_static_unload) {
+	if (has_static_data && !root->annotated_static_unload && !exporting) {
 		GDScriptCache::add_static_script(p_script);
 	}
 
@@ -3309,5 +3325,11 @@ int GDScriptCompiler::get_error_column() const {
 	return err_column;
 }
 
+void GDScriptCompiler::set_export_target(bool p_debug) {
+	exporting = true;
+	debug_codegen = p_debug;
+	track_locals = p_debug;
+}
+
 GDScriptCompiler::GDScriptCompiler() {
 }
@@ -174,11 +174,19 @@ class GDScriptCompiler {
 	GDScriptParser::ExpressionNode *awaited_node = nullptr;
 	bool has_static_data = false;
 
+	// Line markers, assertions and breakpoints are only emitted for debug targets.
+	bool debug_codegen = true;
+	bool track_locals = false;
+	bool exporting = false;
+
 public:
 	static void convert_to_initializer_type(Variant &p_variant, const GDScriptParser::VariableNode *p_node);
 	static void make_scripts(GDScript *p_script, const GDScriptParser::ClassNode *p_class, bool p_keep_state);
 	Error compile(const GDScriptParser *p_parser, GDScript *p_script, bool p_keep_state = false);
 
+	// Generate code for an exported build instead of the running one, see `GDScriptBytecodeCache`.
+	void set_export_target(bool p_debug);
+
 	String get_error() const;
 	int get_error_line() const;
 	int get_error_column() const;
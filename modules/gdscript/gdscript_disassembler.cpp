@@ -141,6 +141,89 @@ void GDScriptFunction::disassemble(const Vector<String> &p_code_lines) const {
 
 				incr += 5;
 			} break;
+			case OPCODE_OPERATOR_VALIDATED_JUMP_IF:
+			case OPCODE_OPERATOR_VALIDATED_JUMP_IF_NOT: {
+				text += "validated operator ";
+
+				text += DADDR(3);
+				text += " = ";
+				text += DADDR(1);
+				text += " ";
+				text += operator_names[_code_ptr[ip + 4]];
+				text += " ";
+				text += DADDR(2);
+				text += opcode == OPCODE_OPERATOR_VALIDATED_JUMP_IF ? "; jump-if " : "; jump-if-not ";
+				text += DADDR(3);
+				text += " to ";
+				text += itos(_code_ptr[ip + 5]);
+
+				incr += 6;
+			} break;
+			case OPCODE_OPERATOR_INT:
+			case OPCODE_OPERATOR_FLOAT: {
+				text += opcode == OPCODE_OPERATOR_INT ? "int operator " : "float operator ";
+
+				text += DADDR(3);
+				text += " = ";
+				text += DADDR(1);
+				text += " ";
+				text += Variant::get_operator_name(Variant::Operator(_code_ptr[ip + 4]));
+				text += " ";
+				text += DADDR(2);
+
+				incr += 5;
+			} break;
+			case OPCODE_OPERATOR_INT_JUMP_IF:
+			case OPCODE_OPERATOR_INT_JUMP_IF_NOT:
+			case OPCODE_OPERATOR_FLOAT_JUMP_IF:
+			case OPCODE_OPERATOR_FLOAT_JUMP_IF_NOT: {
+				text += (opcode == OPCODE_OPERATOR_INT_JUMP_IF || opcode == OPCODE_OPERATOR_INT_JUMP_IF_NOT) ? "int operator " : "float operator ";
+
+				text += DADDR(3);
+				text += " = ";
+				text += DADDR(1);
+				text += " ";
+				text += Variant::get_operator_name(Variant::Operator(_code_ptr[ip + 4]));
+				text += " ";
+				text += DADDR(2);
+				text += (opcode == OPCODE_OPERATOR_INT_JUMP_IF || opcode == OPCODE_OPERATOR_FLOAT_JUMP_IF) ? "; jump-if " : "; jump-if-not ";
+				text += DADDR(3);
+				text += " to ";
+				text += itos(_code_ptr[ip + 5]);
+
+				incr += 6;
+			} break;
+			case OPCODE_GET_NAMED_VALIDATED_OPERATOR_VALIDATED: {
+				text += "get_named validated ";
+				text += DADDR(2);
+				text += " = ";
+				text += DADDR(1);
+				text += "[\"";
+				text += getter_names[_code_ptr[ip + 3]];
+				text += "\"]; validated operator ";
+				text += DADDR(6);
+				text += " = ";
+				text += DADDR(4);
+				text += " ";
+				text += operator_names[_code_ptr[ip + 7]];
+				text += " ";
+				text += DADDR(5);
+
+				incr += 8;
+			} break;
+			case OPCODE_ADD_INT_ASSIGN:
+			case OPCODE_SUBTRACT_INT_ASSIGN: {
+				text += opcode == OPCODE_ADD_INT_ASSIGN ? "add int assign " : "subtract int assign ";
+				text += DADDR(5);
+				text += " = ";
+				text += DADDR(3);
+				text += " = ";
+				text += DADDR(1);
+				text += opcode == OPCODE_ADD_INT_ASSIGN ? " + " : " - ";
+				text += DADDR(2);
+
+				incr += 6;
+			} break;
 			case OPCODE_TYPE_TEST_BUILTIN: {
 				text += "type test ";
 				text += DADDR(1);
@@ -329,7 +412,7 @@ void GDScriptFunction::disassemble(const Vector<String> &p_code_lines) const {
 				text += _global_names_ptr[_code_ptr[ip + 3]];
 				text += "\"]";
 
-				incr += 4;
+				incr += 5;
 			} break;
 			case OPCODE_GET_NAMED_VALIDATED: {
 				text += "get_named validated ";
@@ -708,7 +791,7 @@ void GDScriptFunction::disassemble(const Vector<String> &p_code_lines) const {
 				}
 				text += ")";
 
-				incr = 5 + argc;
+				incr = 6 + argc;
 			} break;
 			case OPCODE_CALL_METHOD_BIND:
 			case OPCODE_CALL_METHOD_BIND_RET: {
@@ -31,6 +31,7 @@
 #include "gdscript_function.h"
 
 #include "gdscript.h"
+#include "gdscript_sampling_profiler.h"
 
 Variant GDScriptFunction::get_constant(int p_idx) const {
 	ERR_FAIL_INDEX_V(p_idx, constants.size(), "<errconst>");
@@ -104,6 +105,23 @@ void GDScriptFunction::debug_get_stack_member_state(int p_line, List<Pair<String
 	}
 }
 
+SafeNumeric<uint32_t> GDScriptFunction::inline_cache_epoch;
+
+void GDScriptFunction::InlineCache::insert(const Entry &p_entry) {
+	lock.lock();
+	version.increment(); // Odd while writing, so readers fall back to the slow path.
+	const uint32_t current_epoch = GDScriptFunction::inline_cache_epoch.get();
+	if (epoch != current_epoch) {
+		epoch = current_epoch;
+		count = 0;
+	}
+	if (count < MAX_ENTRIES) {
+		entries[count++] = p_entry;
+	}
+	version.increment();
+	lock.unlock();
+}
+
 GDScriptFunction::GDScriptFunction() {
 	name = "<anonymous>";
 #ifdef DEBUG_ENABLED
@@ -115,12 +133,23 @@ GDScriptFunction::GDScriptFunction() {
 }
 
 GDScriptFunction::~GDScriptFunction() {
+	if (unlikely(GDScriptLanguage::sampling)) {
+		// Pending samples may point to this function.
+		GDScriptSamplingProfiler::resolve_samples();
+	}
+
 	get_script()->member_functions.erase(name);
 
 	for (int i = 0; i < lambdas.size(); i++) {
 		memdelete(lambdas[i]);
 	}
 
+	if (_inline_caches_ptr) {
+		memdelete_arr(_inline_caches_ptr);
+	}
+	// Other functions may have cached this one.
+	invalidate_inline_caches();
+
 	for (int i = 0; i < argument_types.size(); i++) {
 		argument_types.write[i].script_type_ref = Ref<Script>();
 	}
@@ -34,6 +34,7 @@
 
 #include "core/object/ref_counted.h"
 #include "core/object/script_language.h"
+#include "core/os/spin_lock.h"
 #include "core/os/thread.h"
 #include "core/string/string_name.h"
 #include "core/templates/pair.h"
@@ -256,6 +257,17 @@ public:
 	enum Opcode {
 		OPCODE_OPERATOR,
 		OPCODE_OPERATOR_VALIDATED,
+		OPCODE_OPERATOR_VALIDATED_JUMP_IF,
+		OPCODE_OPERATOR_VALIDATED_JUMP_IF_NOT,
+		OPCODE_GET_NAMED_VALIDATED_OPERATOR_VALIDATED,
+		OPCODE_ADD_INT_ASSIGN,
+		OPCODE_SUBTRACT_INT_ASSIGN,
+		OPCODE_OPERATOR_INT,
+		OPCODE_OPERATOR_INT_JUMP_IF,
+		OPCODE_OPERATOR_INT_JUMP_IF_NOT,
+		OPCODE_OPERATOR_FLOAT,
+		OPCODE_OPERATOR_FLOAT_JUMP_IF,
+		OPCODE_OPERATOR_FLOAT_JUMP_IF_NOT,
 		OPCODE_TYPE_TEST_BUILTIN,
 		OPCODE_TYPE_TEST_ARRAY,
 		OPCODE_TYPE_TEST_DICTIONARY,
@@ -439,10 +451,67 @@ public:
 		StringName identifier;
 	};
 
+	// Per call site cache for untyped member access and method calls on objects, keyed by the
+	// receiver's class and script. Entries are only added under the lock and readers validate
+	// them against `version`, so concurrent calls never use a half written entry.
+	struct InlineCache {
+		enum Kind {
+			KIND_METHOD_BIND,
+			KIND_SCRIPT_FUNCTION,
+			KIND_MEMBER,
+			KIND_PROPERTY_GETTER,
+		};
+
+		struct Entry {
+			const void *class_key = nullptr;
+			const GDScript *script = nullptr;
+			Kind kind = KIND_METHOD_BIND;
+			MethodBind *method = nullptr;
+			GDScriptFunction *function = nullptr;
+			int member_index = -1;
+		};
+
+		static constexpr int MAX_ENTRIES = 4; // Past this the site is megamorphic and left uncached.
+
+		SafeNumeric<uint32_t> version;
+		uint32_t epoch = 0;
+		int count = 0;
+		Entry entries[MAX_ENTRIES];
+		SpinLock lock;
+
+		_FORCE_INLINE_ bool is_full() const {
+			return count >= MAX_ENTRIES && epoch == GDScriptFunction::inline_cache_epoch.get();
+		}
+
+		_FORCE_INLINE_ bool find(const void *p_class_key, const GDScript *p_script, Entry &r_entry) const {
+			const uint32_t v = version.get();
+			if ((v & 1) || epoch != GDScriptFunction::inline_cache_epoch.get()) {
+				return false;
+			}
+			bool found = false;
+			for (int i = 0; i < count; i++) {
+				if (entries[i].class_key == p_class_key && entries[i].script == p_script) {
+					r_entry = entries[i];
+					found = true;
+					break;
+				}
+			}
+			std::atomic_thread_fence(std::memory_order_acquire);
+			return found && version.get() == v;
+		}
+
+		void insert(const Entry &p_entry);
+	};
+
+	// Bumped whenever script functions or member layouts may have changed, which drops every cached entry.
+	static SafeNumeric<uint32_t> inline_cache_epoch;
+	static void invalidate_inline_caches() { inline_cache_epoch.increment(); }
+
 private:
 	friend class GDScript;
 	friend class GDScriptCompiler;
 	friend class GDScriptByteCodeGenerator;
+	friend class GDScriptBytecodeCache;
 	friend class GDScriptLanguage;
 
 	StringName name;
@@ -481,6 +550,7 @@ private:
 	Vector<GDScriptUtilityFunctions::FunctionPtr> gds_utilities;
 	Vector<MethodBind *> methods;
 	Vector<GDScriptFunction *> lambdas;
+	Vector<int> global_index_positions; // Code positions holding global array indices, which differ between builds.
 
 	int _code_size = 0;
 	int _default_arg_count = 0;
@@ -499,6 +569,7 @@ private:
 	int _gds_utilities_count = 0;
 	int _methods_count = 0;
 	int _lambdas_count = 0;
+	int _inline_cache_count = 0;
 
 	int *_code_ptr = nullptr;
 	const int *_default_arg_ptr = nullptr;
@@ -517,6 +588,7 @@ private:
 	const GDScriptUtilityFunctions::FunctionPtr *_gds_utilities_ptr = nullptr;
 	MethodBind **_methods_ptr = nullptr;
 	GDScriptFunction **_lambdas_ptr = nullptr;
+	InlineCache *_inline_caches_ptr = nullptr;
 
 #ifdef DEBUG_ENABLED
 	CharString func_cname;
@@ -551,6 +623,10 @@ private:
 	} profile;
 #endif
 
+	static bool _get_inline_cache_receiver(const Variant *p_base, bool p_validate, Object *&r_object, GDScriptInstance *&r_instance, const GDScript *&r_script);
+	bool _inline_cache_call(InlineCache &p_cache, Variant *p_base, const StringName &p_method, const Variant **p_args, int p_argcount, Variant &r_ret, Callable::CallError &r_err);
+	bool _inline_cache_get_named(InlineCache &p_cache, const Variant *p_base, const StringName &p_name, Variant &r_ret);
+
 	_FORCE_INLINE_ String _get_call_error(const String &p_where, const Variant **p_argptrs, const Variant &p_ret, const Callable::CallError &p_err) const;
 	Variant _get_default_variant_for_data_type(const GDScriptDataType &p_data_type);
 
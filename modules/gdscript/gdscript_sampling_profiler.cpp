@@ -0,0 +1,213 @@
+/**************************************************************************/
+/*  gdscript_sampling_profiler.cpp                                        */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GODOT ENGINE                               */
+/*                        https://godotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#include "gdscript_sampling_profiler.h"
+
+#include "gdscript.h"
+
+#include "core/debugger/engine_debugger.h"
+#include "core/io/file_access.h"
+#include "core/os/os.h"
+
+GDScriptSamplingProfiler *GDScriptSamplingProfiler::active = nullptr;
+
+uint32_t GDScriptSamplingProfiler::Sample::hash(const Sample &p_sample) {
+	uint32_t h = hash_murmur3_one_64(p_sample.thread_id);
+	for (const Frame &frame : p_sample.frames) {
+		h = hash_murmur3_one_64((uint64_t)frame.function, h);
+		h = hash_murmur3_one_64((uint64_t)frame.native_call, h);
+	}
+	return hash_fmix32(h);
+}
+
+bool GDScriptSamplingProfiler::Sample::operator==(const Sample &p_other) const {
+	if (thread_id != p_other.thread_id || frames.size() != p_other.frames.size()) {
+		return false;
+	}
+	for (uint32_t i = 0; i < frames.size(); i++) {
+		if (frames[i].function != p_other.frames[i].function || frames[i].native_call != p_other.frames[i].native_call) {
+			return false;
+		}
+	}
+	return true;
+}
+
+void GDScriptSamplingProfiler::_thread_func(void *p_user) {
+	GDScriptSamplingProfiler *profiler = static_cast<GDScriptSamplingProfiler *>(p_user);
+	while (profiler->running.is_set()) {
+		OS::get_singleton()->delay_usec(profiler->interval_usec);
+		profiler->_take_samples();
+	}
+}
+
+void GDScriptSamplingProfiler::_take_samples() {
+	// The profiled threads are never stopped, so the levels are read while they change. Each level
+	// is written before the stack position is increased, which at worst makes a sample miss a frame.
+	MutexLock lock(GDScriptLanguage::call_stacks_mutex);
+
+	Sample sample;
+	for (const GDScriptLanguage::CallStack *call_stack : GDScriptLanguage::call_stacks) {
+		const int stack_pos = call_stack->stack_pos;
+		if (stack_pos <= 0) {
+			continue;
+		}
+
+		sample.thread_id = call_stack->thread_id;
+		sample.frames.clear();
+		for (int i = 0; i < stack_pos; i++) {
+			const GDScriptLanguage::CallLevel &level = call_stack->levels[i];
+			sample.frames.push_back({ level.function, level.native_call });
+		}
+
+		HashMap<Sample, uint32_t, Sample>::Iterator E = samples.find(sample);
+		if (E) {
+			E->value++;
+		} else {
+			samples.insert(sample, 1);
+		}
+	}
+}
+
+void GDScriptSamplingProfiler::_resolve_samples() {
+	HashMap<const GDScriptFunction *, String> function_names;
+	for (const KeyValue<Sample, uint32_t> &E : samples) {
+		String stack = E.key.thread_id == Thread::get_main_id() ? String("Main Thread") : vformat("Thread %d", E.key.thread_id);
+		for (const Frame &frame : E.key.frames) {
+			if (frame.function) {
+				HashMap<const GDScriptFunction *, String>::Iterator F = function_names.find(frame.function);
+				if (!F) {
+					F = function_names.insert(frame.function, vformat("%s::%s", frame.function->get_script()->get_script_path(), frame.function->get_name()));
+				}
+				stack += ";" + F->value;
+			}
+			if (frame.native_call) {
+				stack += vformat(";%s.%s", frame.native_call->get_instance_class(), frame.native_call->get_name());
+			}
+		}
+
+		HashMap<String, uint64_t>::Iterator S = pending_stacks.find(stack);
+		if (S) {
+			S->value += E.value;
+		} else {
+			pending_stacks.insert(stack, E.value);
+		}
+	}
+	samples.clear();
+}
+
+void GDScriptSamplingProfiler::resolve_samples() {
+	MutexLock lock(GDScriptLanguage::call_stacks_mutex);
+	if (active) {
+		active->_resolve_samples();
+	}
+}
+
+void GDScriptSamplingProfiler::_flush_stacks() {
+	Array lines;
+	{
+		MutexLock lock(GDScriptLanguage::call_stacks_mutex);
+		_resolve_samples();
+		for (const KeyValue<String, uint64_t> &E : pending_stacks) {
+			lines.push_back(vformat("%s %d", E.key, E.value));
+			if (!output_path.is_empty()) {
+				total_stacks[E.key] += E.value;
+			}
+		}
+		pending_stacks.clear();
+	}
+
+	if (!lines.is_empty() && EngineDebugger::is_active()) {
+		EngineDebugger::get_singleton()->send_message("gdscript:sampling", lines);
+	}
+}
+
+void GDScriptSamplingProfiler::_save_stacks() {
+	Ref<FileAccess> file = FileAccess::open(output_path, FileAccess::WRITE);
+	ERR_FAIL_COND_MSG(file.is_null(), vformat("Cannot write GDScript profile to \"%s\".", output_path));
+	for (const KeyValue<String, uint64_t> &E : total_stacks) {
+		file->store_line(vformat("%s %d", E.key, E.value));
+	}
+}
+
+void GDScriptSamplingProfiler::_stop() {
+	if (!running.is_set()) {
+		return;
+	}
+	running.clear();
+	thread.wait_to_finish();
+
+	GDScriptLanguage::sampling = false;
+	_flush_stacks();
+	{
+		MutexLock lock(GDScriptLanguage::call_stacks_mutex);
+		active = nullptr;
+	}
+
+	if (!output_path.is_empty()) {
+		_save_stacks();
+		total_stacks.clear();
+	}
+}
+
+void GDScriptSamplingProfiler::toggle(bool p_enable, const Array &p_opts) {
+	_stop();
+	if (!p_enable) {
+		return;
+	}
+
+	GDScriptLanguage *language = GDScriptLanguage::get_singleton();
+	ERR_FAIL_COND_MSG(!language->track_call_stack, R"(GDScript call stacks are not tracked in this build. Enable the "debug/settings/gdscript/always_track_call_stacks" project setting to sample them.)");
+	{
+		MutexLock lock(GDScriptLanguage::call_stacks_mutex);
+		ERR_FAIL_COND_MSG(active != nullptr, "Another GDScript sampling profiler is already running.");
+		active = this;
+	}
+
+	interval_usec = p_opts.size() > 0 ? MAX((int64_t)p_opts[0], 100) : 1000;
+	output_path = p_opts.size() > 1 ? String(p_opts[1]) : String();
+	last_send_time = OS::get_singleton()->get_ticks_msec();
+
+	GDScriptLanguage::sampling = true;
+	running.set();
+	thread.start(_thread_func, this);
+}
+
+void GDScriptSamplingProfiler::tick(double p_frame_time, double p_process_time, double p_physics_time, double p_physics_frame_time) {
+	const uint64_t time = OS::get_singleton()->get_ticks_msec();
+	if (time - last_send_time < SEND_INTERVAL_MSEC) {
+		return;
+	}
+	last_send_time = time;
+	_flush_stacks();
+}
+
+GDScriptSamplingProfiler::~GDScriptSamplingProfiler() {
+	_stop();
+}
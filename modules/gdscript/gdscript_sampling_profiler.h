@@ -0,0 +1,93 @@
+/**************************************************************************/
+/*  gdscript_sampling_profiler.h                                          */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GODOT ENGINE                               */
+/*                        https://godotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#pragma once
+
+#include "core/debugger/engine_profiler.h"
+#include "core/os/thread.h"
+#include "core/templates/hash_map.h"
+#include "core/templates/local_vector.h"
+#include "core/templates/safe_refcount.h"
+
+class GDScriptFunction;
+class MethodBind;
+
+// Periodically snapshots the GDScript call stack of every thread, instead of instrumenting each call.
+// Samples are aggregated into folded stacks ("frame;frame;frame count"), which flame graph tools read
+// directly. The innermost frame is the engine method being called, if any.
+class GDScriptSamplingProfiler : public EngineProfiler {
+	friend class TestGDScriptSamplingProfilerAccessor;
+
+	struct Frame {
+		const GDScriptFunction *function = nullptr;
+		const MethodBind *native_call = nullptr;
+	};
+
+	struct Sample {
+		Thread::ID thread_id = Thread::UNASSIGNED_ID;
+		LocalVector<Frame> frames;
+
+		static uint32_t hash(const Sample &p_sample);
+		bool operator==(const Sample &p_other) const;
+	};
+
+	static constexpr uint64_t SEND_INTERVAL_MSEC = 500;
+
+	static GDScriptSamplingProfiler *active;
+
+	Thread thread;
+	SafeFlag running;
+	uint64_t interval_usec = 1000;
+	uint64_t last_send_time = 0;
+	String output_path;
+
+	// Guarded by `GDScriptLanguage::call_stacks_mutex`. Samples only hold pointers, so they are
+	// resolved to names before any of the functions they point to is freed.
+	HashMap<Sample, uint32_t, Sample> samples;
+	HashMap<String, uint64_t> pending_stacks;
+
+	HashMap<String, uint64_t> total_stacks;
+
+	static void _thread_func(void *p_user);
+	void _take_samples();
+	void _resolve_samples();
+	void _flush_stacks();
+	void _save_stacks();
+	void _stop();
+
+public:
+	static void resolve_samples();
+
+	void toggle(bool p_enable, const Array &p_opts) override;
+	void add(const Array &p_data) override {}
+	void tick(double p_frame_time, double p_process_time, double p_physics_time, double p_physics_frame_time) override;
+
+	~GDScriptSamplingProfiler();
+};
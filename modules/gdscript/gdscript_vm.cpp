@@ -33,6 +33,7 @@
 #include "gdscript_lambda_callable.h"
 
 #include "core/os/os.h"
+#include "scene/scene_string_names.h"
 
 #ifdef DEBUG_ENABLED
 
@@ -115,6 +116,98 @@ void GDScriptFunction::_profile_native_call(uint64_t p_t_taken, const String &p_
 
 #endif // DEBUG_ENABLED
 
+// Typed int and float operators work on the payload of stack slots whose type the compiler
+// proved, without going through the variant evaluators. The destination already holds the
+// result type, as with validated operators.
+static _FORCE_INLINE_ void _evaluate_int_operator(int p_operator, const Variant *p_a, const Variant *p_b, Variant *r_dst) {
+	const int64_t a = *VariantInternal::get_int(p_a);
+	const int64_t b = *VariantInternal::get_int(p_b);
+	switch (p_operator) {
+		case Variant::OP_EQUAL:
+			*VariantInternal::get_bool(r_dst) = a == b;
+			break;
+		case Variant::OP_NOT_EQUAL:
+			*VariantInternal::get_bool(r_dst) = a != b;
+			break;
+		case Variant::OP_LESS:
+			*VariantInternal::get_bool(r_dst) = a < b;
+			break;
+		case Variant::OP_LESS_EQUAL:
+			*VariantInternal::get_bool(r_dst) = a <= b;
+			break;
+		case Variant::OP_GREATER:
+			*VariantInternal::get_bool(r_dst) = a > b;
+			break;
+		case Variant::OP_GREATER_EQUAL:
+			*VariantInternal::get_bool(r_dst) = a >= b;
+			break;
+		case Variant::OP_ADD:
+			*VariantInternal::get_int(r_dst) = a + b;
+			break;
+		case Variant::OP_SUBTRACT:
+			*VariantInternal::get_int(r_dst) = a - b;
+			break;
+		case Variant::OP_MULTIPLY:
+			*VariantInternal::get_int(r_dst) = a * b;
+			break;
+		case Variant::OP_BIT_AND:
+			*VariantInternal::get_int(r_dst) = a & b;
+			break;
+		case Variant::OP_BIT_OR:
+			*VariantInternal::get_int(r_dst) = a | b;
+			break;
+		case Variant::OP_BIT_XOR:
+			*VariantInternal::get_int(r_dst) = a ^ b;
+			break;
+		default:
+			break;
+	}
+}
+
+// Float operands may also be ints, which are promoted like the variant evaluators do.
+static _FORCE_INLINE_ double _get_float_operand(const Variant *p_value) {
+	return p_value->get_type() == Variant::FLOAT ? *VariantInternal::get_float(p_value) : double(*VariantInternal::get_int(p_value));
+}
+
+static _FORCE_INLINE_ void _evaluate_float_operator(int p_operator, const Variant *p_a, const Variant *p_b, Variant *r_dst) {
+	const double a = _get_float_operand(p_a);
+	const double b = _get_float_operand(p_b);
+	switch (p_operator) {
+		case Variant::OP_EQUAL:
+			*VariantInternal::get_bool(r_dst) = a == b;
+			break;
+		case Variant::OP_NOT_EQUAL:
+			*VariantInternal::get_bool(r_dst) = a != b;
+			break;
+		case Variant::OP_LESS:
+			*VariantInternal::get_bool(r_dst) = a < b;
+			break;
+		case Variant::OP_LESS_EQUAL:
+			*VariantInternal::get_bool(r_dst) = a <= b;
+			break;
+		case Variant::OP_GREATER:
+			*VariantInternal::get_bool(r_dst) = a > b;
+			break;
+		case Variant::OP_GREATER_EQUAL:
+			*VariantInternal::get_bool(r_dst) = a >= b;
+			break;
+		case Variant::OP_ADD:
+			*VariantInternal::get_float(r_dst) = a + b;
+			break;
+		case Variant::OP_SUBTRACT:
+			*VariantInternal::get_float(r_dst) = a - b;
+			break;
+		case Variant::OP_MULTIPLY:
+			*VariantInternal::get_float(r_dst) = a * b;
+			break;
+		case Variant::OP_DIVIDE:
+			*VariantInternal::get_float(r_dst) = a / b;
+			break;
+		default:
+			break;
+	}
+}
+
 Variant GDScriptFunction::_get_default_variant_for_data_type(const GDScriptDataType &p_data_type) {
 	if (p_data_type.kind == GDScriptDataType::BUILTIN) {
 		if (p_data_type.builtin_type == Variant::ARRAY) {
@@ -185,6 +278,169 @@ String GDScriptFunction::_get_call_error(const String &p_where, const Variant **
 	return "Bug: Invalid call error code " + itos(p_err.error) + ".";
 }
 
+bool GDScriptFunction::_get_inline_cache_receiver(const Variant *p_base, bool p_validate, Object *&r_object, GDScriptInstance *&r_instance, const GDScript *&r_script) {
+	Object *obj = p_validate ? p_base->get_validated_object() : p_base->operator Object *();
+	if (unlikely(!obj)) {
+		return false; // Let the regular path report the error.
+	}
+
+	r_object = obj;
+	r_instance = nullptr;
+	r_script = nullptr;
+
+	ScriptInstance *script_instance = obj->get_script_instance();
+	if (script_instance) {
+		if (script_instance->is_placeholder() || script_instance->get_language() != GDScriptLanguage::get_singleton()) {
+			return false;
+		}
+		r_instance = static_cast<GDScriptInstance *>(script_instance);
+		r_script = r_instance->script.ptr();
+	}
+	return true;
+}
+
+// Extension classes can handle names in their own callbacks and may be unloaded, so they are never cached.
+static _FORCE_INLINE_ bool _is_extension_class(const Object *p_object) {
+	const ClassDB::APIType api = ClassDB::get_api_type(p_object->get_class_name());
+	return api == ClassDB::API_EXTENSION || api == ClassDB::API_EDITOR_EXTENSION;
+}
+
+bool GDScriptFunction::_inline_cache_call(InlineCache &p_cache, Variant *p_base, const StringName &p_method, const Variant **p_args, int p_argcount, Variant &r_ret, Callable::CallError &r_err) {
+	Object *obj;
+	GDScriptInstance *instance;
+	const GDScript *script;
+#ifdef DEBUG_ENABLED
+	const bool validate = true;
+#else
+	const bool validate = false;
+#endif
+	if (!_get_inline_cache_receiver(p_base, validate, obj, instance, script)) {
+		return false;
+	}
+
+	const void *class_key = obj->get_class_name().data_unique_pointer();
+	InlineCache::Entry entry;
+	if (!p_cache.find(class_key, script, entry)) {
+		if (p_cache.is_full()) {
+			return false;
+		}
+		// Special cased by `Object::callp()` and `GDScriptInstance::callp()`.
+		if (p_method == CoreStringName(free_) || p_method == SceneStringName(_ready) || _is_extension_class(obj)) {
+			return false;
+		}
+
+		bool resolved = false;
+		for (const GDScript *sptr = script; sptr; sptr = sptr->_base) {
+			if (!sptr->valid) {
+				return false;
+			}
+			HashMap<StringName, GDScriptFunction *>::ConstIterator E = sptr->member_functions.find(p_method);
+			if (E) {
+				entry.kind = InlineCache::KIND_SCRIPT_FUNCTION;
+				entry.function = E->value;
+				resolved = true;
+				break;
+			}
+		}
+		if (!resolved) {
+			MethodBind *method = ClassDB::get_method(obj->get_class_name(), p_method);
+			if (!method) {
+				return false;
+			}
+			entry.kind = InlineCache::KIND_METHOD_BIND;
+			entry.method = method;
+		}
+
+		entry.class_key = class_key;
+		entry.script = script;
+		p_cache.insert(entry);
+	}
+
+	r_err.error = Callable::CallError::CALL_OK;
+	if (entry.kind == InlineCache::KIND_SCRIPT_FUNCTION) {
+		r_ret = entry.function->call(instance, p_args, p_argcount, r_err);
+	} else {
+		const bool sample_native_call = GDScriptLanguage::is_sampling();
+		if (unlikely(sample_native_call)) {
+			GDScriptLanguage::get_singleton()->set_native_call(entry.method);
+		}
+		r_ret = entry.method->call(obj, p_args, p_argcount, r_err);
+		if (unlikely(sample_native_call)) {
+			GDScriptLanguage::get_singleton()->set_native_call(nullptr);
+		}
+	}
+	return true;
+}
+
+bool GDScriptFunction::_inline_cache_get_named(InlineCache &p_cache, const Variant *p_base, const StringName &p_name, Variant &r_ret) {
+	Object *obj;
+	GDScriptInstance *instance;
+	const GDScript *script;
+	if (!_get_inline_cache_receiver(p_base, true, obj, instance, script)) {
+		return false;
+	}
+
+	const void *class_key = obj->get_class_name().data_unique_pointer();
+	InlineCache::Entry entry;
+	if (!p_cache.find(class_key, script, entry)) {
+		if (p_cache.is_full() || _is_extension_class(obj)) {
+			return false;
+		}
+
+		if (script) {
+			// Mirrors the lookup order of `GDScriptInstance::get()`.
+			HashMap<StringName, GDScript::MemberInfo>::ConstIterator M = script->member_indices.find(p_name);
+			if (M) {
+				if (!script->valid || M->value.getter) {
+					return false;
+				}
+				entry.kind = InlineCache::KIND_MEMBER;
+				entry.member_index = M->value.index;
+			} else {
+				for (const GDScript *sptr = script; sptr; sptr = sptr->_base) {
+					if (!sptr->valid || sptr->constants.has(p_name) || sptr->static_variables_indices.has(p_name) || sptr->_signals.has(p_name) || sptr->member_functions.has(p_name) || sptr->subclasses.has(p_name) || sptr->member_functions.has(GDScriptLanguage::get_singleton()->strings._get)) {
+						return false;
+					}
+				}
+			}
+		}
+
+		if (entry.member_index < 0) {
+			// Only plain native properties, see `ClassDB::get_property()`.
+			const StringName &class_name = obj->get_class_name();
+			bool has_property = false;
+			if (ClassDB::get_property_index(class_name, p_name, &has_property) >= 0 || !has_property) {
+				return false;
+			}
+			if (ClassDB::has_method(class_name, p_name) || ClassDB::has_signal(class_name, p_name) || ClassDB::has_integer_constant(class_name, p_name)) {
+				return false;
+			}
+			MethodBind *getter = ClassDB::get_method(class_name, ClassDB::get_property_getter(class_name, p_name));
+			if (!getter) {
+				return false;
+			}
+			entry.kind = InlineCache::KIND_PROPERTY_GETTER;
+			entry.method = getter;
+		}
+
+		entry.class_key = class_key;
+		entry.script = script;
+		p_cache.insert(entry);
+	}
+
+	if (entry.kind == InlineCache::KIND_MEMBER) {
+		if (unlikely(entry.member_index >= instance->members.size())) {
+			return false;
+		}
+		r_ret = instance->members[entry.member_index];
+	} else {
+		Callable::CallError ce;
+		const Variant value = entry.method->call(obj, nullptr, 0, ce);
+		r_ret = (ce.error == Callable::CallError::CALL_OK) ? value : Variant();
+	}
+	return true;
+}
+
 void (*type_init_function_table[])(Variant *) = {
 	nullptr, // NIL (shouldn't be called).
 	&VariantInitializer<bool>::init, // BOOL.
@@ -232,6 +488,17 @@ void (*type_init_function_table[])(Variant *) = {
 	static const void *switch_table_ops[] = {            \
 		&&OPCODE_OPERATOR,                               \
 		&&OPCODE_OPERATOR_VALIDATED,                     \
+		&&OPCODE_OPERATOR_VALIDATED_JUMP_IF,             \
+		&&OPCODE_OPERATOR_VALIDATED_JUMP_IF_NOT,         \
+		&&OPCODE_GET_NAMED_VALIDATED_OPERATOR_VALIDATED, \
+		&&OPCODE_ADD_INT_ASSIGN,                         \
+		&&OPCODE_SUBTRACT_INT_ASSIGN,                    \
+		&&OPCODE_OPERATOR_INT,                           \
+		&&OPCODE_OPERATOR_INT_JUMP_IF,                   \
+		&&OPCODE_OPERATOR_INT_JUMP_IF_NOT,               \
+		&&OPCODE_OPERATOR_FLOAT,                         \
+		&&OPCODE_OPERATOR_FLOAT_JUMP_IF,                 \
+		&&OPCODE_OPERATOR_FLOAT_JUMP_IF_NOT,             \
 		&&OPCODE_TYPE_TEST_BUILTIN,                      \
 		&&OPCODE_TYPE_TEST_ARRAY,                        \
 		&&OPCODE_TYPE_TEST_DICTIONARY,                   \
@@ -813,6 +1080,218 @@ Variant GDScriptFunction::call(GDScriptInstance *p_instance, const Variant **p_a
 			}
 			DISPATCH_OPCODE;
 
+			OPCODE(OPCODE_OPERATOR_VALIDATED_JUMP_IF) {
+				CHECK_SPACE(6);
+
+				int operator_idx = _code_ptr[ip + 4];
+				GD_ERR_BREAK(operator_idx < 0 || operator_idx >= _operator_funcs_count);
+				Variant::ValidatedOperatorEvaluator operator_func = _operator_funcs_ptr[operator_idx];
+
+				GET_VARIANT_PTR(a, 0);
+				GET_VARIANT_PTR(b, 1);
+				GET_VARIANT_PTR(dst, 2);
+
+				operator_func(a, b, dst);
+
+				if (*VariantInternal::get_bool(dst)) {
+					int to = _code_ptr[ip + 5];
+					GD_ERR_BREAK(to < 0 || to > _code_size);
+					ip = to;
+				} else {
+					ip += 6;
+				}
+			}
+			DISPATCH_OPCODE;
+
+			OPCODE(OPCODE_OPERATOR_VALIDATED_JUMP_IF_NOT) {
+				CHECK_SPACE(6);
+
+				int operator_idx = _code_ptr[ip + 4];
+				GD_ERR_BREAK(operator_idx < 0 || operator_idx >= _operator_funcs_count);
+				Variant::ValidatedOperatorEvaluator operator_func = _operator_funcs_ptr[operator_idx];
+
+				GET_VARIANT_PTR(a, 0);
+				GET_VARIANT_PTR(b, 1);
+				GET_VARIANT_PTR(dst, 2);
+
+				operator_func(a, b, dst);
+
+				if (!*VariantInternal::get_bool(dst)) {
+					int to = _code_ptr[ip + 5];
+					GD_ERR_BREAK(to < 0 || to > _code_size);
+					ip = to;
+				} else {
+					ip += 6;
+				}
+			}
+			DISPATCH_OPCODE;
+
+			OPCODE(OPCODE_GET_NAMED_VALIDATED_OPERATOR_VALIDATED) {
+				CHECK_SPACE(8);
+
+				int index_getter = _code_ptr[ip + 3];
+				GD_ERR_BREAK(index_getter < 0 || index_getter >= _getters_count);
+				const Variant::ValidatedGetter getter = _getters_ptr[index_getter];
+
+				int operator_idx = _code_ptr[ip + 7];
+				GD_ERR_BREAK(operator_idx < 0 || operator_idx >= _operator_funcs_count);
+				Variant::ValidatedOperatorEvaluator operator_func = _operator_funcs_ptr[operator_idx];
+
+				GET_VARIANT_PTR(src, 0);
+				GET_VARIANT_PTR(member, 1);
+				GET_VARIANT_PTR(a, 3);
+				GET_VARIANT_PTR(b, 4);
+				GET_VARIANT_PTR(dst, 5);
+
+				getter(src, member);
+				operator_func(a, b, dst);
+
+				ip += 8;
+			}
+			DISPATCH_OPCODE;
+
+			OPCODE(OPCODE_OPERATOR_INT) {
+				CHECK_SPACE(5);
+
+				GET_VARIANT_PTR(a, 0);
+				GET_VARIANT_PTR(b, 1);
+				GET_VARIANT_PTR(dst, 2);
+
+				_evaluate_int_operator(_code_ptr[ip + 4], a, b, dst);
+
+				ip += 5;
+			}
+			DISPATCH_OPCODE;
+
+			OPCODE(OPCODE_OPERATOR_INT_JUMP_IF) {
+				CHECK_SPACE(6);
+
+				GET_VARIANT_PTR(a, 0);
+				GET_VARIANT_PTR(b, 1);
+				GET_VARIANT_PTR(dst, 2);
+
+				_evaluate_int_operator(_code_ptr[ip + 4], a, b, dst);
+
+				if (*VariantInternal::get_bool(dst)) {
+					int to = _code_ptr[ip + 5];
+					GD_ERR_BREAK(to < 0 || to > _code_size);
+					ip = to;
+				} else {
+					ip += 6;
+				}
+			}
+			DISPATCH_OPCODE;
+
+			OPCODE(OPCODE_OPERATOR_INT_JUMP_IF_NOT) {
+				CHECK_SPACE(6);
+
+				GET_VARIANT_PTR(a, 0);
+				GET_VARIANT_PTR(b, 1);
+				GET_VARIANT_PTR(dst, 2);
+
+				_evaluate_int_operator(_code_ptr[ip + 4], a, b, dst);
+
+				if (!*VariantInternal::get_bool(dst)) {
+					int to = _code_ptr[ip + 5];
+					GD_ERR_BREAK(to < 0 || to > _code_size);
+					ip = to;
+				} else {
+					ip += 6;
+				}
+			}
+			DISPATCH_OPCODE;
+
+			OPCODE(OPCODE_OPERATOR_FLOAT) {
+				CHECK_SPACE(5);
+
+				GET_VARIANT_PTR(a, 0);
+				GET_VARIANT_PTR(b, 1);
+				GET_VARIANT_PTR(dst, 2);
+
+				_evaluate_float_operator(_code_ptr[ip + 4], a, b, dst);
+
+				ip += 5;
+			}
+			DISPATCH_OPCODE;
+
+			OPCODE(OPCODE_OPERATOR_FLOAT_JUMP_IF) {
+				CHECK_SPACE(6);
+
+				GET_VARIANT_PTR(a, 0);
+				GET_VARIANT_PTR(b, 1);
+				GET_VARIANT_PTR(dst, 2);
+
+				_evaluate_float_operator(_code_ptr[ip + 4], a, b, dst);
+
+				if (*VariantInternal::get_bool(dst)) {
+					int to = _code_ptr[ip + 5];
+					GD_ERR_BREAK(to < 0 || to > _code_size);
+					ip = to;
+				} else {
+					ip += 6;
+				}
+			}
+			DISPATCH_OPCODE;
+
+			OPCODE(OPCODE_OPERATOR_FLOAT_JUMP_IF_NOT) {
+				CHECK_SPACE(6);
+
+				GET_VARIANT_PTR(a, 0);
+				GET_VARIANT_PTR(b, 1);
+				GET_VARIANT_PTR(dst, 2);
+
+				_evaluate_float_operator(_code_ptr[ip + 4], a, b, dst);
+
+				if (!*VariantInternal::get_bool(dst)) {
+					int to = _code_ptr[ip + 5];
+					GD_ERR_BREAK(to < 0 || to > _code_size);
+					ip = to;
+				} else {
+					ip += 6;
+				}
+			}
+			DISPATCH_OPCODE;
+
+			OPCODE(OPCODE_ADD_INT_ASSIGN) {
+				CHECK_SPACE(6);
+
+				GET_VARIANT_PTR(a, 0);
+				GET_VARIANT_PTR(b, 1);
+				GET_VARIANT_PTR(dst, 2);
+				GET_VARIANT_PTR(target, 4);
+
+				const int64_t result = *VariantInternal::get_int(a) + *VariantInternal::get_int(b);
+				*VariantInternal::get_int(dst) = result;
+				if (likely(target->get_type() == Variant::INT)) {
+					*VariantInternal::get_int(target) = result;
+				} else {
+					*target = result;
+				}
+
+				ip += 6;
+			}
+			DISPATCH_OPCODE;
+
+			OPCODE(OPCODE_SUBTRACT_INT_ASSIGN) {
+				CHECK_SPACE(6);
+
+				GET_VARIANT_PTR(a, 0);
+				GET_VARIANT_PTR(b, 1);
+				GET_VARIANT_PTR(dst, 2);
+				GET_VARIANT_PTR(target, 4);
+
+				const int64_t result = *VariantInternal::get_int(a) - *VariantInternal::get_int(b);
+				*VariantInternal::get_int(dst) = result;
+				if (likely(target->get_type() == Variant::INT)) {
+					*VariantInternal::get_int(target) = result;
+				} else {
+					*target = result;
+				}
+
+				ip += 6;
+			}
+			DISPATCH_OPCODE;
+
 			OPCODE(OPCODE_TYPE_TEST_BUILTIN) {
 				CHECK_SPACE(4);
 
@@ -1209,7 +1688,7 @@ Variant GDScriptFunction::call(GDScriptInstance *p_instance, const Variant **p_a
 			DISPATCH_OPCODE;
 
 			OPCODE(OPCODE_GET_NAMED) {
-				CHECK_SPACE(4);
+				CHECK_SPACE(5);
 
 				GET_VARIANT_PTR(src, 0);
 				GET_VARIANT_PTR(dst, 1);
@@ -1219,22 +1698,35 @@ Variant GDScriptFunction::call(GDScriptInstance *p_instance, const Variant **p_a
 				GD_ERR_BREAK(indexname < 0 || indexname >= _global_names_count);
 				const StringName *index = &_global_names_ptr[indexname];
 
-				bool valid;
+				int cache_idx = _code_ptr[ip + 4];
+				GD_ERR_BREAK(cache_idx < 0 || cache_idx >= _inline_cache_count);
+				bool cached = false;
+				if (src->get_type() == Variant::OBJECT) {
+					Variant cached_ret;
+					cached = _inline_cache_get_named(_inline_caches_ptr[cache_idx], src, *index, cached_ret);
+					if (cached) {
+						*dst = cached_ret;
+					}
+				}
+
+				if (!cached) {
+					bool valid;
 #ifdef DEBUG_ENABLED
-				//allow better error message in cases where src and dst are the same stack position
-				Variant ret = src->get_named(*index, valid);
+					//allow better error message in cases where src and dst are the same stack position
+					Variant ret = src->get_named(*index, valid);
 
 #else
-				*dst = src->get_named(*index, valid);
+					*dst = src->get_named(*index, valid);
 #endif
 #ifdef DEBUG_ENABLED
-				if (!valid) {
-					err_text = "Invalid access to property or key '" + index->operator String() + "' on a base object of type '" + _get_var_type(src) + "'.";
-					OPCODE_BREAK;
-				}
-				*dst = ret;
+					if (!valid) {
+						err_text = "Invalid access to property or key '" + index->operator String() + "' on a base object of type '" + _get_var_type(src) + "'.";
+						OPCODE_BREAK;
+					}
+					*dst = ret;
 #endif
-				ip += 4;
+				}
+				ip += 5;
 			}
 			DISPATCH_OPCODE;
 
@@ -1853,7 +2345,7 @@ Variant GDScriptFunction::call(GDScriptInstance *p_instance, const Variant **p_a
 				bool call_async = (_code_ptr[ip]) == OPCODE_CALL_ASYNC;
 #endif
 				LOAD_INSTRUCTION_ARGS
-				CHECK_SPACE(3 + instr_arg_count);
+				CHECK_SPACE(4 + instr_arg_count);
 
 				ip += instr_arg_count;
 
@@ -1864,6 +2356,9 @@ Variant GDScriptFunction::call(GDScriptInstance *p_instance, const Variant **p_a
 				GD_ERR_BREAK(methodname_idx < 0 || methodname_idx >= _global_names_count);
 				const StringName *methodname = &_global_names_ptr[methodname_idx];
 
+				int cache_idx = _code_ptr[ip + 3];
+				GD_ERR_BREAK(cache_idx < 0 || cache_idx >= _inline_cache_count);
+
 				GET_INSTRUCTION_ARG(base, argc);
 				Variant **argptrs = instruction_args;
 
@@ -1880,9 +2375,12 @@ Variant GDScriptFunction::call(GDScriptInstance *p_instance, const Variant **p_a
 
 				Variant temp_ret;
 				Callable::CallError err;
+				bool use_cache = base->get_type() == Variant::OBJECT;
 				if (call_ret) {
 					GET_INSTRUCTION_ARG(ret, argc + 1);
-					base->callp(*methodname, (const Variant **)argptrs, argc, temp_ret, err);
+					if (!use_cache || !_inline_cache_call(_inline_caches_ptr[cache_idx], base, *methodname, (const Variant **)argptrs, argc, temp_ret, err)) {
+						base->callp(*methodname, (const Variant **)argptrs, argc, temp_ret, err);
+					}
 					*ret = temp_ret;
 #ifdef DEBUG_ENABLED
 					if (ret->get_type() == Variant::NIL) {
@@ -1912,7 +2410,9 @@ Variant GDScriptFunction::call(GDScriptInstance *p_instance, const Variant **p_a
 					}
 #endif
 				} else {
-					base->callp(*methodname, (const Variant **)argptrs, argc, temp_ret, err);
+					if (!use_cache || !_inline_cache_call(_inline_caches_ptr[cache_idx], base, *methodname, (const Variant **)argptrs, argc, temp_ret, err)) {
+						base->callp(*methodname, (const Variant **)argptrs, argc, temp_ret, err);
+					}
 				}
 #ifdef DEBUG_ENABLED
 
@@ -1962,7 +2462,7 @@ Variant GDScriptFunction::call(GDScriptInstance *p_instance, const Variant **p_a
 				}
 #endif // DEBUG_ENABLED
 
-				ip += 3;
+				ip += 4;
 			}
 			DISPATCH_OPCODE;
 
@@ -2005,6 +2505,10 @@ Variant GDScriptFunction::call(GDScriptInstance *p_instance, const Variant **p_a
 
 				Variant temp_ret;
 				Callable::CallError err;
+				const bool sample_native_call = GDScriptLanguage::is_sampling();
+				if (unlikely(sample_native_call)) {
+					GDScriptLanguage::get_singleton()->set_native_call(method);
+				}
 				if (call_ret) {
 					GET_INSTRUCTION_ARG(ret, argc + 1);
 					temp_ret = method->call(base_obj, (const Variant **)argptrs, argc, err);
@@ -2012,6 +2516,9 @@ Variant GDScriptFunction::call(GDScriptInstance *p_instance, const Variant **p_a
 				} else {
 					temp_ret = method->call(base_obj, (const Variant **)argptrs, argc, err);
 				}
+				if (unlikely(sample_native_call)) {
+					GDScriptLanguage::get_singleton()->set_native_call(nullptr);
+				}
 
 #ifdef DEBUG_ENABLED
 
@@ -2109,7 +2616,14 @@ Variant GDScriptFunction::call(GDScriptInstance *p_instance, const Variant **p_a
 #endif
 
 				Callable::CallError err;
+				const bool sample_native_call = GDScriptLanguage::is_sampling();
+				if (unlikely(sample_native_call)) {
+					GDScriptLanguage::get_singleton()->set_native_call(method);
+				}
 				*ret = method->call(nullptr, argptrs, argc, err);
+				if (unlikely(sample_native_call)) {
+					GDScriptLanguage::get_singleton()->set_native_call(nullptr);
+				}
 
 #ifdef DEBUG_ENABLED
 				if (GDScriptLanguage::get_singleton()->profiling && GDScriptLanguage::get_singleton()->profile_native_calls) {
@@ -2150,7 +2664,14 @@ Variant GDScriptFunction::call(GDScriptInstance *p_instance, const Variant **p_a
 #endif
 
 				GET_INSTRUCTION_ARG(ret, argc);
+				const bool sample_native_call = GDScriptLanguage::is_sampling();
+				if (unlikely(sample_native_call)) {
+					GDScriptLanguage::get_singleton()->set_native_call(method);
+				}
 				method->validated_call(nullptr, (const Variant **)argptrs, ret);
+				if (unlikely(sample_native_call)) {
+					GDScriptLanguage::get_singleton()->set_native_call(nullptr);
+				}
 
 #ifdef DEBUG_ENABLED
 				if (GDScriptLanguage::get_singleton()->profiling && GDScriptLanguage::get_singleton()->profile_native_calls) {
@@ -2186,7 +2707,14 @@ Variant GDScriptFunction::call(GDScriptInstance *p_instance, const Variant **p_a
 
 				GET_INSTRUCTION_ARG(ret, argc);
 				VariantInternal::initialize(ret, Variant::NIL);
+				const bool sample_native_call = GDScriptLanguage::is_sampling();
+				if (unlikely(sample_native_call)) {
+					GDScriptLanguage::get_singleton()->set_native_call(method);
+				}
 				method->validated_call(nullptr, (const Variant **)argptrs, nullptr);
+				if (unlikely(sample_native_call)) {
+					GDScriptLanguage::get_singleton()->set_native_call(nullptr);
+				}
 
 #ifdef DEBUG_ENABLED
 				if (GDScriptLanguage::get_singleton()->profiling && GDScriptLanguage::get_singleton()->profile_native_calls) {
@@ -2238,7 +2766,14 @@ Variant GDScriptFunction::call(GDScriptInstance *p_instance, const Variant **p_a
 #endif
 
 				GET_INSTRUCTION_ARG(ret, argc + 1);
+				const bool sample_native_call = GDScriptLanguage::is_sampling();
+				if (unlikely(sample_native_call)) {
+					GDScriptLanguage::get_singleton()->set_native_call(method);
+				}
 				method->validated_call(base_obj, (const Variant **)argptrs, ret);
+				if (unlikely(sample_native_call)) {
+					GDScriptLanguage::get_singleton()->set_native_call(nullptr);
+				}
 
 #ifdef DEBUG_ENABLED
 				if (GDScriptLanguage::get_singleton()->profiling && GDScriptLanguage::get_singleton()->profile_native_calls) {
@@ -2288,7 +2823,14 @@ Variant GDScriptFunction::call(GDScriptInstance *p_instance, const Variant **p_a
 
 				GET_INSTRUCTION_ARG(ret, argc + 1);
 				VariantInternal::initialize(ret, Variant::NIL);
+				const bool sample_native_call = GDScriptLanguage::is_sampling();
+				if (unlikely(sample_native_call)) {
+					GDScriptLanguage::get_singleton()->set_native_call(method);
+				}
 				method->validated_call(base_obj, (const Variant **)argptrs, nullptr);
+				if (unlikely(sample_native_call)) {
+					GDScriptLanguage::get_singleton()->set_native_call(nullptr);
+				}
 
 #ifdef DEBUG_ENABLED
 				if (GDScriptLanguage::get_singleton()->profiling && GDScriptLanguage::get_singleton()->profile_native_calls) {
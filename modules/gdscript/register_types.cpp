@@ -31,8 +31,10 @@
 #include "register_types.h"
 
 #include "gdscript.h"
+#include "gdscript_bytecode_cache.h"
 #include "gdscript_cache.h"
 #include "gdscript_parser.h"
+#include "gdscript_sampling_profiler.h"
 #include "gdscript_tokenizer_buffer.h"
 #include "gdscript_utility_functions.h"
 
@@ -70,6 +72,7 @@ GDScriptLanguage *script_language_gd = nullptr;
 Ref<ResourceFormatLoaderGDScript> resource_loader_gd;
 Ref<ResourceFormatSaverGDScript> resource_saver_gd;
 GDScriptCache *gdscript_cache = nullptr;
+Ref<GDScriptSamplingProfiler> sampling_profiler;
 
 #ifdef TOOLS_ENABLED
 
@@ -80,19 +83,24 @@ class EditorExportGDScript : public EditorExportPlugin {
 
 	static constexpr int DEFAULT_SCRIPT_MODE = EditorExportPreset::MODE_SCRIPT_BINARY_TOKENS_COMPRESSED;
 	int script_mode = DEFAULT_SCRIPT_MODE;
+	bool precompile_bytecode = false;
+	bool debug = false;
 
 protected:
 	virtual void _export_begin(const HashSet<String> &p_features, bool p_debug, const String &p_path, int p_flags) override {
 		script_mode = DEFAULT_SCRIPT_MODE;
+		precompile_bytecode = false;
+		debug = p_debug;
 
 		const Ref<EditorExportPreset> &preset = get_export_preset();
 		if (preset.is_valid()) {
 			script_mode = preset->get_script_export_mode();
+			precompile_bytecode = get_option("gdscript/precompile_bytecode");
 		}
 	}
 
 	virtual void _export_file(const String &p_path, const String &p_type, const HashSet<String> &p_features) override {
-		if (p_path.get_extension() != "gd" || script_mode == EditorExportPreset::MODE_SCRIPT_TEXT) {
+		if (p_path.get_extension() != "gd" || (script_mode == EditorExportPreset::MODE_SCRIPT_TEXT && !precompile_bytecode)) {
 			return;
 		}
 
@@ -102,13 +110,27 @@ protected:
 		}
 
 		String source = String::utf8(reinterpret_cast<const char *>(file.ptr()), file.size());
-		GDScriptTokenizerBuffer::CompressMode compress_mode = script_mode == EditorExportPreset::MODE_SCRIPT_BINARY_TOKENS_COMPRESSED ? GDScriptTokenizerBuffer::COMPRESS_ZSTD : GDScriptTokenizerBuffer::COMPRESS_NONE;
-		file = GDScriptTokenizerBuffer::parse_code_string(source, compress_mode);
-		if (file.is_empty()) {
-			return;
+		Vector<uint8_t> binary_tokens;
+		if (script_mode != EditorExportPreset::MODE_SCRIPT_TEXT) {
+			GDScriptTokenizerBuffer::CompressMode compress_mode = script_mode == EditorExportPreset::MODE_SCRIPT_BINARY_TOKENS_COMPRESSED ? GDScriptTokenizerBuffer::COMPRESS_ZSTD : GDScriptTokenizerBuffer::COMPRESS_NONE;
+			binary_tokens = GDScriptTokenizerBuffer::parse_code_string(source, compress_mode);
+			if (binary_tokens.is_empty()) {
+				return;
+			}
+			add_file(p_path.get_basename() + ".gdc", binary_tokens, true);
 		}
 
-		add_file(p_path.get_basename() + ".gdc", file, true);
+		if (precompile_bytecode) {
+			// Loaded next to the script, it's ignored if anything differs at runtime.
+			Vector<uint8_t> bytecode = GDScriptBytecodeCache::compile_for_export(p_path, source, binary_tokens, debug);
+			if (!bytecode.is_empty()) {
+				add_file(p_path.get_basename() + ".gdbc", bytecode, false);
+			}
+		}
+	}
+
+	virtual void _get_export_options(const Ref<EditorExportPlatform> &p_export_platform, List<EditorExportPlatform::ExportOption> *r_options) const override {
+		r_options->push_back(EditorExportPlatform::ExportOption(PropertyInfo(Variant::BOOL, "gdscript/precompile_bytecode"), false));
 	}
 
 public:
@@ -151,6 +173,9 @@ void initialize_gdscript_module(ModuleInitializationLevel p_level) {
 
 		gdscript_cache = memnew(GDScriptCache);
 
+		sampling_profiler.instantiate();
+		sampling_profiler->bind("gdscript:sampling");
+
 		GDScriptUtilityFunctions::register_functions();
 	}
 
@@ -170,6 +195,8 @@ void uninitialize_gdscript_module(ModuleInitializationLevel p_level) {
 	if (p_level == MODULE_INITIALIZATION_LEVEL_SERVERS) {
 		ScriptServer::unregister_language(script_language_gd);
 
+		sampling_profiler.unref();
+
 		if (gdscript_cache) {
 			memdelete(gdscript_cache);
 		}
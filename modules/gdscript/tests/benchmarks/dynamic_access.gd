@@ -0,0 +1,62 @@
+# Micro-benchmarks for untyped member access and method calls on objects.
+# Run with `godot --headless --script modules/gdscript/tests/benchmarks/dynamic_access.gd`.
+extends SceneTree
+
+const ITERATIONS = 1_000_000
+
+
+class Counter:
+	var value = 0
+
+	func bump(amount):
+		value += amount
+
+
+func _init() -> void:
+	run("script member read", bench_script_member)
+	run("script method call", bench_script_method)
+	run("native property read", bench_native_property)
+	run("native method call", bench_native_method)
+	quit()
+
+
+func run(p_name: String, p_bench: Callable) -> void:
+	var start := Time.get_ticks_usec()
+	var result = p_bench.call()
+	var elapsed := Time.get_ticks_usec() - start
+	print("%s: %.1f ms (result: %s)" % [p_name, elapsed / 1000.0, result])
+
+
+func bench_script_member():
+	var counter = Counter.new()
+	counter.value = 1
+	var sum = 0
+	for _i in ITERATIONS:
+		sum += counter.value
+	return sum
+
+
+func bench_script_method():
+	var counter = Counter.new()
+	for _i in ITERATIONS:
+		counter.bump(1)
+	return counter.value
+
+
+func bench_native_property():
+	var node = Node.new()
+	node.name = "Bench"
+	var length = 0
+	for _i in ITERATIONS:
+		length += node.name.length()
+	node.free()
+	return length
+
+
+func bench_native_method():
+	var node = Node.new()
+	var sum = 0
+	for _i in ITERATIONS:
+		sum += node.get_child_count()
+	node.free()
+	return sum
@@ -0,0 +1,51 @@
+# Micro-benchmarks for the fused instruction sequences emitted for typed code.
+# Run with `godot --headless --script modules/gdscript/tests/benchmarks/superinstructions.gd`
+# and compare against a build without instruction fusion.
+extends SceneTree
+
+const ITERATIONS = 10_000_000
+
+var position := Vector2(1.5, 2.5)
+
+
+func _init() -> void:
+	run("compare and branch", bench_compare_and_branch)
+	run("load member and add", bench_load_member_and_add)
+	run("increment typed int", bench_increment_typed_int)
+	quit()
+
+
+func run(p_name: String, p_bench: Callable) -> void:
+	var start := Time.get_ticks_usec()
+	var result = p_bench.call()
+	var elapsed := Time.get_ticks_usec() - start
+	print("%s: %.1f ms (result: %s)" % [p_name, elapsed / 1000.0, result])
+
+
+func bench_compare_and_branch() -> int:
+	var count := 0
+	var i := 0
+	while i < ITERATIONS:
+		if i < 5000:
+			count += 1
+		i += 1
+	return count
+
+
+func bench_load_member_and_add() -> float:
+	var sum := 0.0
+	var i := 0
+	while i < ITERATIONS:
+		sum += position.x + 1.0
+		i += 1
+	return sum
+
+
+func bench_increment_typed_int() -> int:
+	var value := 0
+	var i := 0
+	while i < ITERATIONS:
+		value += 3
+		value -= 1
+		i += 1
+	return value
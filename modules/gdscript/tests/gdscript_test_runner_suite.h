@@ -32,6 +32,8 @@
 
 #include "gdscript_test_runner.h"
 
+#include "../gdscript_bytecode_cache.h"
+
 #include "tests/test_macros.h"
 
 namespace GDScriptTests {
@@ -69,6 +71,70 @@ func _init():
 	ref_counted->set_script(gdscript);
 	CHECK_MESSAGE(int(ref_counted->get_meta("result")) == 42, "The script should assign object metadata successfully.");
 }
+
+TEST_CASE("[Modules][GDScript] Load precompiled bytecode") {
+	const String source = R"(
+extends RefCounted
+
+class Counter:
+	var count := 0
+
+	func add(p_amount: int) -> void:
+		count += p_amount
+
+func _init():
+	var counter := Counter.new()
+	var scale := func(p_value: int) -> int: return p_value * 7
+	var values: Array[int] = [1, 2, 3]
+	for value in values:
+		counter.add(scale.call(value))
+	set_meta("result", counter.count)
+)";
+
+	Ref<GDScript> compiled = memnew(GDScript);
+	compiled->set_source_code(source);
+	ERR_PRINT_OFF;
+	const Error error = compiled->reload();
+	ERR_PRINT_ON;
+	REQUIRE_MESSAGE(error == OK, "The script should compile successfully.");
+
+	uint32_t flags = 0;
+#ifdef DEBUG_ENABLED
+	flags |= GDScriptBytecodeCache::FLAG_DEBUG_CODEGEN;
+#endif
+	if (GDScriptLanguage::get_singleton()->should_track_locals()) {
+		flags |= GDScriptBytecodeCache::FLAG_TRACK_LOCALS;
+	}
+	const Vector<uint8_t> bytecode = GDScriptBytecodeCache::serialize(compiled.ptr(), source.hash(), flags);
+	REQUIRE_MESSAGE(!bytecode.is_empty(), "The compiled script should be serialized successfully.");
+
+	SUBCASE("Matching source") {
+		Ref<GDScript> gdscript = memnew(GDScript);
+		gdscript->set_source_code(source);
+		CHECK_MESSAGE(GDScriptBytecodeCache::load(gdscript.ptr(), bytecode) == OK, "The bytecode should be loaded successfully.");
+		CHECK_MESSAGE(gdscript->is_valid(), "The script should be valid after loading the bytecode.");
+
+		Ref<RefCounted> ref_counted = memnew(RefCounted);
+		ref_counted->set_script(gdscript);
+		CHECK_MESSAGE(int(ref_counted->get_meta("result")) == 42, "The loaded script should run like the compiled one.");
+	}
+
+	SUBCASE("Different source") {
+		Ref<GDScript> gdscript = memnew(GDScript);
+		gdscript->set_source_code(source + "\n");
+		CHECK_MESSAGE(GDScriptBytecodeCache::load(gdscript.ptr(), bytecode) != OK, "Bytecode made from a different source should be rejected.");
+		CHECK_FALSE(gdscript->is_valid());
+	}
+
+	SUBCASE("Different engine build") {
+		Vector<uint8_t> corrupted = bytecode;
+		corrupted.write[8] ^= 0xFF;
+		Ref<GDScript> gdscript = memnew(GDScript);
+		gdscript->set_source_code(source);
+		CHECK_MESSAGE(GDScriptBytecodeCache::load(gdscript.ptr(), corrupted) != OK, "Bytecode made by a different engine build should be rejected.");
+		CHECK_FALSE(gdscript->is_valid());
+	}
+}
 #endif // TOOLS_ENABLED
 
 TEST_CASE("[Modules][GDScript] Validate built-in API") {
@@ -0,0 +1,62 @@
+# Untyped member access and calls go through per call site caches,
+# which must keep working as the receiver changes.
+
+class A:
+	var value = 1
+
+	func describe():
+		return "A%d" % value
+
+class B:
+	var value = 2
+
+	func describe():
+		return "B%d" % value
+
+class C extends A:
+	func describe():
+		return "C" + super()
+
+class WithGetter:
+	var value:
+		get:
+			return 42
+
+	func describe():
+		return "getter"
+
+class Dynamic:
+	func _get(property):
+		if property == &"value":
+			return "dynamic"
+		return null
+
+	func describe():
+		return "dynamic"
+
+func read_value(obj):
+	return obj.value
+
+func call_describe(obj):
+	return obj.describe()
+
+func test():
+	var objects = [A.new(), B.new(), C.new(), WithGetter.new(), Dynamic.new(), A.new()]
+	for _pass in 2:
+		var values = []
+		var names = []
+		for obj in objects:
+			values.append(read_value(obj))
+			names.append(call_describe(obj))
+		print(values)
+		print(names)
+		objects[0].value = 10
+
+	# Native properties and methods.
+	var node = Node.new()
+	node.name = "First"
+	for i in 3:
+		print(node.name)
+		print(node.get_child_count())
+		node.name = "Renamed%d" % i
+	node.free()
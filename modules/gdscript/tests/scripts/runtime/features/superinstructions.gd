@@ -0,0 +1,76 @@
+# Exercises the fused instruction sequences emitted for typed code.
+
+var counter := 0
+var position := Vector2(1.5, 2.5)
+
+func test():
+	# Compare and branch.
+	var total := 0
+	for i in 10:
+		if i < 5:
+			total += i
+	print(total)
+
+	var n := 0
+	while n < 7:
+		n += 1
+	print(n)
+
+	var hits := 0
+	for i in 20:
+		if i > 3 and i < 8:
+			hits += 1
+		if i == 0 or i >= 18:
+			hits += 10
+	print(hits)
+
+	var a := 3
+	var b := 4
+	print("less" if a < b else "not less")
+	var c := a > b
+	if not c:
+		print("not greater")
+
+	var k := 0
+	var evens := 0
+	while k < 100:
+		k += 1
+		if k % 2 == 1:
+			continue
+		if k > 10:
+			break
+		evens += 1
+	print(evens)
+	print(k)
+
+	# Load member and operate.
+	var sum := 0.0
+	for i in 4:
+		sum += position.x + i
+	print(sum)
+
+	var v := Vector3(1, 2, 3)
+	print(v.y * 2 + v.z)
+
+	# Increment typed int.
+	var up := 0
+	for i in 5:
+		up += 2
+	print(up)
+
+	var down := 10
+	down -= 3
+	down = down - 4
+	print(down)
+
+	counter += 5
+	counter -= 2
+	print(counter)
+
+	var f := 1.0
+	f += 2
+	print(f)
+
+	var big := 9223372036854775807
+	big -= 1
+	print(big)
@@ -0,0 +1,40 @@
+# Operators on statically typed int and float values use dedicated opcodes.
+
+func test():
+	var a := 7
+	var b := 3
+	print(a + b)
+	print(a - b)
+	print(a * b)
+	print(a & b)
+	print(a | b)
+	print(a ^ b)
+	print([a < b, a <= b, a > b, a >= b, a == b, a != b])
+
+	var x := 1.5
+	var y := 0.5
+	print(x + y)
+	print(x - y)
+	print(x * y)
+	print(x / y)
+	print([x < y, x <= y, x > y, x >= y, x == y, x != y])
+
+	# Mixed int and float operands.
+	print(a + y)
+	print(x * b)
+	print(a / 2.0)
+	print(b / x)
+	print([a > x, b == 3.0])
+
+	# Integer division still checks for zero.
+	@warning_ignore("integer_division")
+	print(a / b)
+	print(x / 0.0)
+
+	var t := 0.0
+	var steps := 0
+	while t < 1.0:
+		t += 0.25
+		steps += 1
+	print(steps)
+	print(t)
@@ -0,0 +1,129 @@
+/**************************************************************************/
+/*  test_gdscript_cache.h                                                 */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GODOT ENGINE                               */
+/*                        https://godotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#pragma once
+
+#include "../gdscript.h"
+#include "../gdscript_bytecode_cache.h"
+#include "../gdscript_cache.h"
+#include "../gdscript_parser.h"
+
+#include "core/io/dir_access.h"
+#include "core/io/file_access.h"
+#include "core/os/os.h"
+#include "tests/test_macros.h"
+#include "tests/test_utils.h"
+
+namespace TestGDScriptCache {
+
+static String _write_script(const String &p_name, const String &p_source) {
+	const String path = TestUtils::get_temp_path(p_name);
+	Ref<FileAccess> file = FileAccess::open(path, FileAccess::WRITE);
+	REQUIRE(file.is_valid());
+	file->store_string(p_source);
+	return path;
+}
+
+static uint32_t _get_source_hash(const String &p_path) {
+	return GDScriptBytecodeCache::get_source_hash(GDScriptCache::get_source_code(p_path), Vector<uint8_t>());
+}
+
+TEST_CASE("[Modules][GDScript] Scripts parsed ahead are used once, and only for the same source") {
+	const String path = _write_script("parsed_ahead.gd", "extends RefCounted\n\nfunc f() -> int:\n\treturn 42\n");
+	const uint32_t source_hash = _get_source_hash(path);
+
+	GDScriptCache::parse_scripts({ path }, true);
+	Ref<GDScriptParserRef> parsed = GDScriptCache::take_parsed_script(path, source_hash);
+	REQUIRE_MESSAGE(parsed.is_valid(), "The parse should be used for the same source.");
+	CHECK(parsed->get_parser()->get_tree() != nullptr);
+	CHECK_MESSAGE(GDScriptCache::take_parsed_script(path, source_hash).is_null(), "A parse should only be used once.");
+
+	GDScriptCache::parse_scripts({ path }, true);
+	CHECK_MESSAGE(GDScriptCache::take_parsed_script(path, source_hash + 1).is_null(), "A parse of a different source should not be used.");
+	CHECK_MESSAGE(GDScriptCache::take_parsed_script(path, source_hash).is_null(), "A stale parse should be dropped once it's rejected.");
+
+	GDScriptCache::parse_scripts({ path }, true);
+	GDScriptCache::discard_parsed_scripts({ path });
+	CHECK_MESSAGE(GDScriptCache::take_parsed_script(path, source_hash).is_null(), "Discarded parses should not be used.");
+
+	const String invalid_path = _write_script("parsed_ahead_invalid.gd", "extends RefCounted\n\nfunc f(\n");
+	GDScriptCache::parse_scripts({ invalid_path }, true);
+	CHECK_MESSAGE(GDScriptCache::take_parsed_script(invalid_path, _get_source_hash(invalid_path)).is_null(), "Scripts that fail to parse should be parsed again when compiled, to report the errors.");
+}
+
+static void _collect_scripts(const String &p_directory, Vector<String> &r_paths) {
+	for (const String &file : DirAccess::get_files_at(p_directory)) {
+		if (file.get_extension() == "gd") {
+			r_paths.push_back(p_directory.path_join(file));
+		}
+	}
+	for (const String &directory : DirAccess::get_directories_at(p_directory)) {
+		_collect_scripts(p_directory.path_join(directory), r_paths);
+	}
+}
+
+static uint64_t _compile_scripts(const Vector<String> &p_paths, bool p_parse_ahead) {
+	const uint64_t start = OS::get_singleton()->get_ticks_usec();
+	if (p_parse_ahead) {
+		GDScriptLanguage::get_singleton()->begin_batch_load(p_paths);
+	}
+	Error err = OK;
+	for (const String &path : p_paths) {
+		GDScriptCache::get_full_script(path, err, "", true);
+	}
+	if (p_parse_ahead) {
+		GDScriptLanguage::get_singleton()->end_batch_load(p_paths);
+	}
+	const uint64_t elapsed = OS::get_singleton()->get_ticks_usec() - start;
+
+	for (const String &path : p_paths) {
+		GDScriptCache::remove_script(path);
+	}
+	return elapsed;
+}
+
+// Not part of the regular test run, use `--test --test-case="*Benchmark*" --no-skip`.
+TEST_CASE("[Modules][GDScript][Benchmark] Compiling a batch of scripts parsed ahead" * doctest::skip()) {
+	Vector<String> paths;
+	for (const String &directory : { "analyzer/features", "parser/features", "runtime/features" }) {
+		_collect_scripts(String("modules/gdscript/tests/scripts").path_join(directory), paths);
+	}
+	REQUIRE_MESSAGE(!paths.is_empty(), "Run from the repository root.");
+
+	ERR_PRINT_OFF;
+	for (int round = 0; round < 3; round++) {
+		const uint64_t sequential = _compile_scripts(paths, false);
+		const uint64_t parsed_ahead = _compile_scripts(paths, true);
+		MESSAGE(vformat("Compiling %d scripts: %.1f ms one at a time, %.1f ms parsed ahead.", paths.size(), sequential / 1000.0, parsed_ahead / 1000.0).utf8().get_data());
+	}
+	ERR_PRINT_ON;
+}
+
+} // namespace TestGDScriptCache
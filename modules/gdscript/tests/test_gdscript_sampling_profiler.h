@@ -0,0 +1,199 @@
+/**************************************************************************/
+/*  test_gdscript_sampling_profiler.h                                     */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GODOT ENGINE                               */
+/*                        https://godotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#pragma once
+
+#include "../gdscript.h"
+#include "../gdscript_sampling_profiler.h"
+
+#include "core/io/file_access.h"
+#include "core/object/class_db.h"
+#include "tests/test_macros.h"
+#include "tests/test_utils.h"
+
+class TestGDScriptSamplingProfilerAccessor {
+public:
+	static void add_sample(GDScriptSamplingProfiler *p_profiler, const GDScriptFunction *p_function, const MethodBind *p_native_call, uint32_t p_count) {
+		GDScriptSamplingProfiler::Sample sample;
+		sample.thread_id = Thread::get_main_id();
+		sample.frames.push_back({ p_function, nullptr });
+		if (p_native_call) {
+			sample.frames.push_back({ nullptr, p_native_call });
+		}
+		HashMap<GDScriptSamplingProfiler::Sample, uint32_t, GDScriptSamplingProfiler::Sample>::Iterator E = p_profiler->samples.find(sample);
+		if (E) {
+			E->value += p_count;
+		} else {
+			p_profiler->samples.insert(sample, p_count);
+		}
+	}
+
+	static uint32_t get_sample_count(GDScriptSamplingProfiler *p_profiler) {
+		return p_profiler->samples.size();
+	}
+
+	static void resolve_samples(GDScriptSamplingProfiler *p_profiler) {
+		p_profiler->_resolve_samples();
+	}
+
+	static uint64_t get_pending_count(GDScriptSamplingProfiler *p_profiler, const String &p_stack) {
+		HashMap<String, uint64_t>::ConstIterator E = p_profiler->pending_stacks.find(p_stack);
+		return E ? E->value : 0;
+	}
+
+	static uint32_t get_pending_stack_count(GDScriptSamplingProfiler *p_profiler) {
+		return p_profiler->pending_stacks.size();
+	}
+};
+
+namespace TestGDScriptSamplingProfiler {
+
+static Ref<GDScript> _compile(const String &p_path, const String &p_source) {
+	Ref<GDScript> gdscript;
+	gdscript.instantiate();
+	gdscript->set_source_code(p_source);
+	gdscript->set_path_cache(p_path);
+	ERR_PRINT_OFF;
+	const Error error = gdscript->reload();
+	ERR_PRINT_ON;
+	REQUIRE_MESSAGE(error == OK, "The script should compile successfully.");
+	return gdscript;
+}
+
+static const char *_source = R"(
+extends RefCounted
+
+func busy(p_msec: int) -> int:
+	var calls := 0
+	var start := Time.get_ticks_msec()
+	while Time.get_ticks_msec() - start < p_msec:
+		calls += 1
+	return calls
+)";
+
+TEST_CASE("[Modules][GDScript][SamplingProfiler] Samples are aggregated into folded stacks") {
+	Ref<GDScript> gdscript = _compile("res://sampled.gd", _source);
+	const GDScriptFunction *busy = gdscript->get_member_functions()[SNAME("busy")];
+	const MethodBind *get_ticks_msec = ClassDB::get_method("Time", "get_ticks_msec");
+	REQUIRE(busy != nullptr);
+	REQUIRE(get_ticks_msec != nullptr);
+
+	Ref<GDScriptSamplingProfiler> profiler;
+	profiler.instantiate();
+	TestGDScriptSamplingProfilerAccessor::add_sample(profiler.ptr(), busy, nullptr, 2);
+	TestGDScriptSamplingProfilerAccessor::add_sample(profiler.ptr(), busy, get_ticks_msec, 3);
+	TestGDScriptSamplingProfilerAccessor::add_sample(profiler.ptr(), busy, get_ticks_msec, 4);
+	CHECK(TestGDScriptSamplingProfilerAccessor::get_sample_count(profiler.ptr()) == 2);
+
+	TestGDScriptSamplingProfilerAccessor::resolve_samples(profiler.ptr());
+	CHECK(TestGDScriptSamplingProfilerAccessor::get_sample_count(profiler.ptr()) == 0);
+
+	CHECK(TestGDScriptSamplingProfilerAccessor::get_pending_stack_count(profiler.ptr()) == 2);
+	CHECK(TestGDScriptSamplingProfilerAccessor::get_pending_count(profiler.ptr(), "Main Thread;res://sampled.gd::busy") == 2);
+	CHECK(TestGDScriptSamplingProfilerAccessor::get_pending_count(profiler.ptr(), "Main Thread;res://sampled.gd::busy;Time.get_ticks_msec") == 7);
+
+	// Resolving again adds to the stacks that are not sent yet.
+	TestGDScriptSamplingProfilerAccessor::add_sample(profiler.ptr(), busy, nullptr, 1);
+	TestGDScriptSamplingProfilerAccessor::resolve_samples(profiler.ptr());
+	CHECK(TestGDScriptSamplingProfilerAccessor::get_pending_count(profiler.ptr(), "Main Thread;res://sampled.gd::busy") == 3);
+}
+
+#ifdef DEBUG_ENABLED
+TEST_CASE("[Modules][GDScript][SamplingProfiler] Samples are resolved before their function is freed") {
+	Ref<GDScript> gdscript = _compile("res://freed.gd", _source);
+	const GDScriptFunction *busy = gdscript->get_member_functions()[SNAME("busy")];
+	REQUIRE(busy != nullptr);
+
+	Ref<GDScriptSamplingProfiler> profiler;
+	profiler.instantiate();
+	profiler->toggle(true, Array());
+	TestGDScriptSamplingProfilerAccessor::add_sample(profiler.ptr(), busy, nullptr, 5);
+
+	gdscript.unref();
+	CHECK_MESSAGE(TestGDScriptSamplingProfilerAccessor::get_sample_count(profiler.ptr()) == 0, "Samples should not point to freed functions.");
+	CHECK(TestGDScriptSamplingProfilerAccessor::get_pending_count(profiler.ptr(), "Main Thread;res://freed.gd::busy") == 5);
+
+	profiler->toggle(false, Array());
+}
+
+TEST_CASE("[Modules][GDScript][SamplingProfiler] Sampled stacks are written as folded stacks") {
+	const String output_path = TestUtils::get_temp_path("gdscript_sampling.folded");
+	Ref<GDScript> gdscript = _compile("res://running.gd", _source);
+	Ref<RefCounted> object;
+	object.instantiate();
+	object->set_script(gdscript);
+
+	Ref<GDScriptSamplingProfiler> profiler;
+	profiler.instantiate();
+	profiler->toggle(true, Array({ 100, output_path }));
+	CHECK(int(object->call("busy", 100)) > 0);
+	profiler->toggle(false, Array());
+
+	const Vector<String> lines = FileAccess::get_file_as_string(output_path).strip_edges().split("\n");
+	bool found_busy = false;
+	for (const String &line : lines) {
+		// Every line is a `;` separated stack, followed by a space and the number of samples.
+		const int separator = line.rfind_char(' ');
+		REQUIRE(separator > 0);
+		CHECK(line.substr(separator + 1).is_valid_int());
+		CHECK(line.substr(separator + 1).to_int() > 0);
+
+		const Vector<String> frames = line.substr(0, separator).split(";");
+		CHECK(frames[0] == "Main Thread");
+		if (frames.size() > 1 && frames[1] == "res://running.gd::busy") {
+			found_busy = true;
+			if (frames.size() > 2) {
+				CHECK(frames[2] == "Time.get_ticks_msec");
+			}
+		}
+	}
+	CHECK_MESSAGE(found_busy, "The running function should be sampled.");
+}
+#endif // DEBUG_ENABLED
+
+// Not part of the regular test run, use `--test --test-case="*Benchmark*" --no-skip`.
+TEST_CASE("[Modules][GDScript][SamplingProfiler][Benchmark] Engine calls with and without sampling" * doctest::skip()) {
+	Ref<GDScript> gdscript = _compile("res://benchmark.gd", _source);
+	Ref<RefCounted> object;
+	object.instantiate();
+	object->set_script(gdscript);
+
+	Ref<GDScriptSamplingProfiler> profiler;
+	profiler.instantiate();
+	for (int round = 0; round < 3; round++) {
+		const int64_t calls = object->call("busy", 1000);
+		profiler->toggle(true, Array());
+		const int64_t sampled_calls = object->call("busy", 1000);
+		profiler->toggle(false, Array());
+		MESSAGE(vformat("Engine calls per second: %d without sampling, %d while sampling every 1 ms.", calls, sampled_calls).utf8().get_data());
+	}
+}
+
+} // namespace TestGDScriptSamplingProfiler
@@ -555,12 +555,14 @@ void AudioStreamPlaybackInteractive::stop() {
 		}
 		states[i].fade_speed = 0.0;
 		states[i].fade_volume = 0.0;
-		states[i].fade_wait = 0.0;
+		states[i].fade_wait = 0;
 		states[i].reset_fade();
 		states[i].active = false;
 		states[i].auto_advance = -1;
 		states[i].first_mix = true;
+		states[i].prerolled = false;
 	}
+	auto_advance_request = -1;
 }
 
 void AudioStreamPlaybackInteractive::start(double p_from_pos) {
@@ -612,7 +614,8 @@ void AudioStreamPlaybackInteractive::_queue(int p_to_clip_index, bool p_is_auto_
 		state.fade_speed = 0;
 		state.first_mix = true;
 
-		state.playback->start(0);
+		state.start_position = 0;
+		_preroll_state(state);
 
 		playback_current = current;
 
@@ -631,6 +634,7 @@ void AudioStreamPlaybackInteractive::_queue(int p_to_clip_index, bool p_is_auto_
 			states[i].playback->stop();
 			states[i].reset_fade();
 			states[i].active = false;
+			states[i].prerolled = false;
 		}
 	}
 
@@ -670,28 +674,28 @@ void AudioStreamPlaybackInteractive::_queue(int p_to_clip_index, bool p_is_auto_
 	}
 
 	// Prepare the fadeout
-	float current_pos = from_state.playback->get_playback_position();
+	double current_pos = _get_state_position(from_state);
 
-	float src_fade_wait = 0;
-	float dst_seek_to = 0;
-	float fade_speed = 0;
+	double src_fade_wait = 0;
+	double dst_seek_to = 0;
+	double fade_speed = 0;
 	bool src_no_loop = false;
 
 	if (from_state.stream->get_bpm()) {
 		// Check if source speed has BPM, if so, transition syncs to BPM
-		float beat_sec = 60 / float(from_state.stream->get_bpm());
+		double beat_sec = 60 / from_state.stream->get_bpm();
 		switch (transition.from_time) {
 			case AudioStreamInteractive::TRANSITION_FROM_TIME_IMMEDIATE: {
 				src_fade_wait = 0;
 			} break;
 			case AudioStreamInteractive::TRANSITION_FROM_TIME_NEXT_BEAT: {
-				float remainder = Math::fmod(current_pos, beat_sec);
+				double remainder = Math::fmod(current_pos, beat_sec);
 				src_fade_wait = beat_sec - remainder;
 			} break;
 			case AudioStreamInteractive::TRANSITION_FROM_TIME_NEXT_BAR: {
 				if (from_state.stream->get_bar_beats() > 0) {
-					float bar_sec = beat_sec * from_state.stream->get_bar_beats();
-					float remainder = Math::fmod(current_pos, bar_sec);
+					double bar_sec = beat_sec * from_state.stream->get_bar_beats();
+					double remainder = Math::fmod(current_pos, bar_sec);
 					src_fade_wait = bar_sec - remainder;
 				} else {
 					// Stream does not have a number of beats per bar - avoid NaN, and play immediately.
@@ -699,7 +703,7 @@ void AudioStreamPlaybackInteractive::_queue(int p_to_clip_index, bool p_is_auto_
 				}
 			} break;
 			case AudioStreamInteractive::TRANSITION_FROM_TIME_END: {
-				float end = from_state.stream->get_beat_count() > 0 ? float(from_state.stream->get_beat_count() * beat_sec) : from_state.stream->get_length();
+				double end = from_state.stream->get_beat_count() > 0 ? from_state.stream->get_beat_count() * beat_sec : from_state.stream->get_length();
 				if (end == 0) {
 					// Stream does not have a length.
 					src_fade_wait = 0;
@@ -720,7 +724,7 @@ void AudioStreamPlaybackInteractive::_queue(int p_to_clip_index, bool p_is_auto_
 	} else {
 		// Source has no BPM, so just simple transition.
 		if (transition.from_time == AudioStreamInteractive::TRANSITION_FROM_TIME_END && from_state.stream->get_length() > 0) {
-			float end = from_state.stream->get_length();
+			double end = from_state.stream->get_length();
 			src_fade_wait = end - current_pos;
 			if (!from_state.stream->has_loop()) {
 				src_no_loop = true;
@@ -731,14 +735,18 @@ void AudioStreamPlaybackInteractive::_queue(int p_to_clip_index, bool p_is_auto_
 		fade_speed = 1.0 / transition.fade_beats;
 	}
 
+	// Waits are counted in frames from here on, so that the source fades and the destination starts on the exact same frame.
+	double mix_rate = AudioServer::get_singleton()->get_mix_rate();
+	int64_t src_fade_wait_frames = MAX(0, int64_t(Math::round(src_fade_wait * mix_rate)));
+
 	if (transition.to_time == AudioStreamInteractive::TRANSITION_TO_TIME_PREVIOUS_POSITION && to_state.stream->get_length() > 0.0) {
 		dst_seek_to = to_state.previous_position;
 	} else if (transition.to_time == AudioStreamInteractive::TRANSITION_TO_TIME_SAME_POSITION && transition.from_time != AudioStreamInteractive::TRANSITION_FROM_TIME_END && to_state.stream->get_length() > 0.0) {
 		// Seeking to basically same position as when we start fading.
 		dst_seek_to = current_pos + src_fade_wait;
-		float end;
+		double end;
 		if (to_state.stream->get_bpm() > 0 && to_state.stream->get_beat_count()) {
-			float beat_sec = 60 / float(to_state.stream->get_bpm());
+			double beat_sec = 60 / to_state.stream->get_bpm();
 			end = to_state.stream->get_beat_count() * beat_sec;
 		} else {
 			end = to_state.stream->get_length();
@@ -761,17 +769,19 @@ void AudioStreamPlaybackInteractive::_queue(int p_to_clip_index, bool p_is_auto_
 			from_state.fade_speed = 0;
 		} else {
 			// Otherwise force a very quick fade to avoid clicks
-			from_state.fade_wait = src_fade_wait;
+			from_state.fade_wait = src_fade_wait_frames;
 			from_state.fade_speed = 1.0 / -0.001;
 		}
 	} else {
 		// Regular fade.
-		from_state.fade_wait = src_fade_wait;
+		from_state.fade_wait = src_fade_wait_frames;
 		from_state.fade_speed = -fade_speed;
 	}
 	// keep volume, since it may have been fading in from something else.
 
-	to_state.playback->start(dst_seek_to);
+	// Only started shortly before being mixed, see `_mix_internal_state()`.
+	to_state.start_position = dst_seek_to;
+	to_state.prerolled = false;
 	to_state.active = true;
 	to_state.fade_volume = 0.0;
 	to_state.first_mix = true;
@@ -797,19 +807,20 @@ void AudioStreamPlaybackInteractive::_queue(int p_to_clip_index, bool p_is_auto_
 	if (transition.use_filler_clip && transition.filler_clip >= 0 && transition.filler_clip < (int)stream->clip_count && states[transition.filler_clip].playback.is_valid() && playback_current != transition.filler_clip && p_to_clip_index != transition.filler_clip) {
 		State &filler_state = states[transition.filler_clip];
 
-		filler_state.playback->start(0);
+		filler_state.start_position = 0;
+		filler_state.prerolled = false;
 		filler_state.active = true;
 
 		// Filler state does not fade (bake fade in the audio clip if you want fading.
 		filler_state.fade_volume = 1.0;
 		filler_state.fade_speed = 0.0;
 
-		filler_state.fade_wait = src_fade_wait;
+		filler_state.fade_wait = src_fade_wait_frames;
 		filler_state.first_mix = true;
 
-		float filler_end;
+		double filler_end;
 		if (filler_state.stream->get_bpm() > 0 && filler_state.stream->get_beat_count() > 0) {
-			float filler_beat_sec = 60 / float(filler_state.stream->get_bpm());
+			double filler_beat_sec = 60 / filler_state.stream->get_bpm();
 			filler_end = filler_beat_sec * filler_state.stream->get_beat_count();
 		} else {
 			filler_end = filler_state.stream->get_length();
@@ -829,10 +840,10 @@ void AudioStreamPlaybackInteractive::_queue(int p_to_clip_index, bool p_is_auto_
 			to_state.fade_speed = fade_speed;
 		}
 
-		to_state.fade_wait = src_fade_wait + filler_end;
+		to_state.fade_wait = src_fade_wait_frames + int64_t(Math::round(filler_end * mix_rate));
 
 	} else {
-		to_state.fade_wait = src_fade_wait;
+		to_state.fade_wait = src_fade_wait_frames;
 
 		if (transition.fade_mode == AudioStreamInteractive::FADE_DISABLED || transition.fade_mode == AudioStreamInteractive::FADE_OUT) {
 			to_state.fade_volume = 1.0;
@@ -891,6 +902,28 @@ void AudioStreamPlaybackInteractive::_mix_internal(int p_frames) {
 
 		_mix_internal_state(i, p_frames);
 	}
+
+	if (auto_advance_request != -1) {
+		int to_clip = auto_advance_request;
+		auto_advance_request = -1;
+		_queue(to_clip, true);
+	}
+}
+
+void AudioStreamPlaybackInteractive::_preroll_state(State &r_state) {
+	r_state.playback->start(r_state.start_position);
+	r_state.mixed_time = 0;
+	r_state.prerolled = true;
+}
+
+double AudioStreamPlaybackInteractive::_get_state_position(const State &p_state) const {
+	// The position reported by the playback runs ahead by what it decoded but didn't mix yet,
+	// so compute the exact position of the next frame to mix when it's supported.
+	double position = p_state.playback->get_position_after(p_state.start_position, p_state.mixed_time);
+	if (Math::is_nan(position) || position < 0) {
+		return p_state.playback->get_playback_position();
+	}
+	return position;
 }
 
 void AudioStreamPlaybackInteractive::_mix_internal_state(int p_state_idx, int p_frames) {
@@ -899,68 +932,83 @@ void AudioStreamPlaybackInteractive::_mix_internal_state(int p_state_idx, int p_
 	double frame_inc = 1.0 / mix_rate;
 
 	int from_frame = 0;
-	int queue_next = -1;
 
 	if (state.first_mix) {
 		// Did not start mixing yet, wait.
-		double mix_time = p_frames * frame_inc;
-		if (state.fade_wait < mix_time) {
-			// time to start!
-			from_frame = state.fade_wait * mix_rate;
-			state.fade_wait = 0;
-			if (state.fade_speed == 0.0) {
-				queue_next = state.auto_advance;
-			}
-			playback_current = p_state_idx;
-			state.first_mix = false;
-		} else {
+		if (state.fade_wait >= p_frames) {
 			// This is for fade in of new stream.
-			state.fade_wait -= mix_time;
+			state.fade_wait -= p_frames;
+			if (!state.prerolled && state.fade_wait < PREROLL_FRAMES) {
+				// Start it ahead of time, so decoding starts before it has to be mixed.
+				_preroll_state(state);
+			}
 			return; // Nothing to do
 		}
-	}
 
-	state.previous_position = state.playback->get_playback_position();
-	state.playback->mix(temp_buffer + from_frame, 1.0, p_frames - from_frame);
+		// Time to start!
+		from_frame = state.fade_wait;
+		state.fade_wait = 0;
+		if (!state.prerolled) {
+			_preroll_state(state);
+		}
+		if (state.fade_speed == 0.0 && state.auto_advance != -1) {
+			auto_advance_request = state.auto_advance;
+		}
+		playback_current = p_state_idx;
+		state.first_mix = false;
+	}
 
+	// Compute the volume first, so that a clip fading out is only decoded while it can be heard.
+	int to_frame = p_frames;
+	bool faded_out = false;
 	double frame_fade_inc = state.fade_speed * frame_inc;
 	for (int i = from_frame; i < p_frames; i++) {
-		if (state.fade_wait) {
+		if (state.fade_wait > 0) {
 			// This is for fade out of existing stream;
-			state.fade_wait -= frame_inc;
-			if (state.fade_wait < 0.0) {
-				state.fade_wait = 0.0;
-			}
+			state.fade_wait--;
 		} else if (frame_fade_inc > 0) {
 			state.fade_volume += frame_fade_inc;
 			if (state.fade_volume >= 1.0) {
 				state.fade_speed = 0.0;
 				frame_fade_inc = 0.0;
 				state.fade_volume = 1.0;
-				queue_next = state.auto_advance;
+				if (state.auto_advance != -1) {
+					auto_advance_request = state.auto_advance;
+				}
 			}
-		} else if (frame_fade_inc < 0.0) {
+		} else if (frame_fade_inc < 0.0 || state.fade_volume <= 0.0) {
 			state.fade_volume += frame_fade_inc;
 			if (state.fade_volume <= 0.0) {
 				state.fade_speed = 0.0;
 				frame_fade_inc = 0.0;
 				state.fade_volume = 0.0;
-				state.playback->stop(); // Stop playback and break, no point to continue mixing
+				// No point to continue mixing, the rest of the block is not decoded.
+				to_frame = i;
+				faded_out = true;
 				break;
 			}
 		}
 
-		mix_buffer[i] += temp_buffer[i] * state.fade_volume;
-		state.previous_position += frame_inc;
+		fade_buffer[i] = state.fade_volume;
+	}
+
+	if (to_frame > from_frame) {
+		state.playback->mix(temp_buffer + from_frame, 1.0, to_frame - from_frame);
+		for (int i = from_frame; i < to_frame; i++) {
+			mix_buffer[i] += temp_buffer[i] * fade_buffer[i];
+		}
+		state.mixed_time += (to_frame - from_frame) * frame_inc;
+		state.previous_position = _get_state_position(state);
+	}
+
+	if (faded_out) {
+		state.playback->stop(); // Stop playback, it's silent from now on.
 	}
 
 	if (!state.playback->is_playing()) {
 		// It finished because it either reached end or faded out, so deactivate and continue.
 		state.active = false;
 	}
-	if (queue_next != -1) {
-		_queue(queue_next, true);
-	}
 }
 
 void AudioStreamPlaybackInteractive::tag_used_streams() {
@@ -207,21 +207,26 @@ private:
 	uint64_t version = 0;
 
 	enum {
-		BUFFER_SIZE = 1024
+		BUFFER_SIZE = 1024,
+		PREROLL_FRAMES = 4096, // How long before starting to be mixed a clip is started, so its decoder is primed.
 	};
 
 	AudioFrame mix_buffer[BUFFER_SIZE];
 	AudioFrame temp_buffer[BUFFER_SIZE];
+	float fade_buffer[BUFFER_SIZE]; // Volume of the state being mixed, for each frame.
 
 	struct State {
 		Ref<AudioStream> stream;
 		Ref<AudioStreamPlayback> playback;
 		bool active = false;
-		double fade_wait = 0; // Time to wait until fade kicks-in
+		int64_t fade_wait = 0; // Frames to wait until fade kicks-in, or until the clip starts if `first_mix`.
 		double fade_volume = 1.0;
 		double fade_speed = 0; // Fade speed, negative or positive
 		int auto_advance = -1;
 		bool first_mix = true;
+		bool prerolled = false; // `playback` was started from `start_position`.
+		double start_position = 0;
+		double mixed_time = 0; // Stream time mixed since started, to know its exact position.
 		double previous_position = 0;
 
 		void reset_fade() {
@@ -240,9 +245,12 @@ private:
 	void _mix_internal(int p_frames);
 	void _mix_internal_state(int p_state_idx, int p_frames);
 
+	void _preroll_state(State &r_state);
+	double _get_state_position(const State &p_state) const;
 	void _queue(int p_to_clip_index, bool p_is_auto_advance);
 
 	int switch_request = -1;
+	int auto_advance_request = -1; // Queued once all states are mixed, so transitions are timed from the end of the block.
 
 protected:
 	static void _bind_methods();
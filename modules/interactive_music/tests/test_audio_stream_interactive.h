@@ -0,0 +1,95 @@
+/**************************************************************************/
+/*  test_audio_stream_interactive.h                                       */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GODOT ENGINE                               */
+/*                        https://godotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+
+#pragma once
+
+#include "../audio_stream_interactive.h"
+
+#include "scene/resources/audio_stream_wav.h"
+
+#include "tests/test_macros.h"
+
+namespace TestAudioStreamInteractive {
+
+// A looping mono clip holding a constant value.
+static Ref<AudioStreamWAV> make_constant_clip(int p_frames, int16_t p_value) {
+	Vector<uint8_t> data;
+	data.resize(p_frames * 2);
+	for (int i = 0; i < p_frames; i++) {
+		data.write[i * 2] = p_value & 0xFF;
+		data.write[i * 2 + 1] = (p_value >> 8) & 0xFF;
+	}
+
+	Ref<AudioStreamWAV> clip;
+	clip.instantiate();
+	clip->set_format(AudioStreamWAV::FORMAT_16_BITS);
+	clip->set_mix_rate(AudioServer::get_singleton()->get_mix_rate());
+	clip->set_data(data);
+	clip->set_loop_mode(AudioStreamWAV::LOOP_FORWARD);
+	clip->set_loop_end(p_frames);
+	return clip;
+}
+
+TEST_CASE("[Audio][AudioStreamInteractive] Transitions start on the exact frame") {
+	const int clip_frames = 1000;
+	const int mixed_before_switch = 300;
+
+	Ref<AudioStreamInteractive> stream;
+	stream.instantiate();
+	stream->set_clip_count(2);
+	stream->set_clip_stream(0, make_constant_clip(clip_frames, 8192)); // 0.25
+	stream->set_clip_stream(1, make_constant_clip(clip_frames, 16384)); // 0.5
+	stream->set_initial_clip(0);
+	stream->add_transition(0, 1, AudioStreamInteractive::TRANSITION_FROM_TIME_END, AudioStreamInteractive::TRANSITION_TO_TIME_START, AudioStreamInteractive::FADE_DISABLED, 1);
+
+	Ref<AudioStreamPlaybackInteractive> playback = stream->instantiate_playback();
+	REQUIRE(playback.is_valid());
+	playback->start();
+
+	LocalVector<AudioFrame> frames;
+	frames.resize(1024);
+	playback->mix(frames.ptr(), 1.0, mixed_before_switch);
+	CHECK(frames[0].left == 0.25);
+	CHECK(frames[mixed_before_switch - 1].left == 0.25);
+
+	playback->switch_to_clip(1);
+	playback->mix(frames.ptr(), 1.0, frames.size());
+
+	// The first clip plays until its end, then quickly fades out over the second one.
+	const int boundary = clip_frames - mixed_before_switch;
+	CHECK(frames[boundary - 1].left == 0.25);
+	CHECK(frames[boundary].left > 0.5);
+	CHECK(frames[boundary].left < 0.75);
+	CHECK(frames[boundary + 200].left == 0.5);
+	CHECK(playback->get_current_clip_index() == 1);
+}
+
+} // namespace TestAudioStreamInteractive
@@ -104,6 +104,7 @@ float AudioStreamPlaybackMP3::get_stream_sampling_rate() {
 }
 
 void AudioStreamPlaybackMP3::start(double p_from_pos) {
+	MutexLock lock(decoder_mutex);
 	active = true;
 	seek(p_from_pos);
 	loops = 0;
@@ -111,11 +112,14 @@ void AudioStreamPlaybackMP3::start(double p_from_pos) {
 }
 
 void AudioStreamPlaybackMP3::stop() {
+	MutexLock lock(decoder_mutex);
 	active = false;
+	_discard_decoded_ahead();
 }
 
 bool AudioStreamPlaybackMP3::is_playing() const {
-	return active;
+	// The decoder may be done while frames decoded ahead remain to be mixed.
+	return active || _get_decoded_ahead_frames() > 0;
 }
 
 int AudioStreamPlaybackMP3::get_loop_count() const {
@@ -123,13 +127,38 @@ int AudioStreamPlaybackMP3::get_loop_count() const {
 }
 
 double AudioStreamPlaybackMP3::get_playback_position() const {
-	return double(frames_mixed) / mp3_stream->sample_rate;
+	int64_t frames = MAX(0, int64_t(frames_mixed) - _get_decoded_ahead_frames());
+	return double(frames) / mp3_stream->sample_rate;
+}
+
+double AudioStreamPlaybackMP3::get_position_after(double p_from_pos, double p_time) const {
+	double position = p_from_pos + p_time;
+	// Same as `_mix_internal()`, which loops at the end of the last beat if the beat count is set.
+	double loop_end = mp3_stream->get_length();
+	if (mp3_stream->get_bpm() > 0 && mp3_stream->get_beat_count() > 0) {
+		loop_end = mp3_stream->get_beat_count() * 60.0 / mp3_stream->get_bpm();
+	}
+	if (position < loop_end) {
+		return position;
+	}
+
+	bool use_loop = looping_override ? looping : mp3_stream->loop;
+	if (!use_loop) {
+		return -1.0;
+	}
+	double loop_offset = mp3_stream->loop_offset;
+	if (loop_end <= loop_offset) {
+		return loop_offset;
+	}
+	return loop_offset + Math::fmod(position - loop_offset, loop_end - loop_offset);
 }
 
 void AudioStreamPlaybackMP3::seek(double p_time) {
+	MutexLock lock(decoder_mutex);
 	if (!active) {
 		return;
 	}
+	_discard_decoded_ahead();
 
 	if (p_time >= mp3_stream->get_length()) {
 		p_time = 0;
@@ -182,6 +211,7 @@ Variant AudioStreamPlaybackMP3::get_parameter(const StringName &p_name) const {
 }
 
 AudioStreamPlaybackMP3::~AudioStreamPlaybackMP3() {
+	_set_decode_ahead_enabled(false);
 	mp3dec_ex_close(&mp3d);
 }
 
@@ -206,6 +236,7 @@ Ref<AudioStreamPlayback> AudioStreamMP3::instantiate_playback() {
 		ERR_FAIL_COND_V(errorcode, Ref<AudioStreamPlaybackMP3>());
 	}
 
+	mp3s->_set_decode_ahead_enabled(true);
 	return mp3s;
 }
 
@@ -1196,6 +1196,216 @@ _FORCE_INLINE_ TextServerAdvanced::FontGlyph TextServerAdvanced::rasterize_bitma
 	chr.rect.size = chr.uv_rect.size * p_data->scale;
 	return chr;
 }
+
+_FORCE_INLINE_ int TextServerAdvanced::_load_glyph(const FontAdvanced *p_font_data, FT_Face p_face, const Vector2i &p_size, int32_t p_glyph, FT_Render_Mode &r_aa_mode, bool &r_bgra, Vector2 &r_advance) const {
+	int32_t glyph_index = p_glyph & 0xffffff; // Remove subpixel shifts.
+	FT_Int32 flags = FT_LOAD_DEFAULT;
+
+	bool outline = p_size.y > 0;
+	switch (p_font_data->hinting) {
+		case TextServer::HINTING_NONE:
+			flags |= FT_LOAD_NO_HINTING;
+			break;
+		case TextServer::HINTING_LIGHT:
+			flags |= FT_LOAD_TARGET_LIGHT;
+			break;
+		default:
+			flags |= FT_LOAD_TARGET_NORMAL;
+			break;
+	}
+	if (p_font_data->force_autohinter) {
+		flags |= FT_LOAD_FORCE_AUTOHINT;
+	}
+	if (outline || (p_font_data->disable_embedded_bitmaps && !FT_HAS_COLOR(p_face))) {
+		flags |= FT_LOAD_NO_BITMAP;
+	} else if (FT_HAS_COLOR(p_face)) {
+		flags |= FT_LOAD_COLOR;
+	}
+
+	FT_Fixed v, h;
+	FT_Get_Advance(p_face, glyph_index, flags, &h);
+	FT_Get_Advance(p_face, glyph_index, flags | FT_LOAD_VERTICAL_LAYOUT, &v);
+	r_advance = Vector2((h + (1 << 9)) >> 10, (v + (1 << 9)) >> 10) / 64.0;
+
+	int error = FT_Load_Glyph(p_face, glyph_index, flags);
+	if (error) {
+		return error;
+	}
+
+	if (!p_font_data->msdf) {
+		if ((p_font_data->subpixel_positioning == SUBPIXEL_POSITIONING_ONE_QUARTER) || (p_font_data->subpixel_positioning == SUBPIXEL_POSITIONING_AUTO && p_size.x <= SUBPIXEL_POSITIONING_ONE_QUARTER_MAX_SIZE * 64)) {
+			FT_Pos xshift = (int)((p_glyph >> 27) & 3) << 4;
+			FT_Outline_Translate(&p_face->glyph->outline, xshift, 0);
+		} else if ((p_font_data->subpixel_positioning == SUBPIXEL_POSITIONING_ONE_HALF) || (p_font_data->subpixel_positioning == SUBPIXEL_POSITIONING_AUTO && p_size.x <= SUBPIXEL_POSITIONING_ONE_HALF_MAX_SIZE * 64)) {
+			FT_Pos xshift = (int)((p_glyph >> 27) & 3) << 5;
+			FT_Outline_Translate(&p_face->glyph->outline, xshift, 0);
+		}
+	}
+
+	if (p_font_data->embolden != 0.f) {
+		FT_Pos strength = p_font_data->embolden * p_size.x / 16; // 26.6 fractional units (1 / 64).
+		FT_Outline_Embolden(&p_face->glyph->outline, strength);
+	}
+
+	if (p_font_data->transform != Transform2D()) {
+		FT_Matrix mat = { FT_Fixed(p_font_data->transform[0][0] * 65536), FT_Fixed(p_font_data->transform[0][1] * 65536), FT_Fixed(p_font_data->transform[1][0] * 65536), FT_Fixed(p_font_data->transform[1][1] * 65536) }; // 16.16 fractional units (1 / 65536).
+		FT_Outline_Transform(&p_face->glyph->outline, &mat);
+	}
+
+	r_aa_mode = FT_RENDER_MODE_NORMAL;
+	r_bgra = false;
+	switch (p_font_data->antialiasing) {
+		case FONT_ANTIALIASING_NONE: {
+			r_aa_mode = FT_RENDER_MODE_MONO;
+		} break;
+		case FONT_ANTIALIASING_GRAY: {
+			r_aa_mode = FT_RENDER_MODE_NORMAL;
+		} break;
+		case FONT_ANTIALIASING_LCD: {
+			int aa_layout = (int)((p_glyph >> 24) & 7);
+			switch (aa_layout) {
+				case FONT_LCD_SUBPIXEL_LAYOUT_HRGB: {
+					r_aa_mode = FT_RENDER_MODE_LCD;
+					r_bgra = false;
+				} break;
+				case FONT_LCD_SUBPIXEL_LAYOUT_HBGR: {
+					r_aa_mode = FT_RENDER_MODE_LCD;
+					r_bgra = true;
+				} break;
+				case FONT_LCD_SUBPIXEL_LAYOUT_VRGB: {
+					r_aa_mode = FT_RENDER_MODE_LCD_V;
+					r_bgra = false;
+				} break;
+				case FONT_LCD_SUBPIXEL_LAYOUT_VBGR: {
+					r_aa_mode = FT_RENDER_MODE_LCD_V;
+					r_bgra = true;
+				} break;
+				default: {
+					r_aa_mode = FT_RENDER_MODE_NORMAL;
+				} break;
+			}
+		} break;
+	}
+	return 0;
+}
+
+void TextServerAdvanced::_render_glyphs_threaded(void *p_td, uint32_t p_slice) {
+	GlyphRenderThreadData *td = static_cast<GlyphRenderThreadData *>(p_td);
+
+	uint32_t from = p_slice * td->slice_size;
+	uint32_t to = MIN(from + td->slice_size, td->glyph_count);
+	for (uint32_t i = from; i < to; i++) {
+		td->ts->_render_glyph_bitmap(td->font_data, td->faces[p_slice], td->size, td->glyphs[i]);
+	}
+}
+
+void TextServerAdvanced::_render_glyph_bitmap(const FontAdvanced *p_font_data, FT_Face p_face, const Vector2i &p_size, FontGlyphBitmap &r_glyph) const {
+	if ((r_glyph.glyph & 0xffffff) == 0) {
+		return; // Non graphical or invalid glyph, do not render.
+	}
+
+	FT_Render_Mode aa_mode = FT_RENDER_MODE_NORMAL;
+	Vector2 advance;
+	if (_load_glyph(p_font_data, p_face, p_size, r_glyph.glyph, aa_mode, r_glyph.bgra, advance) != 0) {
+		return;
+	}
+
+	FT_GlyphSlot slot = p_face->glyph;
+	r_glyph.from_svg = (slot->format == FT_GLYPH_FORMAT_SVG);
+
+	FT_Glyph glyph = nullptr;
+	const FT_Bitmap *bitmap = nullptr;
+	if (p_size.y == 0) {
+		if (FT_Render_Glyph(slot, aa_mode) != 0) {
+			return;
+		}
+		bitmap = &slot->bitmap;
+		r_glyph.advance = advance;
+		r_glyph.top = slot->bitmap_top;
+		r_glyph.left = slot->bitmap_left;
+	} else {
+		FT_Stroker stroker;
+		ERR_FAIL_COND_MSG(FT_Stroker_New(ft_library, &stroker) != 0, "FreeType: Failed to load glyph stroker.");
+		FT_Stroker_Set(stroker, (int)(p_size.y * 16.0), FT_STROKER_LINECAP_BUTT, FT_STROKER_LINEJOIN_ROUND, 0);
+		bool ok = FT_Get_Glyph(slot, &glyph) == 0 && FT_Glyph_Stroke(&glyph, stroker, 1) == 0 && FT_Glyph_To_Bitmap(&glyph, aa_mode, nullptr, 1) == 0;
+		FT_Stroker_Done(stroker);
+		if (!ok) {
+			if (glyph) {
+				FT_Done_Glyph(glyph);
+			}
+			return;
+		}
+		FT_BitmapGlyph glyph_bitmap = (FT_BitmapGlyph)glyph;
+		bitmap = &glyph_bitmap->bitmap;
+		r_glyph.top = glyph_bitmap->top;
+		r_glyph.left = glyph_bitmap->left;
+	}
+
+	// Copy the bitmap, the slot is reused by the next glyph.
+	r_glyph.bitmap = *bitmap;
+	r_glyph.data.resize(bitmap->rows * Math::abs(bitmap->pitch));
+	if (r_glyph.data.size() > 0) {
+		memcpy(r_glyph.data.ptrw(), bitmap->buffer, r_glyph.data.size());
+	}
+	r_glyph.loaded = true;
+
+	if (glyph) {
+		FT_Done_Glyph(glyph);
+	}
+}
+
+FT_Face TextServerAdvanced::_create_face_for_size(const FontAdvanced *p_font_data, const FontForSizeAdvanced *p_ffsd) const {
+	// Called with `ft_mutex` locked, opening and closing faces is not thread-safe.
+	FT_Open_Args fargs;
+	memset(&fargs, 0, sizeof(FT_Open_Args));
+	fargs.memory_base = (unsigned char *)p_font_data->data_ptr;
+	fargs.memory_size = p_font_data->data_size;
+	fargs.flags = FT_OPEN_MEMORY;
+
+	FT_Face face = nullptr;
+	if (FT_Open_Face(ft_library, &fargs, p_font_data->face_index, &face) != 0) {
+		if (face) {
+			FT_Done_Face(face);
+		}
+		return nullptr;
+	}
+
+	double sz = double(p_ffsd->size.x) / 64.0;
+	if (FT_HAS_COLOR(face) && face->num_fixed_sizes > 0) {
+		int best_match = 0;
+		int diff = Math::abs(sz - ((int64_t)face->available_sizes[0].width));
+		for (int i = 1; i < face->num_fixed_sizes; i++) {
+			int ndiff = Math::abs(sz - ((int64_t)face->available_sizes[i].width));
+			if (ndiff < diff) {
+				best_match = i;
+				diff = ndiff;
+			}
+		}
+		FT_Select_Size(face, best_match);
+	} else {
+		FT_Size_RequestRec req;
+		req.type = FT_SIZE_REQUEST_TYPE_NOMINAL;
+		req.width = sz * 64.0;
+		req.height = sz * 64.0;
+		req.horiResolution = 0;
+		req.vertResolution = 0;
+
+		FT_Request_Size(face, &req);
+	}
+
+	// Copy variation coordinates from the main face.
+	if (face->face_flags & FT_FACE_FLAG_MULTIPLE_MASTERS) {
+		FT_MM_Var *amaster;
+		FT_Get_MM_Var(p_ffsd->face, &amaster);
+
+		Vector<FT_Fixed> coords;
+		coords.resize(amaster->num_axis);
+		FT_Get_Var_Design_Coordinates(p_ffsd->face, coords.size(), coords.ptrw());
+		FT_Set_Var_Design_Coordinates(face, coords.size(), coords.ptrw());
+		FT_Done_MM_Var(ft_library, amaster);
+	}
+	return face;
+}
 #endif
 
 /*************************************************************************/
@@ -1223,95 +1433,17 @@ _FORCE_INLINE_ bool TextServerAdvanced::_ensure_glyph(FontAdvanced *p_font_data,
 #ifdef MODULE_FREETYPE_ENABLED
 	FontGlyph gl;
 	if (fd->face) {
-		FT_Int32 flags = FT_LOAD_DEFAULT;
-
 		bool outline = p_size.y > 0;
-		switch (p_font_data->hinting) {
-			case TextServer::HINTING_NONE:
-				flags |= FT_LOAD_NO_HINTING;
-				break;
-			case TextServer::HINTING_LIGHT:
-				flags |= FT_LOAD_TARGET_LIGHT;
-				break;
-			default:
-				flags |= FT_LOAD_TARGET_NORMAL;
-				break;
-		}
-		if (p_font_data->force_autohinter) {
-			flags |= FT_LOAD_FORCE_AUTOHINT;
-		}
-		if (outline || (p_font_data->disable_embedded_bitmaps && !FT_HAS_COLOR(fd->face))) {
-			flags |= FT_LOAD_NO_BITMAP;
-		} else if (FT_HAS_COLOR(fd->face)) {
-			flags |= FT_LOAD_COLOR;
-		}
-
-		FT_Fixed v, h;
-		FT_Get_Advance(fd->face, glyph_index, flags, &h);
-		FT_Get_Advance(fd->face, glyph_index, flags | FT_LOAD_VERTICAL_LAYOUT, &v);
-
-		int error = FT_Load_Glyph(fd->face, glyph_index, flags);
+		FT_Render_Mode aa_mode = FT_RENDER_MODE_NORMAL;
+		bool bgra = false;
+		Vector2 advance;
+		int error = _load_glyph(p_font_data, fd->face, p_size, p_glyph, aa_mode, bgra, advance);
 		if (error) {
 			E = fd->glyph_map.insert(p_glyph, FontGlyph());
 			r_glyph = E->value;
 			return false;
 		}
 
-		if (!p_font_data->msdf) {
-			if ((p_font_data->subpixel_positioning == SUBPIXEL_POSITIONING_ONE_QUARTER) || (p_font_data->subpixel_positioning == SUBPIXEL_POSITIONING_AUTO && p_size.x <= SUBPIXEL_POSITIONING_ONE_QUARTER_MAX_SIZE * 64)) {
-				FT_Pos xshift = (int)((p_glyph >> 27) & 3) << 4;
-				FT_Outline_Translate(&fd->face->glyph->outline, xshift, 0);
-			} else if ((p_font_data->subpixel_positioning == SUBPIXEL_POSITIONING_ONE_HALF) || (p_font_data->subpixel_positioning == SUBPIXEL_POSITIONING_AUTO && p_size.x <= SUBPIXEL_POSITIONING_ONE_HALF_MAX_SIZE * 64)) {
-				FT_Pos xshift = (int)((p_glyph >> 27) & 3) << 5;
-				FT_Outline_Translate(&fd->face->glyph->outline, xshift, 0);
-			}
-		}
-
-		if (p_font_data->embolden != 0.f) {
-			FT_Pos strength = p_font_data->embolden * p_size.x / 16; // 26.6 fractional units (1 / 64).
-			FT_Outline_Embolden(&fd->face->glyph->outline, strength);
-		}
-
-		if (p_font_data->transform != Transform2D()) {
-			FT_Matrix mat = { FT_Fixed(p_font_data->transform[0][0] * 65536), FT_Fixed(p_font_data->transform[0][1] * 65536), FT_Fixed(p_font_data->transform[1][0] * 65536), FT_Fixed(p_font_data->transform[1][1] * 65536) }; // 16.16 fractional units (1 / 65536).
-			FT_Outline_Transform(&fd->face->glyph->outline, &mat);
-		}
-
-		FT_Render_Mode aa_mode = FT_RENDER_MODE_NORMAL;
-		bool bgra = false;
-		switch (p_font_data->antialiasing) {
-			case FONT_ANTIALIASING_NONE: {
-				aa_mode = FT_RENDER_MODE_MONO;
-			} break;
-			case FONT_ANTIALIASING_GRAY: {
-				aa_mode = FT_RENDER_MODE_NORMAL;
-			} break;
-			case FONT_ANTIALIASING_LCD: {
-				int aa_layout = (int)((p_glyph >> 24) & 7);
-				switch (aa_layout) {
-					case FONT_LCD_SUBPIXEL_LAYOUT_HRGB: {
-						aa_mode = FT_RENDER_MODE_LCD;
-						bgra = false;
-					} break;
-					case FONT_LCD_SUBPIXEL_LAYOUT_HBGR: {
-						aa_mode = FT_RENDER_MODE_LCD;
-						bgra = true;
-					} break;
-					case FONT_LCD_SUBPIXEL_LAYOUT_VRGB: {
-						aa_mode = FT_RENDER_MODE_LCD_V;
-						bgra = false;
-					} break;
-					case FONT_LCD_SUBPIXEL_LAYOUT_VBGR: {
-						aa_mode = FT_RENDER_MODE_LCD_V;
-						bgra = true;
-					} break;
-					default: {
-						aa_mode = FT_RENDER_MODE_NORMAL;
-					} break;
-				}
-			} break;
-		}
-
 		FT_GlyphSlot slot = fd->face->glyph;
 		bool from_svg = (slot->format == FT_GLYPH_FORMAT_SVG); // Need to check before FT_Render_Glyph as it will change format to bitmap.
 		if (!outline) {
@@ -1321,13 +1453,13 @@ _FORCE_INLINE_ bool TextServerAdvanced::_ensure_glyph(FontAdvanced *p_font_data,
 			if (!error) {
 				if (p_font_data->msdf) {
 #ifdef MODULE_MSDFGEN_ENABLED
-					gl = rasterize_msdf(p_font_data, fd, p_font_data->msdf_range, rect_range, &slot->outline, Vector2((h + (1 << 9)) >> 10, (v + (1 << 9)) >> 10) / 64.0);
+					gl = rasterize_msdf(p_font_data, fd, p_font_data->msdf_range, rect_range, &slot->outline, advance);
 #else
 					fd->glyph_map[p_glyph] = FontGlyph();
 					ERR_FAIL_V_MSG(false, "Compiled without MSDFGEN support!");
 #endif
 				} else {
-					gl = rasterize_bitmap(fd, rect_range, slot->bitmap, slot->bitmap_top, slot->bitmap_left, Vector2((h + (1 << 9)) >> 10, (v + (1 << 9)) >> 10) / 64.0, bgra);
+					gl = rasterize_bitmap(fd, rect_range, slot->bitmap, slot->bitmap_top, slot->bitmap_left, advance, bgra);
 				}
 			}
 		} else {
@@ -1953,6 +2085,7 @@ _FORCE_INLINE_ void TextServerAdvanced::_font_clear_cache(FontAdvanced *p_font_d
 	p_font_data->supported_features.clear();
 	p_font_data->supported_varaitions.clear();
 	p_font_data->supported_scripts.clear();
+	p_font_data->generation.increment();
 }
 
 hb_font_t *TextServerAdvanced::_font_get_hb_handle(const RID &p_font_rid, int64_t p_size) const {
@@ -2431,6 +2564,7 @@ void TextServerAdvanced::_font_set_fixed_size(const RID &p_font_rid, int64_t p_f
 
 	MutexLock lock(fd->mutex);
 	fd->fixed_size = p_fixed_size;
+	fd->generation.increment();
 }
 
 int64_t TextServerAdvanced::_font_get_fixed_size(const RID &p_font_rid) const {
@@ -2447,6 +2581,7 @@ void TextServerAdvanced::_font_set_fixed_size_scale_mode(const RID &p_font_rid,
 
 	MutexLock lock(fd->mutex);
 	fd->fixed_size_scale_mode = p_fixed_size_scale_mode;
+	fd->generation.increment();
 }
 
 TextServer::FixedSizeScaleMode TextServerAdvanced::_font_get_fixed_size_scale_mode(const RID &p_font_rid) const {
@@ -2463,6 +2598,7 @@ void TextServerAdvanced::_font_set_allow_system_fallback(const RID &p_font_rid,
 
 	MutexLock lock(fd->mutex);
 	fd->allow_system_fallback = p_allow_system_fallback;
+	fd->generation.increment();
 }
 
 bool TextServerAdvanced::_font_is_allow_system_fallback(const RID &p_font_rid) const {
@@ -2535,6 +2671,7 @@ void TextServerAdvanced::_font_set_subpixel_positioning(const RID &p_font_rid, T
 
 	MutexLock lock(fd->mutex);
 	fd->subpixel_positioning = p_subpixel;
+	fd->generation.increment();
 }
 
 TextServer::SubpixelPositioning TextServerAdvanced::_font_get_subpixel_positioning(const RID &p_font_rid) const {
@@ -2551,6 +2688,7 @@ void TextServerAdvanced::_font_set_keep_rounding_remainders(const RID &p_font_ri
 
 	MutexLock lock(fd->mutex);
 	fd->keep_rounding_remainders = p_keep_rounding_remainders;
+	fd->generation.increment();
 }
 
 bool TextServerAdvanced::_font_get_keep_rounding_remainders(const RID &p_font_rid) const {
@@ -2586,6 +2724,7 @@ void TextServerAdvanced::_font_set_spacing(const RID &p_font_rid, SpacingType p_
 	if (fdv) {
 		if (fdv->extra_spacing[p_spacing] != p_value) {
 			fdv->extra_spacing[p_spacing] = p_value;
+			fdv->generation.increment();
 		}
 	} else {
 		FontAdvanced *fd = font_owner.get_or_null(p_font_rid);
@@ -2594,6 +2733,7 @@ void TextServerAdvanced::_font_set_spacing(const RID &p_font_rid, SpacingType p_
 		MutexLock lock(fd->mutex);
 		if (fd->extra_spacing[p_spacing] != p_value) {
 			fd->extra_spacing[p_spacing] = p_value;
+			fd->generation.increment();
 		}
 	}
 }
@@ -2617,6 +2757,7 @@ void TextServerAdvanced::_font_set_baseline_offset(const RID &p_font_rid, double
 	if (fdv) {
 		if (fdv->baseline_offset != p_baseline_offset) {
 			fdv->baseline_offset = p_baseline_offset;
+			fdv->generation.increment();
 		}
 	} else {
 		FontAdvanced *fd = font_owner.get_or_null(p_font_rid);
@@ -2736,6 +2877,7 @@ void TextServerAdvanced::_font_clear_size_cache(const RID &p_font_rid) {
 		memdelete(E.value);
 	}
 	fd->cache.clear();
+	fd->generation.increment();
 }
 
 void TextServerAdvanced::_font_remove_size_cache(const RID &p_font_rid, const Vector2i &p_size) {
@@ -2755,6 +2897,7 @@ void TextServerAdvanced::_font_remove_size_cache(const RID &p_font_rid, const Ve
 		memdelete(fd->cache[size]);
 		fd->cache.erase(size);
 	}
+	fd->generation.increment();
 }
 
 void TextServerAdvanced::_font_set_ascent(const RID &p_font_rid, int64_t p_size, double p_ascent) {
@@ -2767,6 +2910,7 @@ void TextServerAdvanced::_font_set_ascent(const RID &p_font_rid, int64_t p_size,
 	FontForSizeAdvanced *ffsd = nullptr;
 	ERR_FAIL_COND(!_ensure_cache_for_size(fd, size, ffsd));
 	ffsd->ascent = p_ascent;
+	fd->generation.increment();
 }
 
 double TextServerAdvanced::_font_get_ascent(const RID &p_font_rid, int64_t p_size) const {
@@ -2801,6 +2945,7 @@ void TextServerAdvanced::_font_set_descent(const RID &p_font_rid, int64_t p_size
 	FontForSizeAdvanced *ffsd = nullptr;
 	ERR_FAIL_COND(!_ensure_cache_for_size(fd, size, ffsd));
 	ffsd->descent = p_descent;
+	fd->generation.increment();
 }
 
 double TextServerAdvanced::_font_get_descent(const RID &p_font_rid, int64_t p_size) const {
@@ -2836,6 +2981,7 @@ void TextServerAdvanced::_font_set_underline_position(const RID &p_font_rid, int
 	FontForSizeAdvanced *ffsd = nullptr;
 	ERR_FAIL_COND(!_ensure_cache_for_size(fd, size, ffsd));
 	ffsd->underline_position = p_underline_position;
+	fd->generation.increment();
 }
 
 double TextServerAdvanced::_font_get_underline_position(const RID &p_font_rid, int64_t p_size) const {
@@ -2871,6 +3017,7 @@ void TextServerAdvanced::_font_set_underline_thickness(const RID &p_font_rid, in
 	FontForSizeAdvanced *ffsd = nullptr;
 	ERR_FAIL_COND(!_ensure_cache_for_size(fd, size, ffsd));
 	ffsd->underline_thickness = p_underline_thickness;
+	fd->generation.increment();
 }
 
 double TextServerAdvanced::_font_get_underline_thickness(const RID &p_font_rid, int64_t p_size) const {
@@ -2912,6 +3059,7 @@ void TextServerAdvanced::_font_set_scale(const RID &p_font_rid, int64_t p_size,
 	}
 #endif
 	ffsd->scale = p_scale;
+	fd->generation.increment();
 }
 
 double TextServerAdvanced::_font_get_scale(const RID &p_font_rid, int64_t p_size) const {
@@ -3091,6 +3239,7 @@ void TextServerAdvanced::_font_clear_glyphs(const RID &p_font_rid, const Vector2
 	ERR_FAIL_COND(!_ensure_cache_for_size(fd, size, ffsd));
 
 	ffsd->glyph_map.clear();
+	fd->generation.increment();
 }
 
 void TextServerAdvanced::_font_remove_glyph(const RID &p_font_rid, const Vector2i &p_size, int64_t p_glyph) {
@@ -3103,6 +3252,105 @@ void TextServerAdvanced::_font_remove_glyph(const RID &p_font_rid, const Vector2
 	ERR_FAIL_COND(!_ensure_cache_for_size(fd, size, ffsd));
 
 	ffsd->glyph_map.erase(p_glyph);
+	fd->generation.increment();
+}
+
+bool TextServerAdvanced::_font_has_glyph_cache_data(const RID &p_font_rid, const Vector2i &p_size) const {
+	FontAdvanced *fd = _get_font_data(p_font_rid);
+	ERR_FAIL_NULL_V(fd, false);
+
+	MutexLock lock(fd->mutex);
+	Vector2i size = _get_size_outline(fd, p_size);
+	FontForSizeAdvanced *ffsd = nullptr;
+	ERR_FAIL_COND_V(!_ensure_cache_for_size(fd, size, ffsd), false);
+
+	for (const KeyValue<int32_t, FontGlyph> &E : ffsd->glyph_map) {
+		if (E.value.found) {
+			return true;
+		}
+	}
+	return false;
+}
+
+PackedByteArray TextServerAdvanced::_font_get_glyph_cache_data(const RID &p_font_rid, const Vector2i &p_size) const {
+	FontAdvanced *fd = _get_font_data(p_font_rid);
+	ERR_FAIL_NULL_V(fd, PackedByteArray());
+
+	MutexLock lock(fd->mutex);
+	Vector2i size = _get_size_outline(fd, p_size);
+	FontForSizeAdvanced *ffsd = nullptr;
+	ERR_FAIL_COND_V(!_ensure_cache_for_size(fd, size, ffsd), PackedByteArray());
+
+	int64_t count = 0;
+	for (const KeyValue<int32_t, FontGlyph> &E : ffsd->glyph_map) {
+		if (E.value.found) {
+			count++;
+		}
+	}
+
+	PackedByteArray ret;
+	ret.resize(sizeof(uint32_t) * 2 + count * sizeof(FontGlyphCacheRecord));
+	uint8_t *w = ret.ptrw();
+	uint32_t header[2] = { GLYPH_CACHE_DATA_VERSION, (uint32_t)count };
+	memcpy(w, header, sizeof(header));
+
+	FontGlyphCacheRecord *rec = reinterpret_cast<FontGlyphCacheRecord *>(w + sizeof(header));
+	for (const KeyValue<int32_t, FontGlyph> &E : ffsd->glyph_map) {
+		const FontGlyph &gl = E.value;
+		if (!gl.found) {
+			continue;
+		}
+		FontGlyphCacheRecord r;
+		r.glyph = E.key;
+		r.texture_idx = gl.texture_idx;
+		r.flags = gl.from_svg ? 1 : 0;
+		r.rect[0] = gl.rect.position.x;
+		r.rect[1] = gl.rect.position.y;
+		r.rect[2] = gl.rect.size.x;
+		r.rect[3] = gl.rect.size.y;
+		r.uv_rect[0] = gl.uv_rect.position.x;
+		r.uv_rect[1] = gl.uv_rect.position.y;
+		r.uv_rect[2] = gl.uv_rect.size.x;
+		r.uv_rect[3] = gl.uv_rect.size.y;
+		r.advance[0] = gl.advance.x;
+		r.advance[1] = gl.advance.y;
+		memcpy(rec++, &r, sizeof(FontGlyphCacheRecord));
+	}
+	return ret;
+}
+
+void TextServerAdvanced::_font_set_glyph_cache_data(const RID &p_font_rid, const Vector2i &p_size, const PackedByteArray &p_data) {
+	FontAdvanced *fd = _get_font_data(p_font_rid);
+	ERR_FAIL_NULL(fd);
+
+	uint32_t header[2] = { 0, 0 };
+	ERR_FAIL_COND(p_data.size() < (int64_t)sizeof(header));
+	memcpy(header, p_data.ptr(), sizeof(header));
+	ERR_FAIL_COND_MSG(header[0] != GLYPH_CACHE_DATA_VERSION, "Unsupported glyph cache data version.");
+	ERR_FAIL_COND(p_data.size() != (int64_t)(sizeof(header) + header[1] * sizeof(FontGlyphCacheRecord)));
+
+	MutexLock lock(fd->mutex);
+	Vector2i size = _get_size_outline(fd, p_size);
+	FontForSizeAdvanced *ffsd = nullptr;
+	ERR_FAIL_COND(!_ensure_cache_for_size(fd, size, ffsd));
+
+	const FontGlyphCacheRecord *records = reinterpret_cast<const FontGlyphCacheRecord *>(p_data.ptr() + sizeof(header));
+	// Textures are stored before the glyph cache, so every record must refer to an existing one.
+	for (uint32_t i = 0; i < header[1]; i++) {
+		ERR_FAIL_COND_MSG(records[i].texture_idx < -1 || records[i].texture_idx >= ffsd->textures.size(), vformat("Glyph cache data refers to a missing texture %d.", records[i].texture_idx));
+	}
+	ffsd->glyph_map.reserve(ffsd->glyph_map.size() + header[1]);
+	for (uint32_t i = 0; i < header[1]; i++) {
+		const FontGlyphCacheRecord &r = records[i];
+		FontGlyph &gl = ffsd->glyph_map[r.glyph];
+		gl.found = true;
+		gl.texture_idx = r.texture_idx;
+		gl.from_svg = r.flags & 1;
+		gl.rect = Rect2(r.rect[0], r.rect[1], r.rect[2], r.rect[3]);
+		gl.uv_rect = Rect2(r.uv_rect[0], r.uv_rect[1], r.uv_rect[2], r.uv_rect[3]);
+		gl.advance = Vector2(r.advance[0], r.advance[1]);
+	}
+	fd->generation.increment();
 }
 
 double TextServerAdvanced::_get_extra_advance(RID p_font_rid, int p_font_size) const {
@@ -3177,6 +3425,7 @@ void TextServerAdvanced::_font_set_glyph_advance(const RID &p_font_rid, int64_t
 
 	fgl.advance = p_advance;
 	fgl.found = true;
+	fd->generation.increment();
 }
 
 Vector2 TextServerAdvanced::_font_get_glyph_offset(const RID &p_font_rid, const Vector2i &p_size, int64_t p_glyph) const {
@@ -3229,6 +3478,7 @@ void TextServerAdvanced::_font_set_glyph_offset(const RID &p_font_rid, const Vec
 
 	fgl.rect.position = p_offset;
 	fgl.found = true;
+	fd->generation.increment();
 }
 
 Vector2 TextServerAdvanced::_font_get_glyph_size(const RID &p_font_rid, const Vector2i &p_size, int64_t p_glyph) const {
@@ -3555,6 +3805,7 @@ void TextServerAdvanced::_font_clear_kerning_map(const RID &p_font_rid, int64_t
 	FontForSizeAdvanced *ffsd = nullptr;
 	ERR_FAIL_COND(!_ensure_cache_for_size(fd, size, ffsd));
 	ffsd->kerning_map.clear();
+	fd->generation.increment();
 }
 
 void TextServerAdvanced::_font_remove_kerning(const RID &p_font_rid, int64_t p_size, const Vector2i &p_glyph_pair) {
@@ -3567,6 +3818,7 @@ void TextServerAdvanced::_font_remove_kerning(const RID &p_font_rid, int64_t p_s
 	FontForSizeAdvanced *ffsd = nullptr;
 	ERR_FAIL_COND(!_ensure_cache_for_size(fd, size, ffsd));
 	ffsd->kerning_map.erase(p_glyph_pair);
+	fd->generation.increment();
 }
 
 void TextServerAdvanced::_font_set_kerning(const RID &p_font_rid, int64_t p_size, const Vector2i &p_glyph_pair, const Vector2 &p_kerning) {
@@ -3579,6 +3831,7 @@ void TextServerAdvanced::_font_set_kerning(const RID &p_font_rid, int64_t p_size
 	FontForSizeAdvanced *ffsd = nullptr;
 	ERR_FAIL_COND(!_ensure_cache_for_size(fd, size, ffsd));
 	ffsd->kerning_map[p_glyph_pair] = p_kerning;
+	fd->generation.increment();
 }
 
 Vector2 TextServerAdvanced::_font_get_kerning(const RID &p_font_rid, int64_t p_size, const Vector2i &p_glyph_pair) const {
@@ -3844,6 +4097,104 @@ void TextServerAdvanced::_font_render_glyph(const RID &p_font_rid, const Vector2
 #endif
 }
 
+void TextServerAdvanced::_font_render_glyphs(const RID &p_font_rid, const Vector2i &p_size, const PackedInt32Array &p_glyphs) {
+	FontAdvanced *fd = _get_font_data(p_font_rid);
+	ERR_FAIL_NULL(fd);
+
+	MutexLock lock(fd->mutex);
+	Vector2i size = _get_size_outline(fd, p_size);
+	FontForSizeAdvanced *ffsd = nullptr;
+	ERR_FAIL_COND(!_ensure_cache_for_size(fd, size, ffsd));
+#ifdef MODULE_FREETYPE_ENABLED
+	if (!ffsd->face) {
+		return;
+	}
+
+	// Collect all glyph variants which are not in the cache yet.
+	int layouts = (fd->antialiasing == FONT_ANTIALIASING_LCD && !fd->msdf) ? FONT_LCD_SUBPIXEL_LAYOUT_MAX : 1;
+	int shifts = 1;
+	if (!fd->msdf) {
+		if ((fd->subpixel_positioning == SUBPIXEL_POSITIONING_ONE_QUARTER) || (fd->subpixel_positioning == SUBPIXEL_POSITIONING_AUTO && size.x <= SUBPIXEL_POSITIONING_ONE_QUARTER_MAX_SIZE * 64)) {
+			shifts = 4;
+		} else if ((fd->subpixel_positioning == SUBPIXEL_POSITIONING_ONE_HALF) || (fd->subpixel_positioning == SUBPIXEL_POSITIONING_AUTO && size.x <= SUBPIXEL_POSITIONING_ONE_HALF_MAX_SIZE * 64)) {
+			shifts = 2;
+		}
+	}
+	LocalVector<int32_t> keys;
+	HashSet<int32_t> queued;
+	for (int32_t glyph : p_glyphs) {
+		int32_t idx = glyph & 0xffffff; // Remove subpixel shifts.
+		for (int aa = 0; aa < layouts; aa++) {
+			for (int shift = 0; shift < shifts; shift++) {
+				int32_t key = idx | (shift << 27) | (aa << 24);
+				if (!ffsd->glyph_map.has(key) && !queued.has(key)) {
+					queued.insert(key);
+					keys.push_back(key);
+				}
+			}
+		}
+	}
+
+	// Each slice gets its own face, FreeType faces can't be shared between threads.
+	// MSDF and SVG glyphs use shared generator state, those are rendered one by one.
+	LocalVector<FT_Face> faces;
+	int slices = MIN((int)keys.size() / GLYPH_BATCH_SLICE_MIN_SIZE, WorkerThreadPool::get_singleton()->get_thread_count());
+	if (!fd->msdf && !FT_HAS_SVG(ffsd->face) && slices > 1) {
+		MutexLock ftlock(ft_mutex);
+		for (int i = 0; i < slices; i++) {
+			FT_Face face = _create_face_for_size(fd, ffsd);
+			if (!face) {
+				break;
+			}
+			faces.push_back(face);
+		}
+	}
+	if (faces.is_empty()) {
+		for (int32_t key : keys) {
+			FontGlyph fgl;
+			_ensure_glyph(fd, size, key, fgl);
+		}
+		return;
+	}
+
+	LocalVector<FontGlyphBitmap> staged;
+	staged.resize(keys.size());
+	for (uint32_t i = 0; i < keys.size(); i++) {
+		staged[i].glyph = keys[i];
+	}
+
+	GlyphRenderThreadData td;
+	td.ts = this;
+	td.font_data = fd;
+	td.size = size;
+	td.faces = faces.ptr();
+	td.glyphs = staged.ptr();
+	td.glyph_count = staged.size();
+	td.slice_size = Math::division_round_up(td.glyph_count, faces.size());
+
+	WorkerThreadPool::GroupID group_task = WorkerThreadPool::get_singleton()->add_native_group_task(&TextServerAdvanced::_render_glyphs_threaded, &td, faces.size(), -1, true, String("FontServerRenderGlyphs"));
+	WorkerThreadPool::get_singleton()->wait_for_group_task_completion(group_task);
+
+	{
+		MutexLock ftlock(ft_mutex);
+		for (FT_Face face : faces) {
+			FT_Done_Face(face);
+		}
+	}
+
+	// Pack all rendered bitmaps into the cache textures at once.
+	for (FontGlyphBitmap &gb : staged) {
+		FontGlyph gl;
+		if (gb.loaded) {
+			gb.bitmap.buffer = gb.data.ptrw();
+			gl = rasterize_bitmap(ffsd, rect_range, gb.bitmap, gb.top, gb.left, gb.advance, gb.bgra);
+			gl.from_svg = gb.from_svg;
+		}
+		ffsd->glyph_map.insert(gb.glyph, gl);
+	}
+#endif
+}
+
 void TextServerAdvanced::_font_draw_glyph(const RID &p_font_rid, const RID &p_canvas, int64_t p_size, const Vector2 &p_pos, int64_t p_index, const Color &p_color, float p_oversampling) const {
 	if (p_index == 0) {
 		return; // Non visual character, skip.
@@ -4146,6 +4497,7 @@ void TextServerAdvanced::_font_set_language_support_override(const RID &p_font_r
 
 	MutexLock lock(fd->mutex);
 	fd->language_support_overrides[p_language] = p_supported;
+	fd->generation.increment();
 }
 
 bool TextServerAdvanced::_font_get_language_support_override(const RID &p_font_rid, const String &p_language) {
@@ -4162,6 +4514,7 @@ void TextServerAdvanced::_font_remove_language_support_override(const RID &p_fon
 
 	MutexLock lock(fd->mutex);
 	fd->language_support_overrides.erase(p_language);
+	fd->generation.increment();
 }
 
 PackedStringArray TextServerAdvanced::_font_get_language_support_overrides(const RID &p_font_rid) {
@@ -4197,6 +4550,7 @@ void TextServerAdvanced::_font_set_script_support_override(const RID &p_font_rid
 
 	MutexLock lock(fd->mutex);
 	fd->script_support_overrides[p_script] = p_supported;
+	fd->generation.increment();
 }
 
 bool TextServerAdvanced::_font_get_script_support_override(const RID &p_font_rid, const String &p_script) {
@@ -4213,6 +4567,7 @@ void TextServerAdvanced::_font_remove_script_support_override(const RID &p_font_
 
 	MutexLock lock(fd->mutex);
 	fd->script_support_overrides.erase(p_script);
+	fd->generation.increment();
 }
 
 PackedStringArray TextServerAdvanced::_font_get_script_support_overrides(const RID &p_font_rid) {
@@ -4236,6 +4591,7 @@ void TextServerAdvanced::_font_set_opentype_feature_overrides(const RID &p_font_
 	FontForSizeAdvanced *ffsd = nullptr;
 	ERR_FAIL_COND(!_ensure_cache_for_size(fd, size, ffsd));
 	fd->feature_overrides = p_overrides;
+	fd->generation.increment();
 }
 
 Dictionary TextServerAdvanced::_font_get_opentype_feature_overrides(const RID &p_font_rid) const {
@@ -6826,6 +7182,91 @@ void TextServerAdvanced::_shape_run(ShapedTextDataAdvanced *p_sd, int64_t p_star
 	}
 }
 
+bool TextServerAdvanced::ShapedTextCacheKey::operator==(const ShapedTextCacheKey &p_b) const {
+	if (hash != p_b.hash || flags != p_b.flags || start != p_b.start || text != p_b.text || locale != p_b.locale || spans.size() != p_b.spans.size() || bidi_override != p_b.bidi_override) {
+		return false;
+	}
+	for (int i = 0; i < 4; i++) {
+		if (extra_spacing[i] != p_b.extra_spacing[i]) {
+			return false;
+		}
+	}
+	for (int i = 0; i < spans.size(); i++) {
+		const ShapedTextDataAdvanced::Span &a = spans[i];
+		const ShapedTextDataAdvanced::Span &b = p_b.spans[i];
+		if (a.start != b.start || a.end != b.end || a.font_size != b.font_size || a.language != b.language || a.fonts != b.fonts || a.features != b.features) {
+			return false;
+		}
+	}
+	return font_generations == p_b.font_generations;
+}
+
+bool TextServerAdvanced::_shaped_cache_make_key(const ShapedTextDataAdvanced *p_sd, ShapedTextCacheKey &r_key) const {
+	if (p_sd->parent != RID() || p_sd->text.length() > SHAPED_CACHE_MAX_GLYPHS) {
+		return false;
+	}
+
+	uint32_t hash = p_sd->text.hash();
+	bool default_language = false;
+	for (const ShapedTextDataAdvanced::Span &span : p_sd->spans) {
+		if (span.embedded_key != Variant()) {
+			return false; // Object positions are stored outside of the glyph buffer.
+		}
+		default_language = default_language || span.language.is_empty();
+		hash = hash_murmur3_one_32(span.start, hash);
+		hash = hash_murmur3_one_32(span.end, hash);
+		hash = hash_murmur3_one_32(span.font_size, hash);
+		hash = hash_murmur3_one_32(span.fonts.hash(), hash);
+		hash = hash_murmur3_one_32(span.language.hash(), hash);
+		hash = hash_murmur3_one_32(span.features.hash(), hash);
+		for (int i = 0; i < span.fonts.size(); i++) {
+			// Font changes only bump the generation of the font, so the key records the generations used for shaping.
+			RID font_rid = span.fonts[i];
+			uint64_t var_generation = 0;
+			FontAdvancedLinkedVariation *fdv = font_var_owner.get_or_null(font_rid);
+			if (fdv) {
+				var_generation = fdv->generation.get();
+				font_rid = fdv->base_font;
+			}
+			FontAdvanced *fd = font_owner.get_or_null(font_rid);
+			if (!fd) {
+				return false;
+			}
+			r_key.font_generations.push_back(var_generation);
+			r_key.font_generations.push_back(fd->generation.get());
+			hash = hash_murmur3_one_64(var_generation, hash);
+			hash = hash_murmur3_one_64(fd->generation.get(), hash);
+		}
+	}
+	for (const Vector3i &ov : p_sd->bidi_override) {
+		hash = hash_murmur3_one_32(ov.x, hash);
+		hash = hash_murmur3_one_32(ov.y, hash);
+		hash = hash_murmur3_one_32(ov.z, hash);
+	}
+	if (default_language) {
+		// Spans without language are shaped using the current locale.
+		r_key.locale = TranslationServer::get_singleton()->get_tool_locale();
+		hash = hash_murmur3_one_32(r_key.locale.hash(), hash);
+	}
+	for (int i = 0; i < 4; i++) {
+		r_key.extra_spacing[i] = p_sd->extra_spacing[i];
+		hash = hash_murmur3_one_32(p_sd->extra_spacing[i], hash);
+	}
+
+	r_key.text = p_sd->text;
+	r_key.spans = p_sd->spans;
+	r_key.bidi_override = p_sd->bidi_override;
+	r_key.start = p_sd->start;
+	r_key.flags = ((int)p_sd->direction) | ((int)p_sd->orientation << 4) | ((int)p_sd->preserve_invalid << 8) | ((int)p_sd->preserve_control << 9);
+	r_key.hash = hash_fmix32(hash_murmur3_one_32(r_key.flags, hash_murmur3_one_32(r_key.start, hash)));
+	return true;
+}
+
+void TextServerAdvanced::_shaped_cache_clear() {
+	shaped_cache.clear();
+	shaped_cache_lru.clear();
+}
+
 bool TextServerAdvanced::_shaped_text_shape(const RID &p_shaped) {
 	_THREAD_SAFE_METHOD_
 	ShapedTextDataAdvanced *sd = shaped_owner.get_or_null(p_shaped);
@@ -6850,6 +7291,25 @@ bool TextServerAdvanced::_shaped_text_shape(const RID &p_shaped) {
 		return true;
 	}
 
+	// Reuse glyphs of an identical string, BiDi iterators are still created, since they are used for line breaking.
+	ShapedTextCacheKey cache_key;
+	bool cacheable = _shaped_cache_make_key(sd, cache_key);
+	bool cache_hit = false;
+	if (cacheable) {
+		List<ShapedTextCacheEntry>::Element **E = shaped_cache.getptr(cache_key);
+		if (E) {
+			shaped_cache_lru.move_to_front(*E);
+			const ShapedTextCacheEntry &entry = (*E)->get();
+			sd->glyphs = entry.glyphs;
+			sd->ascent = entry.ascent;
+			sd->descent = entry.descent;
+			sd->width = entry.width;
+			sd->upos = entry.upos;
+			sd->uthk = entry.uthk;
+			cache_hit = true;
+		}
+	}
+
 	sd->utf16 = sd->text.utf16();
 	const UChar *data = sd->utf16.get_data();
 
@@ -6934,6 +7394,9 @@ bool TextServerAdvanced::_shaped_text_shape(const RID &p_shaped) {
 			ERR_PRINT(vformat("BiDi iterator allocation for the paragraph failed: %s", u_errorName(err)));
 		}
 		sd->bidi_iter.push_back(bidi_iter);
+		if (cache_hit) {
+			continue;
+		}
 
 		err = U_ZERO_ERROR;
 		int bidi_run_count = 1;
@@ -7044,7 +7507,29 @@ bool TextServerAdvanced::_shaped_text_shape(const RID &p_shaped) {
 		}
 	}
 
-	_realign(sd);
+	if (!cache_hit) {
+		_realign(sd);
+	}
+
+	if (cacheable && !cache_hit && sd->glyphs.size() <= SHAPED_CACHE_MAX_GLYPHS) {
+		// Fonts changed while shaping have a newer generation than the key, so the entry is never matched.
+		if (!shaped_cache.has(cache_key)) {
+			ShapedTextCacheEntry entry;
+			entry.key = cache_key;
+			entry.glyphs = sd->glyphs;
+			entry.ascent = sd->ascent;
+			entry.descent = sd->descent;
+			entry.width = sd->width;
+			entry.upos = sd->upos;
+			entry.uthk = sd->uthk;
+			shaped_cache[cache_key] = shaped_cache_lru.push_front(entry);
+			while (shaped_cache_lru.size() > SHAPED_CACHE_CAPACITY) {
+				shaped_cache.erase(shaped_cache_lru.back()->get().key);
+				shaped_cache_lru.pop_back();
+			}
+		}
+	}
+
 	sd->valid.set();
 	return sd->valid.is_set();
 }
@@ -8053,6 +8538,7 @@ void TextServerAdvanced::_font_clear_system_fallback_cache() {
 	}
 	system_fonts.clear();
 	system_font_data.clear();
+	_shaped_cache_clear();
 }
 
 void TextServerAdvanced::_cleanup() {
@@ -269,6 +269,34 @@ class TextServerAdvanced : public TextServerExtension {
 		bool from_svg = false;
 	};
 
+	// Flat glyph record used by `font_get_glyph_cache_data`, loaded with a single copy.
+	static const uint32_t GLYPH_CACHE_DATA_VERSION = 1;
+	struct FontGlyphCacheRecord {
+		int32_t glyph = 0;
+		int32_t texture_idx = -1;
+		uint32_t flags = 0;
+		float rect[4] = {};
+		float uv_rect[4] = {};
+		float advance[2] = {};
+	};
+	static_assert(sizeof(FontGlyphCacheRecord) == 52);
+
+#ifdef MODULE_FREETYPE_ENABLED
+	// Glyph bitmap rendered by `font_render_glyphs` worker, waiting to be packed into the cache textures.
+	static const int GLYPH_BATCH_SLICE_MIN_SIZE = 16;
+	struct FontGlyphBitmap {
+		int32_t glyph = 0;
+		bool loaded = false;
+		bool from_svg = false;
+		bool bgra = false;
+		Vector2 advance;
+		int top = 0;
+		int left = 0;
+		FT_Bitmap bitmap = {};
+		Vector<uint8_t> data;
+	};
+#endif
+
 	struct FontAdvanced;
 	struct FontForSizeAdvanced {
 		double ascent = 0.0;
@@ -316,10 +344,16 @@ class TextServerAdvanced : public TextServerExtension {
 		RID base_font;
 		int extra_spacing[4] = { 0, 0, 0, 0 };
 		double baseline_offset = 0.0;
+		SafeNumeric<uint64_t> generation; // Incremented on changes that affect shaping, see ShapedTextCacheKey.
 	};
 
 	struct FontAdvanced {
+#ifdef GDEXTENSION
 		Mutex mutex;
+#else
+		Mutex mutex{ "TextServerAdvanced font" }; // Named for lock contention statistics.
+#endif
+		SafeNumeric<uint64_t> generation; // Incremented on changes that affect shaping, see ShapedTextCacheKey.
 
 		TextServer::FontAntialiasing antialiasing = TextServer::FONT_ANTIALIASING_GRAY;
 		bool disable_embedded_bitmaps = true;
@@ -378,6 +412,22 @@ class TextServerAdvanced : public TextServerExtension {
 #endif
 #ifdef MODULE_FREETYPE_ENABLED
 	_FORCE_INLINE_ FontGlyph rasterize_bitmap(FontForSizeAdvanced *p_data, int p_rect_margin, FT_Bitmap p_bitmap, int p_yofs, int p_xofs, const Vector2 &p_advance, bool p_bgra) const;
+#endif
+#ifdef MODULE_FREETYPE_ENABLED
+	struct GlyphRenderThreadData {
+		const TextServerAdvanced *ts = nullptr;
+		const FontAdvanced *font_data = nullptr;
+		Vector2i size;
+		FT_Face *faces = nullptr;
+		FontGlyphBitmap *glyphs = nullptr;
+		uint32_t glyph_count = 0;
+		uint32_t slice_size = 0;
+	};
+
+	_FORCE_INLINE_ int _load_glyph(const FontAdvanced *p_font_data, FT_Face p_face, const Vector2i &p_size, int32_t p_glyph, FT_Render_Mode &r_aa_mode, bool &r_bgra, Vector2 &r_advance) const;
+	void _render_glyph_bitmap(const FontAdvanced *p_font_data, FT_Face p_face, const Vector2i &p_size, FontGlyphBitmap &r_glyph) const;
+	FT_Face _create_face_for_size(const FontAdvanced *p_font_data, const FontForSizeAdvanced *p_ffsd) const;
+	static void _render_glyphs_threaded(void *p_td, uint32_t p_slice);
 #endif
 	_FORCE_INLINE_ bool _ensure_glyph(FontAdvanced *p_font_data, const Vector2i &p_size, int32_t p_glyph, FontGlyph &r_glyph, uint32_t p_oversampling = 0) const;
 	_FORCE_INLINE_ bool _ensure_cache_for_size(FontAdvanced *p_font_data, const Vector2i &p_size, FontForSizeAdvanced *&r_cache_for_size, bool p_silent = false, uint32_t p_oversampling = 0) const;
@@ -679,6 +729,47 @@ class TextServerAdvanced : public TextServerExtension {
 	mutable HashMap<SystemFontKey, SystemFontCache, SystemFontKeyHasher> system_fonts;
 	mutable HashMap<String, PackedByteArray> system_font_data;
 
+	// Shaping results shared between shaped texts with identical content (glyph buffers are copy-on-write).
+	static const int SHAPED_CACHE_CAPACITY = 1024;
+	static const int SHAPED_CACHE_MAX_GLYPHS = 256;
+
+	struct ShapedTextCacheKey {
+		String text;
+		String locale;
+		Vector<ShapedTextDataAdvanced::Span> spans;
+		Vector<Vector3i> bidi_override;
+		Vector<uint64_t> font_generations; // Entries of modified fonts are never matched again and age out of the LRU.
+		int extra_spacing[4] = { 0, 0, 0, 0 };
+		int start = 0;
+		uint32_t flags = 0;
+		uint32_t hash = 0;
+
+		bool operator==(const ShapedTextCacheKey &p_b) const;
+	};
+
+	struct ShapedTextCacheKeyHasher {
+		_FORCE_INLINE_ static uint32_t hash(const ShapedTextCacheKey &p_a) {
+			return p_a.hash;
+		}
+	};
+
+	struct ShapedTextCacheEntry {
+		ShapedTextCacheKey key;
+		Vector<Glyph> glyphs;
+		double ascent = 0.0;
+		double descent = 0.0;
+		double width = 0.0;
+		double upos = 0.0;
+		double uthk = 0.0;
+	};
+
+	// Only used by methods holding the class lock.
+	List<ShapedTextCacheEntry> shaped_cache_lru; // Most recently used first.
+	HashMap<ShapedTextCacheKey, List<ShapedTextCacheEntry>::Element *, ShapedTextCacheKeyHasher> shaped_cache;
+
+	bool _shaped_cache_make_key(const ShapedTextDataAdvanced *p_sd, ShapedTextCacheKey &r_key) const;
+	void _shaped_cache_clear();
+
 	void _update_chars(ShapedTextDataAdvanced *p_sd) const;
 	void _generate_runs(ShapedTextDataAdvanced *p_sd) const;
 	void _realign(ShapedTextDataAdvanced *p_sd) const;
@@ -878,6 +969,10 @@ public:
 	MODBIND2(font_clear_glyphs, const RID &, const Vector2i &);
 	MODBIND3(font_remove_glyph, const RID &, const Vector2i &, int64_t);
 
+	MODBIND2RC(bool, font_has_glyph_cache_data, const RID &, const Vector2i &);
+	MODBIND2RC(PackedByteArray, font_get_glyph_cache_data, const RID &, const Vector2i &);
+	MODBIND3(font_set_glyph_cache_data, const RID &, const Vector2i &, const PackedByteArray &);
+
 	MODBIND3RC(Vector2, font_get_glyph_advance, const RID &, int64_t, int64_t);
 	MODBIND4(font_set_glyph_advance, const RID &, int64_t, int64_t, const Vector2 &);
 
@@ -914,6 +1009,7 @@ public:
 
 	MODBIND4(font_render_range, const RID &, const Vector2i &, int64_t, int64_t);
 	MODBIND3(font_render_glyph, const RID &, const Vector2i &, int64_t);
+	MODBIND3(font_render_glyphs, const RID &, const Vector2i &, const PackedInt32Array &);
 
 	MODBIND7C(font_draw_glyph, const RID &, const RID &, int64_t, const Vector2 &, int64_t, const Color &, float);
 	MODBIND8C(font_draw_glyph_outline, const RID &, const RID &, int64_t, int64_t, const Vector2 &, int64_t, const Color &, float);
@@ -2106,6 +2106,103 @@ void TextServerFallback::_font_remove_glyph(const RID &p_font_rid, const Vector2
 	ffsd->glyph_map.erase(p_glyph);
 }
 
+bool TextServerFallback::_font_has_glyph_cache_data(const RID &p_font_rid, const Vector2i &p_size) const {
+	FontFallback *fd = _get_font_data(p_font_rid);
+	ERR_FAIL_NULL_V(fd, false);
+
+	MutexLock lock(fd->mutex);
+	Vector2i size = _get_size_outline(fd, p_size);
+	FontForSizeFallback *ffsd = nullptr;
+	ERR_FAIL_COND_V(!_ensure_cache_for_size(fd, size, ffsd), false);
+
+	for (const KeyValue<int32_t, FontGlyph> &E : ffsd->glyph_map) {
+		if (E.value.found) {
+			return true;
+		}
+	}
+	return false;
+}
+
+PackedByteArray TextServerFallback::_font_get_glyph_cache_data(const RID &p_font_rid, const Vector2i &p_size) const {
+	FontFallback *fd = _get_font_data(p_font_rid);
+	ERR_FAIL_NULL_V(fd, PackedByteArray());
+
+	MutexLock lock(fd->mutex);
+	Vector2i size = _get_size_outline(fd, p_size);
+	FontForSizeFallback *ffsd = nullptr;
+	ERR_FAIL_COND_V(!_ensure_cache_for_size(fd, size, ffsd), PackedByteArray());
+
+	int64_t count = 0;
+	for (const KeyValue<int32_t, FontGlyph> &E : ffsd->glyph_map) {
+		if (E.value.found) {
+			count++;
+		}
+	}
+
+	PackedByteArray ret;
+	ret.resize(sizeof(uint32_t) * 2 + count * sizeof(FontGlyphCacheRecord));
+	uint8_t *w = ret.ptrw();
+	uint32_t header[2] = { GLYPH_CACHE_DATA_VERSION, (uint32_t)count };
+	memcpy(w, header, sizeof(header));
+
+	FontGlyphCacheRecord *rec = reinterpret_cast<FontGlyphCacheRecord *>(w + sizeof(header));
+	for (const KeyValue<int32_t, FontGlyph> &E : ffsd->glyph_map) {
+		const FontGlyph &gl = E.value;
+		if (!gl.found) {
+			continue;
+		}
+		FontGlyphCacheRecord r;
+		r.glyph = E.key;
+		r.texture_idx = gl.texture_idx;
+		r.flags = gl.from_svg ? 1 : 0;
+		r.rect[0] = gl.rect.position.x;
+		r.rect[1] = gl.rect.position.y;
+		r.rect[2] = gl.rect.size.x;
+		r.rect[3] = gl.rect.size.y;
+		r.uv_rect[0] = gl.uv_rect.position.x;
+		r.uv_rect[1] = gl.uv_rect.position.y;
+		r.uv_rect[2] = gl.uv_rect.size.x;
+		r.uv_rect[3] = gl.uv_rect.size.y;
+		r.advance[0] = gl.advance.x;
+		r.advance[1] = gl.advance.y;
+		memcpy(rec++, &r, sizeof(FontGlyphCacheRecord));
+	}
+	return ret;
+}
+
+void TextServerFallback::_font_set_glyph_cache_data(const RID &p_font_rid, const Vector2i &p_size, const PackedByteArray &p_data) {
+	FontFallback *fd = _get_font_data(p_font_rid);
+	ERR_FAIL_NULL(fd);
+
+	uint32_t header[2] = { 0, 0 };
+	ERR_FAIL_COND(p_data.size() < (int64_t)sizeof(header));
+	memcpy(header, p_data.ptr(), sizeof(header));
+	ERR_FAIL_COND_MSG(header[0] != GLYPH_CACHE_DATA_VERSION, "Unsupported glyph cache data version.");
+	ERR_FAIL_COND(p_data.size() != (int64_t)(sizeof(header) + header[1] * sizeof(FontGlyphCacheRecord)));
+
+	MutexLock lock(fd->mutex);
+	Vector2i size = _get_size_outline(fd, p_size);
+	FontForSizeFallback *ffsd = nullptr;
+	ERR_FAIL_COND(!_ensure_cache_for_size(fd, size, ffsd));
+
+	const FontGlyphCacheRecord *records = reinterpret_cast<const FontGlyphCacheRecord *>(p_data.ptr() + sizeof(header));
+	// Textures are stored before the glyph cache, so every record must refer to an existing one.
+	for (uint32_t i = 0; i < header[1]; i++) {
+		ERR_FAIL_COND_MSG(records[i].texture_idx < -1 || records[i].texture_idx >= ffsd->textures.size(), vformat("Glyph cache data refers to a missing texture %d.", records[i].texture_idx));
+	}
+	ffsd->glyph_map.reserve(ffsd->glyph_map.size() + header[1]);
+	for (uint32_t i = 0; i < header[1]; i++) {
+		const FontGlyphCacheRecord &r = records[i];
+		FontGlyph &gl = ffsd->glyph_map[r.glyph];
+		gl.found = true;
+		gl.texture_idx = r.texture_idx;
+		gl.from_svg = r.flags & 1;
+		gl.rect = Rect2(r.rect[0], r.rect[1], r.rect[2], r.rect[3]);
+		gl.uv_rect = Rect2(r.uv_rect[0], r.uv_rect[1], r.uv_rect[2], r.uv_rect[3]);
+		gl.advance = Vector2(r.advance[0], r.advance[1]);
+	}
+}
+
 Vector2 TextServerFallback::_font_get_glyph_advance(const RID &p_font_rid, int64_t p_size, int64_t p_glyph) const {
 	FontFallback *fd = _get_font_data(p_font_rid);
 	ERR_FAIL_NULL_V(fd, Vector2());
@@ -221,6 +221,18 @@ class TextServerFallback : public TextServerExtension {
 		bool from_svg = false;
 	};
 
+	// Flat glyph record used by `font_get_glyph_cache_data`, loaded with a single copy.
+	static const uint32_t GLYPH_CACHE_DATA_VERSION = 1;
+	struct FontGlyphCacheRecord {
+		int32_t glyph = 0;
+		int32_t texture_idx = -1;
+		uint32_t flags = 0;
+		float rect[4] = {};
+		float uv_rect[4] = {};
+		float advance[2] = {};
+	};
+	static_assert(sizeof(FontGlyphCacheRecord) == 52);
+
 	struct FontFallback;
 	struct FontForSizeFallback {
 		double ascent = 0.0;
@@ -266,7 +278,11 @@ class TextServerFallback : public TextServerExtension {
 	};
 
 	struct FontFallback {
+#ifdef GDEXTENSION
 		Mutex mutex;
+#else
+		Mutex mutex{ "TextServerFallback font" }; // Named for lock contention statistics.
+#endif
 
 		TextServer::FontAntialiasing antialiasing = TextServer::FONT_ANTIALIASING_GRAY;
 		bool disable_embedded_bitmaps = true;
@@ -741,6 +757,10 @@ public:
 	MODBIND2(font_clear_glyphs, const RID &, const Vector2i &);
 	MODBIND3(font_remove_glyph, const RID &, const Vector2i &, int64_t);
 
+	MODBIND2RC(bool, font_has_glyph_cache_data, const RID &, const Vector2i &);
+	MODBIND2RC(PackedByteArray, font_get_glyph_cache_data, const RID &, const Vector2i &);
+	MODBIND3(font_set_glyph_cache_data, const RID &, const Vector2i &, const PackedByteArray &);
+
 	MODBIND3RC(Vector2, font_get_glyph_advance, const RID &, int64_t, int64_t);
 	MODBIND4(font_set_glyph_advance, const RID &, int64_t, int64_t, const Vector2 &);
 
@@ -227,6 +227,7 @@ bool AudioStreamPlaybackOggVorbis::_alloc_vorbis() {
 
 void AudioStreamPlaybackOggVorbis::start(double p_from_pos) {
 	ERR_FAIL_COND(!ready);
+	MutexLock lock(decoder_mutex);
 	loop_fade_remaining = FADE_SIZE;
 	active = true;
 	seek(p_from_pos);
@@ -235,11 +236,14 @@ void AudioStreamPlaybackOggVorbis::start(double p_from_pos) {
 }
 
 void AudioStreamPlaybackOggVorbis::stop() {
+	MutexLock lock(decoder_mutex);
 	active = false;
+	_discard_decoded_ahead();
 }
 
 bool AudioStreamPlaybackOggVorbis::is_playing() const {
-	return active;
+	// The decoder may be done while frames decoded ahead remain to be mixed.
+	return active || _get_decoded_ahead_frames() > 0;
 }
 
 int AudioStreamPlaybackOggVorbis::get_loop_count() const {
@@ -247,7 +251,8 @@ int AudioStreamPlaybackOggVorbis::get_loop_count() const {
 }
 
 double AudioStreamPlaybackOggVorbis::get_playback_position() const {
-	return double(frames_mixed) / (double)vorbis_data->get_sampling_rate();
+	int64_t frames = MAX(0, int64_t(frames_mixed) - _get_decoded_ahead_frames());
+	return double(frames) / (double)vorbis_data->get_sampling_rate();
 }
 
 void AudioStreamPlaybackOggVorbis::tag_used_streams() {
@@ -273,12 +278,36 @@ Variant AudioStreamPlaybackOggVorbis::get_parameter(const StringName &p_name) co
 	return Variant();
 }
 
+double AudioStreamPlaybackOggVorbis::get_position_after(double p_from_pos, double p_time) const {
+	double position = p_from_pos + p_time;
+	// Same as `_mix_internal()`, which loops at the end of the last beat if the beat count is set.
+	double loop_end = vorbis_stream->get_length();
+	if (vorbis_stream->get_bpm() > 0 && vorbis_stream->get_beat_count() > 0) {
+		loop_end = vorbis_stream->get_beat_count() * 60.0 / vorbis_stream->get_bpm();
+	}
+	if (position < loop_end) {
+		return position;
+	}
+
+	bool use_loop = looping_override ? looping : vorbis_stream->loop;
+	if (!use_loop) {
+		return -1.0;
+	}
+	double loop_offset = vorbis_stream->loop_offset;
+	if (loop_end <= loop_offset) {
+		return loop_offset;
+	}
+	return loop_offset + Math::fmod(position - loop_offset, loop_end - loop_offset);
+}
+
 void AudioStreamPlaybackOggVorbis::seek(double p_time) {
 	ERR_FAIL_COND(!ready);
 	ERR_FAIL_COND(vorbis_stream.is_null());
+	MutexLock lock(decoder_mutex);
 	if (!active) {
 		return;
 	}
+	_discard_decoded_ahead();
 
 	if (p_time >= vorbis_stream->get_length()) {
 		p_time = 0;
@@ -392,6 +421,7 @@ void AudioStreamPlaybackOggVorbis::set_sample_playback(const Ref<AudioSamplePlay
 }
 
 AudioStreamPlaybackOggVorbis::~AudioStreamPlaybackOggVorbis() {
+	_set_decode_ahead_enabled(false);
 	if (block_is_allocated) {
 		vorbis_block_clear(&block);
 	}
@@ -418,6 +448,7 @@ Ref<AudioStreamPlayback> AudioStreamOggVorbis::instantiate_playback() {
 	ovs->active = false;
 	ovs->loops = 0;
 	if (ovs->_alloc_vorbis()) {
+		ovs->_set_decode_ahead_enabled(true);
 		return ovs;
 	}
 	// Failed to allocate data structures.
@@ -97,6 +97,7 @@ public:
 
 	virtual double get_playback_position() const override;
 	virtual void seek(double p_time) override;
+	virtual double get_position_after(double p_from_pos, double p_time) const override;
 
 	virtual void tag_used_streams() override;
 
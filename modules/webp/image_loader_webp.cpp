@@ -36,6 +36,10 @@
 #include <webp/encode.h>
 
 static Ref<Image> _webp_mem_loader_func(const uint8_t *p_webp_data, int p_size) {
+	ERR_FAIL_COND_V(p_size < 12, Ref<Image>());
+	// A WebP file uses a RIFF header, which starts with "RIFF____WEBP".
+	ERR_FAIL_COND_V(p_webp_data[0] != 'R' || p_webp_data[1] != 'I' || p_webp_data[2] != 'F' || p_webp_data[3] != 'F' || p_webp_data[8] != 'W' || p_webp_data[9] != 'E' || p_webp_data[10] != 'B' || p_webp_data[11] != 'P', Ref<Image>());
+
 	Ref<Image> img;
 	img.instantiate();
 	Error err = WebPCommon::webp_load_image_from_buffer(img.ptr(), p_webp_data, p_size);
@@ -47,13 +51,16 @@ Error ImageLoaderWebP::load_image(Ref<Image> p_image, Ref<FileAccess> f, BitFiel
 	Vector<uint8_t> src_image;
 	uint64_t src_image_len = f->get_length();
 	ERR_FAIL_COND_V(src_image_len == 0, ERR_FILE_CORRUPT);
-	src_image.resize(src_image_len);
-
-	uint8_t *w = src_image.ptrw();
 
-	f->get_buffer(&w[0], src_image_len);
+	const uint8_t *r = f->get_buffer_view(src_image_len);
+	if (!r) {
+		src_image.resize(src_image_len);
+		uint8_t *w = src_image.ptrw();
+		f->get_buffer(&w[0], src_image_len);
+		r = src_image.ptr();
+	}
 
-	Error err = WebPCommon::webp_load_image_from_buffer(p_image.ptr(), w, src_image_len);
+	Error err = WebPCommon::webp_load_image_from_buffer(p_image.ptr(), r, src_image_len);
 
 	return err;
 }
@@ -64,7 +64,7 @@ void AudioStreamPlayer2D::_notification(int p_what) {
 
 			if (setplayback.is_valid() && setplay.get() >= 0) {
 				internal->active.set();
-				AudioServer::get_singleton()->start_playback_stream(setplayback, _get_actual_bus(), volume_vector, setplay.get(), internal->pitch_scale);
+				AudioServer::get_singleton()->start_playback_stream(setplayback, _get_actual_bus(), volume_vector, setplay.get(), internal->pitch_scale, internal->voice_priority);
 				setplayback.unref();
 				setplay.set(-1);
 			}
@@ -345,6 +345,14 @@ int AudioStreamPlayer2D::get_max_polyphony() const {
 	return internal->max_polyphony;
 }
 
+void AudioStreamPlayer2D::set_voice_priority(int p_voice_priority) {
+	internal->set_voice_priority(p_voice_priority);
+}
+
+int AudioStreamPlayer2D::get_voice_priority() const {
+	return internal->voice_priority;
+}
+
 void AudioStreamPlayer2D::set_panning_strength(float p_panning_strength) {
 	ERR_FAIL_COND_MSG(p_panning_strength < 0, "Panning strength must be a positive number.");
 	panning_strength = p_panning_strength;
@@ -417,6 +425,9 @@ void AudioStreamPlayer2D::_bind_methods() {
 	ClassDB::bind_method(D_METHOD("set_max_polyphony", "max_polyphony"), &AudioStreamPlayer2D::set_max_polyphony);
 	ClassDB::bind_method(D_METHOD("get_max_polyphony"), &AudioStreamPlayer2D::get_max_polyphony);
 
+	ClassDB::bind_method(D_METHOD("set_voice_priority", "voice_priority"), &AudioStreamPlayer2D::set_voice_priority);
+	ClassDB::bind_method(D_METHOD("get_voice_priority"), &AudioStreamPlayer2D::get_voice_priority);
+
 	ClassDB::bind_method(D_METHOD("set_panning_strength", "panning_strength"), &AudioStreamPlayer2D::set_panning_strength);
 	ClassDB::bind_method(D_METHOD("get_panning_strength"), &AudioStreamPlayer2D::get_panning_strength);
 
@@ -436,6 +447,7 @@ void AudioStreamPlayer2D::_bind_methods() {
 	ADD_PROPERTY(PropertyInfo(Variant::FLOAT, "max_distance", PROPERTY_HINT_RANGE, "1,4096,1,or_greater,exp,suffix:px"), "set_max_distance", "get_max_distance");
 	ADD_PROPERTY(PropertyInfo(Variant::FLOAT, "attenuation", PROPERTY_HINT_EXP_EASING, "attenuation"), "set_attenuation", "get_attenuation");
 	ADD_PROPERTY(PropertyInfo(Variant::INT, "max_polyphony", PROPERTY_HINT_NONE, ""), "set_max_polyphony", "get_max_polyphony");
+	ADD_PROPERTY(PropertyInfo(Variant::INT, "voice_priority", PROPERTY_HINT_RANGE, "-128,128,1,or_less,or_greater"), "set_voice_priority", "get_voice_priority");
 	ADD_PROPERTY(PropertyInfo(Variant::FLOAT, "panning_strength", PROPERTY_HINT_RANGE, "0,3,0.01,or_greater"), "set_panning_strength", "get_panning_strength");
 	ADD_PROPERTY(PropertyInfo(Variant::STRING_NAME, "bus", PROPERTY_HINT_ENUM, ""), "set_bus", "get_bus");
 	ADD_PROPERTY(PropertyInfo(Variant::INT, "area_mask", PROPERTY_HINT_LAYERS_2D_PHYSICS), "set_area_mask", "get_area_mask");
@@ -166,6 +166,9 @@ public:
 	void set_max_polyphony(int p_max_polyphony);
 	int get_max_polyphony() const;
 
+	void set_voice_priority(int p_voice_priority);
+	int get_voice_priority() const;
+
 	void set_autoplay(bool p_enable);
 	bool is_autoplay_enabled() const;
 
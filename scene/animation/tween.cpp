@@ -386,7 +386,8 @@ bool Tween::step(double p_delta) {
 		rem_delta = step_delta;
 
 		if (!step_active) {
-			emit_signal(SNAME("step_finished"), current_step);
+			static const SignalHandle step_finished_signal(get_class_static(), "step_finished");
+			emit_signal(step_finished_signal, current_step);
 			current_step++;
 
 			if (current_step == tweeners.size()) {
@@ -397,7 +398,8 @@ bool Tween::step(double p_delta) {
 					emit_signal(SceneStringName(finished));
 					break;
 				} else {
-					emit_signal(SNAME("loop_finished"), loops_done);
+					static const SignalHandle loop_finished_signal(get_class_static(), "loop_finished");
+					emit_signal(loop_finished_signal, loops_done);
 					current_step = 0;
 					_start_tweeners();
 #ifdef DEBUG_ENABLED
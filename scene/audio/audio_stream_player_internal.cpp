@@ -321,6 +321,14 @@ void AudioStreamPlayerInternal::set_max_polyphony(int p_max_polyphony) {
 	}
 }
 
+void AudioStreamPlayerInternal::set_voice_priority(int p_voice_priority) {
+	voice_priority = p_voice_priority;
+
+	for (Ref<AudioStreamPlayback> &playback : stream_playbacks) {
+		AudioServer::get_singleton()->set_playback_priority(playback, voice_priority);
+	}
+}
+
 bool AudioStreamPlayerInternal::has_stream_playback() {
 	return !stream_playbacks.is_empty();
 }
@@ -1833,7 +1833,8 @@ real_t Control::get_stretch_ratio() const {
 
 void Control::_call_gui_input(const Ref<InputEvent> &p_event) {
 	if (p_event->get_device() != InputEvent::DEVICE_ID_INTERNAL) {
-		emit_signal(SceneStringName(gui_input), p_event); // Signal should be first, so it's possible to override an event (and then accept it).
+		static const SignalHandle gui_input_signal(get_class_static(), "gui_input");
+		emit_signal(gui_input_signal, p_event); // Signal should be first, so it's possible to override an event (and then accept it).
 	}
 	if (!is_inside_tree() || get_viewport()->is_input_handled()) {
 		return; // Input was handled, abort.
@@ -3741,11 +3742,13 @@ void Control::_notification(int p_notification) {
 		} break;
 
 		case NOTIFICATION_MOUSE_ENTER: {
-			emit_signal(SceneStringName(mouse_entered));
+			static const SignalHandle mouse_entered_signal(get_class_static(), "mouse_entered");
+			emit_signal(mouse_entered_signal);
 		} break;
 
 		case NOTIFICATION_MOUSE_EXIT: {
-			emit_signal(SceneStringName(mouse_exited));
+			static const SignalHandle mouse_exited_signal(get_class_static(), "mouse_exited");
+			emit_signal(mouse_exited_signal);
 		} break;
 
 		case NOTIFICATION_FOCUS_ENTER: {
@@ -426,7 +426,7 @@ float RichTextLabel::_resize_line(ItemFrame *p_frame, int p_line, const Ref<Font
 	return _calculate_line_vertical_offset(l);
 }
 
-float RichTextLabel::_shape_line(ItemFrame *p_frame, int p_line, const Ref<Font> &p_base_font, int p_base_font_size, int p_width, float p_h, int *r_char_offset) {
+float RichTextLabel::_shape_line(ItemFrame *p_frame, int p_line, const Ref<Font> &p_base_font, int p_base_font_size, int p_width, float p_h, int *r_char_offset, bool p_deferred) {
 	ERR_FAIL_NULL_V(p_frame, p_h);
 	ERR_FAIL_COND_V(p_line < 0 || p_line >= (int)p_frame->lines.size(), p_h);
 
@@ -450,14 +450,6 @@ float RichTextLabel::_shape_line(ItemFrame *p_frame, int p_line, const Ref<Font>
 	}
 	autowrap_flags = autowrap_flags | autowrap_flags_trim;
 
-	// Clear cache.
-	l.dc_item = nullptr;
-	l.text_buf->clear();
-	l.text_buf->set_break_flags(autowrap_flags);
-	l.text_buf->set_justification_flags(_find_jst_flags(l.from));
-	l.char_offset = *r_char_offset;
-	l.char_count = 0;
-
 	// List prefix.
 	Vector<int> list_index;
 	Vector<int> list_count;
@@ -506,6 +498,24 @@ float RichTextLabel::_shape_line(ItemFrame *p_frame, int p_line, const Ref<Font>
 	// Add indent.
 	l.indent = _find_margin(l.from, p_base_font, p_base_font_size) + l.prefix_width;
 	l.offset.x = l.indent;
+
+	// Reuse existing shaping if none of its inputs changed, only update position and width.
+	uint64_t shaping_key = p_frame->cell ? 0 : _get_line_shaping_key(p_frame, p_line, p_base_font, p_base_font_size, p_width, *r_char_offset, autowrap_flags);
+	if (shaping_key != 0 && shaping_key == l.shaping_key) {
+		l.char_offset = *r_char_offset;
+		*r_char_offset = l.char_offset + l.char_count;
+		return _resize_line(p_frame, p_line, p_base_font, p_base_font_size, p_width, p_h);
+	}
+
+	// Clear cache.
+	l.dc_item = nullptr;
+	l.text_buf->clear();
+	l.text_buf->set_break_flags(autowrap_flags);
+	l.text_buf->set_justification_flags(_find_jst_flags(l.from));
+	l.char_offset = *r_char_offset;
+	l.char_count = 0;
+	l.shaping_key = shaping_key;
+
 	l.text_buf->set_width(p_width - l.offset.x);
 	l.text_buf->set_alignment(_find_alignment(l.from));
 	l.text_buf->set_direction(_find_direction(l.from));
@@ -657,9 +667,99 @@ float RichTextLabel::_shape_line(ItemFrame *p_frame, int p_line, const Ref<Font>
 	*r_char_offset = l.char_offset + l.char_count;
 
 	l.offset.y = p_h;
+	if (p_deferred) {
+		return p_h;
+	}
 	return _calculate_line_vertical_offset(l);
 }
 
+uint64_t RichTextLabel::_get_line_shaping_key(ItemFrame *p_frame, int p_line, const Ref<Font> &p_base_font, int p_base_font_size, int p_width, int p_char_offset, BitField<TextServer::LineBreakFlag> p_break_flags) {
+	const Line &l = p_frame->lines[p_line];
+
+	uint64_t key = hash64_murmur3_64(p_width - (int)l.indent, HASH_MURMUR3_SEED);
+	key = hash64_murmur3_64(p_break_flags, key);
+	key = hash64_murmur3_64(_find_jst_flags(l.from), key);
+	key = hash64_murmur3_64(_find_alignment(l.from), key);
+	key = hash64_murmur3_64(_find_direction(l.from), key);
+	key = hash64_murmur3_64(_find_stt(l.from), key);
+	key = hash64_murmur3_64(st_args.hash(), key);
+
+	PackedFloat32Array tab_stops = _find_tab_stops(l.from);
+	if (!tab_stops.is_empty()) {
+		for (float tab_stop : tab_stops) {
+			key = hash64_murmur3_64(hash_murmur3_one_float(tab_stop), key);
+		}
+	} else if (tab_size > 0) {
+		key = hash64_murmur3_64(tab_size, key);
+		key = hash64_murmur3_64(p_base_font->get_instance_id(), key);
+		key = hash64_murmur3_64(p_base_font_size, key);
+	}
+
+	// Walk paragraph items the same way "_shape_line" does, including visible characters trimming.
+	Item *it_to = (p_line + 1 < (int)p_frame->lines.size()) ? p_frame->lines[p_line + 1].from : nullptr;
+	int remaining_characters = visible_characters - p_char_offset;
+	for (Item *it = l.from; it && it != it_to; it = _get_next_item(it)) {
+		if (visible_chars_behavior == TextServer::VC_CHARS_BEFORE_SHAPING && visible_characters >= 0 && remaining_characters <= 0) {
+			break;
+		}
+		switch (it->type) {
+			case ITEM_DROPCAP:
+			case ITEM_NEWLINE:
+			case ITEM_TEXT: {
+				Ref<Font> font = p_base_font;
+				int font_size = p_base_font_size;
+
+				ItemFont *font_it = _find_font(it);
+				if (font_it) {
+					if (font_it->font.is_valid()) {
+						font = font_it->font;
+					}
+					if (font_it->font_size > 0) {
+						font_size = font_it->font_size;
+					}
+				}
+				ItemFontSize *font_size_it = _find_font_size(it);
+				if (font_size_it && font_size_it->font_size > 0) {
+					font_size = font_size_it->font_size;
+				}
+				key = hash64_murmur3_64(it->rid.get_id(), key);
+				key = hash64_murmur3_64(font.is_valid() ? (uint64_t)font->get_instance_id() : 0, key);
+				key = hash64_murmur3_64(font_size, key);
+				if (it->type == ITEM_NEWLINE) {
+					remaining_characters--;
+				} else if (it->type == ITEM_TEXT) {
+					String tx = static_cast<ItemText *>(it)->text;
+					if (visible_chars_behavior == TextServer::VC_CHARS_BEFORE_SHAPING && visible_characters >= 0 && remaining_characters >= 0) {
+						tx = tx.substr(0, remaining_characters);
+					}
+					remaining_characters -= tx.length();
+					key = hash64_murmur3_64(tx.hash64(), key);
+					key = hash64_murmur3_64(_find_language(it).hash64(), key);
+				}
+			} break;
+			case ITEM_IMAGE: {
+				ItemImage *img = static_cast<ItemImage *>(it);
+				Size2 img_size = img->size;
+				if (img->size_in_percent) {
+					img_size = _get_image_size(img->image, p_width * img->rq_size.width / 100.f, p_width * img->rq_size.height / 100.f, img->region);
+				}
+				key = hash64_murmur3_64(it->rid.get_id(), key);
+				key = hash64_murmur3_64(hash_murmur3_one_real(img_size.width, hash_murmur3_one_real(img_size.height)), key);
+				key = hash64_murmur3_64(img->inline_align, key);
+				remaining_characters--;
+			} break;
+			case ITEM_TABLE: {
+				// Tables shape and lay out their cells as a side effect, always reshape.
+				return 0;
+			}
+			default:
+				break;
+		}
+	}
+
+	return key;
+}
+
 void RichTextLabel::_set_table_size(ItemTable *p_table, int p_available_width) {
 	int col_count = p_table->columns.size();
 
@@ -3554,6 +3654,22 @@ bool RichTextLabel::is_threaded() const {
 	return threaded;
 }
 
+void RichTextLabel::set_max_paragraphs(int p_max_paragraphs) {
+	// The paragraph being written is always kept, so any limit is at least 1.
+	p_max_paragraphs = p_max_paragraphs < 0 ? -1 : MAX(p_max_paragraphs, 1);
+	if (max_paragraphs != p_max_paragraphs) {
+		_stop_thread();
+		MutexLock data_lock(data_mutex);
+
+		max_paragraphs = p_max_paragraphs;
+		_trim_paragraphs();
+	}
+}
+
+int RichTextLabel::get_max_paragraphs() const {
+	return max_paragraphs;
+}
+
 void RichTextLabel::set_progress_bar_delay(int p_delay_ms) {
 	progress_delay = p_delay_ms;
 }
@@ -3724,19 +3840,60 @@ void RichTextLabel::_process_line_caches() {
 	}
 
 	total_height = (fi == 0) ? 0 : _calculate_line_vertical_offset(main->lines[fi - 1]);
-	for (int i = fi; i < (int)main->lines.size(); i++) {
-		total_height = _shape_line(main, i, theme_cache.normal_font, theme_cache.normal_font_size, text_rect.get_size().width - scroll_w, total_height, &total_chars);
-		total_height = _update_scroll_exceeds(total_height, ctrl_height, text_rect.get_size().width, i, old_scroll, text_rect.size.height);
+	for (int from = fi; from < (int)main->lines.size(); from += SHAPE_BATCH_SIZE) {
+		int to = MIN(from + SHAPE_BATCH_SIZE, (int)main->lines.size());
 
-		main->first_invalid_line.store(i);
-		main->first_resized_line.store(i);
-		main->first_invalid_font_line.store(i);
+		// Fill paragraphs in order, character offsets and list prefixes depend on the previous ones.
+		int shape_width = text_rect.get_size().width - scroll_w;
+		for (int i = from; i < to; i++) {
+			_shape_line(main, i, theme_cache.normal_font, theme_cache.normal_font_size, shape_width, total_height, &total_chars, true);
 
-		if (stop_thread.load()) {
-			updating.store(false);
-			return;
+			if (stop_thread.load()) {
+				updating.store(false);
+				return;
+			}
+		}
+
+		// Shape and break filled paragraphs in slices, each slice is independent.
+		// HarfBuzz shaping and substring creation still run one paragraph at a time, since the text server
+		// holds its class lock for them. Slices only overlap line breaking and paragraph bookkeeping.
+		int slices = CLAMP((to - from) / SHAPE_SLICE_MIN_SIZE, 1, WorkerThreadPool::get_singleton()->get_thread_count());
+		if (slices > 1) {
+			LocalVector<WorkerThreadPool::TaskID> slice_tasks;
+			for (int j = 1; j < slices; j++) {
+				Vector2i range = Vector2i(from + (to - from) * j / slices, from + (to - from) * (j + 1) / slices);
+				slice_tasks.push_back(WorkerThreadPool::get_singleton()->add_template_task(this, &RichTextLabel::_shape_lines_task, range, true, vformat("RichTextLabelShapeLines:%x", (int64_t)get_instance_id())));
+			}
+			_shape_lines_task(Vector2i(from, from + (to - from) / slices));
+			for (WorkerThreadPool::TaskID slice_task : slice_tasks) {
+				// Waiting is collaborative, so this does not block a pool thread when called from the loading task.
+				WorkerThreadPool::get_singleton()->wait_for_task_completion(slice_task);
+			}
+		}
+
+		// Commit results in order.
+		for (int i = from; i < to; i++) {
+			int width = text_rect.get_size().width - scroll_w;
+			if (width != shape_width) {
+				// Scrollbar visibility changed after the paragraph was filled.
+				total_height = _resize_line(main, i, theme_cache.normal_font, theme_cache.normal_font_size, width, total_height);
+			} else {
+				MutexLock lock(main->lines[i].text_buf->get_mutex());
+				main->lines[i].offset.y = total_height;
+				total_height = _calculate_line_vertical_offset(main->lines[i]);
+			}
+			total_height = _update_scroll_exceeds(total_height, ctrl_height, text_rect.get_size().width, i, old_scroll, text_rect.size.height);
+
+			main->first_invalid_line.store(i);
+			main->first_resized_line.store(i);
+			main->first_invalid_font_line.store(i);
+
+			if (stop_thread.load()) {
+				updating.store(false);
+				return;
+			}
+			loaded.store(double(i) / double(main->lines.size()));
 		}
-		loaded.store(double(i) / double(main->lines.size()));
 	}
 
 	main->first_invalid_line.store(main->lines.size());
@@ -3750,6 +3907,16 @@ void RichTextLabel::_process_line_caches() {
 	emit_signal(SceneStringName(finished));
 }
 
+void RichTextLabel::_shape_lines_task(Vector2i p_range) {
+	for (int i = p_range.x; i < p_range.y; i++) {
+		if (stop_thread.load()) {
+			return;
+		}
+		// Shaping and line breaking are done lazily on the first size request.
+		main->lines[i].text_buf->get_size();
+	}
+}
+
 void RichTextLabel::_invalidate_current_line(ItemFrame *p_frame) {
 	if ((int)p_frame->lines.size() - 1 <= p_frame->first_invalid_line) {
 		p_frame->first_invalid_line = (int)p_frame->lines.size() - 1;
@@ -3829,6 +3996,9 @@ void RichTextLabel::add_text(const String &p_text) {
 
 		pos = end + 1;
 	}
+	if (!parsing_bbcode.load()) {
+		_trim_paragraphs();
+	}
 	queue_redraw();
 }
 
@@ -4072,6 +4242,9 @@ void RichTextLabel::add_newline() {
 	_add_item(item, false);
 	current_frame->lines.resize(current_frame->lines.size() + 1);
 	_invalidate_current_line(current_frame);
+	if (!parsing_bbcode.load()) {
+		_trim_paragraphs();
+	}
 	queue_redraw();
 }
 
@@ -4124,9 +4297,16 @@ bool RichTextLabel::remove_paragraph(int p_paragraph, bool p_no_invalidate) {
 		return false;
 	}
 
+	_remove_paragraphs(p_paragraph, 1, p_no_invalidate);
+	queue_redraw();
+
+	return true;
+}
+
+void RichTextLabel::_remove_paragraphs(int p_from, int p_count, bool p_no_invalidate) {
 	stack_externally_modified = true;
 
-	if (main->lines.size() == 1) {
+	if ((int)main->lines.size() == p_count) {
 		// Clear all.
 		main->_clear_children();
 		current = main;
@@ -4137,13 +4317,15 @@ bool RichTextLabel::remove_paragraph(int p_paragraph, bool p_no_invalidate) {
 		current_char_ofs = 0;
 	} else {
 		HashSet<Item *> erase_list;
-		Line &l = main->lines[p_paragraph];
-		int off = l.char_count;
-		for (int i = p_paragraph; i < (int)main->lines.size(); i++) {
-			if (i == p_paragraph) {
+		int off = 0;
+		for (int i = p_from; i < p_from + p_count; i++) {
+			off += main->lines[i].char_count;
+		}
+		for (int i = p_from; i < (int)main->lines.size(); i++) {
+			if (i < p_from + p_count) {
 				_remove_frame(erase_list, main, i, true, off, 0);
 			} else {
-				_remove_frame(erase_list, main, i, false, off, 1);
+				_remove_frame(erase_list, main, i, false, off, p_count);
 			}
 		}
 		for (HashSet<Item *>::Iterator E = erase_list.begin(); E; ++E) {
@@ -4161,7 +4343,14 @@ bool RichTextLabel::remove_paragraph(int p_paragraph, bool p_no_invalidate) {
 			it->subitems.clear();
 			memdelete(it);
 		}
-		main->lines.remove_at(p_paragraph);
+		if (p_count == 1) {
+			main->lines.remove_at(p_from);
+		} else {
+			for (int i = p_from; i + p_count < (int)main->lines.size(); i++) {
+				main->lines[i] = main->lines[i + p_count];
+			}
+			main->lines.resize(main->lines.size() - p_count);
+		}
 		current_char_ofs -= off;
 	}
 
@@ -4185,10 +4374,10 @@ bool RichTextLabel::remove_paragraph(int p_paragraph, bool p_no_invalidate) {
 	}
 
 	if (p_no_invalidate) {
-		// Do not invalidate cache, only update vertical offsets of the paragraphs after deleted one and scrollbar.
-		int to_line = main->first_invalid_line.load() - 1;
-		float total_height = (p_paragraph == 0) ? 0 : _calculate_line_vertical_offset(main->lines[p_paragraph - 1]);
-		for (int i = p_paragraph; i < to_line; i++) {
+		// Do not invalidate cache, only update vertical offsets of the paragraphs after deleted ones and scrollbar.
+		int to_line = main->first_invalid_line.load() - p_count;
+		float total_height = (p_from == 0) ? 0 : _calculate_line_vertical_offset(main->lines[p_from - 1]);
+		for (int i = p_from; i < to_line; i++) {
 			MutexLock lock(main->lines[to_line - 1].text_buf->get_mutex());
 			main->lines[i].offset.y = total_height;
 			total_height = _calculate_line_vertical_offset(main->lines[i]);
@@ -4197,18 +4386,46 @@ bool RichTextLabel::remove_paragraph(int p_paragraph, bool p_no_invalidate) {
 		vscroll->set_max(total_height);
 		updating_scroll = false;
 
-		main->first_invalid_line.store(MAX(main->first_invalid_line.load() - 1, 0));
-		main->first_resized_line.store(MAX(main->first_resized_line.load() - 1, 0));
-		main->first_invalid_font_line.store(MAX(main->first_invalid_font_line.load() - 1, 0));
+		main->first_invalid_line.store(MAX(main->first_invalid_line.load() - p_count, 0));
+		main->first_resized_line.store(MAX(main->first_resized_line.load() - p_count, 0));
+		main->first_invalid_font_line.store(MAX(main->first_invalid_font_line.load() - p_count, 0));
 	} else {
-		// Invalidate cache after the deleted paragraph.
-		main->first_invalid_line.store(MIN(main->first_invalid_line.load(), p_paragraph));
-		main->first_resized_line.store(MIN(main->first_resized_line.load(), p_paragraph));
-		main->first_invalid_font_line.store(MIN(main->first_invalid_font_line.load(), p_paragraph));
+		// Invalidate cache after the deleted paragraphs.
+		main->first_invalid_line.store(MIN(main->first_invalid_line.load(), p_from));
+		main->first_resized_line.store(MIN(main->first_resized_line.load(), p_from));
+		main->first_invalid_font_line.store(MIN(main->first_invalid_font_line.load(), p_from));
 	}
-	queue_redraw();
+}
 
-	return true;
+void RichTextLabel::_trim_paragraphs() {
+	if (max_paragraphs < 0 || (int)main->lines.size() <= max_paragraphs) {
+		return;
+	}
+
+	// Never evict paragraphs that hold a tag which is still open, new content is added inside it.
+	int count = (int)main->lines.size() - max_paragraphs;
+	bool in_main = (current_frame == main);
+	for (Item *it = current; it && it != main; it = it->parent) {
+		if (it->type == ITEM_FRAME) {
+			in_main = (static_cast<ItemFrame *>(it)->parent_frame == main);
+		} else if (in_main) {
+			count = MIN(count, it->line);
+		}
+	}
+	if (count <= 0) {
+		return;
+	}
+
+	// Evict all oldest paragraphs in a single pass, the layout of the remaining ones is kept unless a tag spans across the removed range.
+	bool self_contained = true;
+	for (Item *it = main->lines[count].from; it && it != main; it = it->parent) {
+		if (it->parent != main && it->parent->line < count) {
+			self_contained = false;
+			break;
+		}
+	}
+	_remove_paragraphs(0, count, self_contained);
+	queue_redraw();
 }
 
 bool RichTextLabel::invalidate_paragraph(int p_paragraph) {
@@ -6172,6 +6389,7 @@ void RichTextLabel::append_text(const String &p_bbcode) {
 	}
 
 	parsing_bbcode.store(false);
+	_trim_paragraphs();
 }
 
 void RichTextLabel::scroll_to_selection() {
@@ -7010,6 +7228,7 @@ void RichTextLabel::set_visible_ratio(float p_ratio) {
 	if (visible_ratio != p_ratio) {
 		_stop_thread();
 
+		int prev_visible = visible_characters;
 		if (p_ratio >= 1.0) {
 			visible_characters = -1;
 			visible_ratio = 1.0;
@@ -7022,7 +7241,7 @@ void RichTextLabel::set_visible_ratio(float p_ratio) {
 		}
 
 		if (visible_chars_behavior == TextServer::VC_CHARS_BEFORE_SHAPING) {
-			main->first_invalid_line.store(0); //  Invalidate all lines..
+			_invalidate_visible_characters(prev_visible);
 			_invalidate_accessibility();
 			_validate_line_caches();
 		}
@@ -7266,6 +7485,9 @@ void RichTextLabel::_bind_methods() {
 	ClassDB::bind_method(D_METHOD("set_threaded", "threaded"), &RichTextLabel::set_threaded);
 	ClassDB::bind_method(D_METHOD("is_threaded"), &RichTextLabel::is_threaded);
 
+	ClassDB::bind_method(D_METHOD("set_max_paragraphs", "max_paragraphs"), &RichTextLabel::set_max_paragraphs);
+	ClassDB::bind_method(D_METHOD("get_max_paragraphs"), &RichTextLabel::get_max_paragraphs);
+
 	ClassDB::bind_method(D_METHOD("set_progress_bar_delay", "delay_ms"), &RichTextLabel::set_progress_bar_delay);
 	ClassDB::bind_method(D_METHOD("get_progress_bar_delay"), &RichTextLabel::get_progress_bar_delay);
 
@@ -7319,6 +7541,7 @@ void RichTextLabel::_bind_methods() {
 	ADD_PROPERTY(PropertyInfo(Variant::BOOL, "fit_content"), "set_fit_content", "is_fit_content_enabled");
 	ADD_PROPERTY(PropertyInfo(Variant::BOOL, "scroll_active"), "set_scroll_active", "is_scroll_active");
 	ADD_PROPERTY(PropertyInfo(Variant::BOOL, "scroll_following"), "set_scroll_follow", "is_scroll_following");
+	ADD_PROPERTY(PropertyInfo(Variant::INT, "max_paragraphs", PROPERTY_HINT_RANGE, "-1,10000,1,or_greater"), "set_max_paragraphs", "get_max_paragraphs");
 	ADD_PROPERTY(PropertyInfo(Variant::INT, "autowrap_mode", PROPERTY_HINT_ENUM, "Off,Arbitrary,Word,Word (Smart)"), "set_autowrap_mode", "get_autowrap_mode");
 	ADD_PROPERTY(PropertyInfo(Variant::INT, "autowrap_trim_flags", PROPERTY_HINT_FLAGS, vformat("Trim Spaces After Break:%d,Trim Spaces Before Break:%d", TextServer::BREAK_TRIM_START_EDGE_SPACES, TextServer::BREAK_TRIM_END_EDGE_SPACES)), "set_autowrap_trim_flags", "get_autowrap_trim_flags");
 	ADD_PROPERTY(PropertyInfo(Variant::INT, "tab_size", PROPERTY_HINT_RANGE, "0,24,1"), "set_tab_size", "get_tab_size");
@@ -7443,6 +7666,7 @@ void RichTextLabel::set_visible_characters(int p_visible) {
 	if (visible_characters != p_visible) {
 		_stop_thread();
 
+		int prev_visible = visible_characters;
 		visible_characters = p_visible;
 		if (p_visible == -1) {
 			visible_ratio = 1;
@@ -7453,7 +7677,7 @@ void RichTextLabel::set_visible_characters(int p_visible) {
 			}
 		}
 		if (visible_chars_behavior == TextServer::VC_CHARS_BEFORE_SHAPING) {
-			main->first_invalid_line.store(0); // Invalidate all lines.
+			_invalidate_visible_characters(prev_visible);
 			_invalidate_accessibility();
 			_validate_line_caches();
 		}
@@ -7461,6 +7685,27 @@ void RichTextLabel::set_visible_characters(int p_visible) {
 	}
 }
 
+void RichTextLabel::_invalidate_visible_characters(int p_prev_visible) {
+	// Lines fully visible both before and after the change keep their shaping, later lines are revalidated (mostly from the shaping key cache).
+	int from_char = (p_prev_visible < 0) ? visible_characters : ((visible_characters < 0) ? p_prev_visible : MIN(p_prev_visible, visible_characters));
+	if (from_char < 0) {
+		main->first_invalid_line.store(0); // Invalidate all lines.
+		return;
+	}
+
+	int l = 0;
+	int r = main->first_invalid_line.load();
+	while (l < r) {
+		int m = Math::floor(double(l + r) / 2.0);
+		if (main->lines[m].char_offset + main->lines[m].char_count < from_char) {
+			l = m + 1;
+		} else {
+			r = m;
+		}
+	}
+	main->first_invalid_line.store(l);
+}
+
 int RichTextLabel::get_visible_characters() const {
 	return visible_characters;
 }
@@ -41,6 +41,7 @@ class RichTextEffect;
 
 class RichTextLabel : public Control {
 	GDCLASS(RichTextLabel, Control);
+	friend class TestRichTextLabelInternalsAccessor;
 
 	enum RTLDrawStep {
 		DRAW_STEP_BACKGROUND,
@@ -168,6 +169,8 @@ private:
 		int char_offset = 0;
 		int char_count = 0;
 
+		uint64_t shaping_key = 0; // Hash of the inputs "text_buf" was shaped from, 0 if it can't be reused.
+
 		Line() {
 			text_buf.instantiate();
 		}
@@ -497,6 +500,9 @@ private:
 	Item *current = nullptr;
 	ItemFrame *current_frame = nullptr;
 
+	static const int SHAPE_BATCH_SIZE = 256; // Paragraphs filled before shaping them in parallel.
+	static const int SHAPE_SLICE_MIN_SIZE = 16; // Minimum number of paragraphs shaped by a single task.
+
 	WorkerThreadPool::TaskID task = WorkerThreadPool::INVALID_TASK_ID;
 	Mutex data_mutex;
 	bool threaded = false;
@@ -525,6 +531,7 @@ private:
 	int current_char_ofs = 0;
 	int visible_paragraph_count = 0;
 	int visible_line_count = 0;
+	int max_paragraphs = -1;
 
 	int tab_size = 4;
 	bool underline_meta = true;
@@ -545,8 +552,10 @@ private:
 
 	void _invalidate_accessibility();
 	void _invalidate_current_line(ItemFrame *p_frame);
+	void _invalidate_visible_characters(int p_prev_visible);
 
 	void _thread_function(void *p_userdata);
+	void _shape_lines_task(Vector2i p_range);
 	void _thread_end();
 	void _stop_thread();
 	bool _validate_line_caches();
@@ -555,6 +564,8 @@ private:
 
 	void _add_item(Item *p_item, bool p_enter = false, bool p_ensure_newline = false);
 	void _remove_frame(HashSet<Item *> &r_erase_list, ItemFrame *p_frame, int p_line, bool p_erase, int p_char_offset, int p_line_offset);
+	void _remove_paragraphs(int p_from, int p_count, bool p_no_invalidate);
+	void _trim_paragraphs();
 
 	void _texture_changed(RID p_item);
 
@@ -618,8 +629,9 @@ private:
 	bool _search_line(ItemFrame *p_frame, int p_line, const String &p_string, int p_char_idx, bool p_reverse_search);
 	bool _search_table(ItemTable *p_table, List<Item *>::Element *p_from, const String &p_string, bool p_reverse_search);
 
-	float _shape_line(ItemFrame *p_frame, int p_line, const Ref<Font> &p_base_font, int p_base_font_size, int p_width, float p_h, int *r_char_offset);
+	float _shape_line(ItemFrame *p_frame, int p_line, const Ref<Font> &p_base_font, int p_base_font_size, int p_width, float p_h, int *r_char_offset, bool p_deferred = false);
 	float _resize_line(ItemFrame *p_frame, int p_line, const Ref<Font> &p_base_font, int p_base_font_size, int p_width, float p_h);
+	uint64_t _get_line_shaping_key(ItemFrame *p_frame, int p_line, const Ref<Font> &p_base_font, int p_base_font_size, int p_width, int p_char_offset, BitField<TextServer::LineBreakFlag> p_break_flags);
 
 	void _set_table_size(ItemTable *p_table, int p_available_width);
 
@@ -888,6 +900,9 @@ public:
 	void set_threaded(bool p_threaded);
 	bool is_threaded() const;
 
+	void set_max_paragraphs(int p_max_paragraphs);
+	int get_max_paragraphs() const;
+
 	void set_progress_bar_delay(int p_delay_ms);
 	int get_progress_bar_delay() const;
 
@@ -4285,6 +4285,11 @@ Error Node::emit_signalp(const StringName &p_name, const Variant **p_args, int p
 	return Object::emit_signalp(p_name, p_args, p_argcount);
 }
 
+Error Node::emit_signalp(const SignalHandle &p_signal, const Variant **p_args, int p_argcount) {
+	ERR_THREAD_GUARD_V(ERR_INVALID_PARAMETER);
+	return Object::emit_signalp(p_signal, p_args, p_argcount);
+}
+
 bool Node::has_signal(const StringName &p_name) const {
 	ERR_THREAD_GUARD_V(false);
 	return Object::has_signal(p_name);
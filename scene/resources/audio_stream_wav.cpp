@@ -90,6 +90,24 @@ void AudioStreamPlaybackWAV::seek(double p_time) {
 	offset = int64_t(p_time * base->mix_rate);
 }
 
+double AudioStreamPlaybackWAV::get_position_after(double p_from_pos, double p_time) const {
+	if (base->format == AudioStreamWAV::FORMAT_IMA_ADPCM || (base->loop_mode != AudioStreamWAV::LOOP_DISABLED && (base->loop_mode != AudioStreamWAV::LOOP_FORWARD || base->loop_end <= base->loop_begin))) {
+		// Can't seek, or doesn't simply loop forward.
+		return Math::NaN;
+	}
+
+	double position = p_from_pos + p_time;
+	if (base->loop_mode == AudioStreamWAV::LOOP_FORWARD) {
+		double loop_begin = double(base->loop_begin) / base->mix_rate;
+		double loop_end = double(base->loop_end) / base->mix_rate;
+		if (position >= loop_end) {
+			position = loop_begin + Math::fmod(position - loop_begin, loop_end - loop_begin);
+		}
+		return position;
+	}
+	return position < base->get_length() ? position : -1.0;
+}
+
 template <typename Depth, bool is_stereo, bool is_ima_adpcm, bool is_qoa>
 void AudioStreamPlaybackWAV::decode_samples(const Depth *p_src, AudioFrame *p_dst, int64_t &p_offset, int8_t &p_increment, uint32_t p_amount, IMA_ADPCM_State *p_ima_adpcm, QOA_State *p_qoa) {
 	// this function will be compiled branchless by any decent compiler
@@ -326,18 +326,21 @@ Ref<Image> CompressedTexture2D::load_image_from_file(Ref<FileAccess> f, int p_si
 				continue;
 			}
 
+			// Decode straight from the file data when it is memory-mapped.
 			Vector<uint8_t> pv;
-			pv.resize(size);
-			{
+			const uint8_t *src = f->get_buffer_view(size);
+			if (!src) {
+				pv.resize(size);
 				uint8_t *wr = pv.ptrw();
 				f->get_buffer(wr, size);
+				src = pv.ptr();
 			}
 
 			Ref<Image> img;
-			if (data_format == DATA_FORMAT_PNG && Image::png_unpacker) {
-				img = Image::png_unpacker(pv);
-			} else if (data_format == DATA_FORMAT_WEBP && Image::webp_unpacker) {
-				img = Image::webp_unpacker(pv);
+			if (data_format == DATA_FORMAT_PNG && Image::_png_mem_unpacker_func) {
+				img = Image::_png_mem_unpacker_func(src, size);
+			} else if (data_format == DATA_FORMAT_WEBP && Image::_webp_mem_loader_func) {
+				img = Image::_webp_mem_loader_func(src, size);
 			}
 
 			if (img.is_null() || img->is_empty()) {
@@ -574,7 +574,45 @@ Font::~Font() {
 /*  FontFile                                                             */
 /*************************************************************************/
 
+void FontFile::_prerender_task(void *p_userdata) {
+	// Requests made while the task is running are picked up before it finishes.
+	while (true) {
+		PrerenderRequest request;
+		{
+			MutexLock lock(prerender_mutex);
+			if (prerender_queue.is_empty()) {
+				prerender_running = false;
+				return;
+			}
+			request = prerender_queue[0];
+			prerender_queue.remove_at(0);
+		}
+
+		PackedInt32Array glyphs;
+		for (char32_t c : request.chars) {
+			int32_t glyph = TS->font_get_glyph_index(request.rid, request.size.x, c, 0);
+			if (glyph != 0) {
+				glyphs.push_back(glyph);
+			}
+		}
+
+		// The text server rasterizes each batch in parallel, but holds the font lock while doing so.
+		// Batches are limited, so drawing is not stalled until all glyphs are rendered.
+		for (int i = 0; i < glyphs.size(); i += PRERENDER_BATCH_MAX) {
+			TS->font_render_glyphs(request.rid, request.size, glyphs.slice(i, i + PRERENDER_BATCH_MAX));
+		}
+	}
+}
+
+void FontFile::_wait_for_prerender() {
+	if (prerender_task != WorkerThreadPool::INVALID_TASK_ID) {
+		WorkerThreadPool::get_singleton()->wait_for_task_completion(prerender_task);
+		prerender_task = WorkerThreadPool::INVALID_TASK_ID;
+	}
+}
+
 _FORCE_INLINE_ void FontFile::_clear_cache() {
+	_wait_for_prerender();
 	for (int i = 0; i < cache.size(); i++) {
 		if (cache[i].is_valid()) {
 			TS->free_rid(cache[i]);
@@ -1027,6 +1065,12 @@ void FontFile::_bind_methods() {
 
 	ClassDB::bind_method(D_METHOD("render_range", "cache_index", "size", "start", "end"), &FontFile::render_range);
 	ClassDB::bind_method(D_METHOD("render_glyph", "cache_index", "size", "index"), &FontFile::render_glyph);
+	ClassDB::bind_method(D_METHOD("prerender_text", "cache_index", "size", "text"), &FontFile::prerender_text);
+	ClassDB::bind_method(D_METHOD("is_prerendering"), &FontFile::is_prerendering);
+
+	ClassDB::bind_method(D_METHOD("has_glyph_cache_data", "cache_index", "size"), &FontFile::has_glyph_cache_data);
+	ClassDB::bind_method(D_METHOD("get_glyph_cache_data", "cache_index", "size"), &FontFile::get_glyph_cache_data);
+	ClassDB::bind_method(D_METHOD("set_glyph_cache_data", "cache_index", "size", "data"), &FontFile::set_glyph_cache_data);
 
 	ClassDB::bind_method(D_METHOD("set_language_support_override", "language", "supported"), &FontFile::set_language_support_override);
 	ClassDB::bind_method(D_METHOD("get_language_support_override", "language"), &FontFile::get_language_support_override);
@@ -1224,6 +1268,9 @@ bool FontFile::_set(const StringName &p_name, const Variant &p_value) {
 					set_texture_offsets(cache_index, sz, texture_index, p_value);
 					return true;
 				}
+			} else if (tokens.size() == 5 && tokens[4] == "glyph_cache") {
+				set_glyph_cache_data(cache_index, sz, p_value);
+				return true;
 			} else if (tokens.size() == 7 && tokens[4] == "glyphs") {
 				int32_t glyph_index = tokens[5].to_int();
 				if (tokens[6] == "advance") {
@@ -1318,6 +1365,9 @@ bool FontFile::_get(const StringName &p_name, Variant &r_ret) const {
 					r_ret = get_texture_offsets(cache_index, sz, texture_index);
 					return true;
 				}
+			} else if (tokens.size() == 5 && tokens[4] == "glyph_cache") {
+				r_ret = get_glyph_cache_data(cache_index, sz);
+				return true;
 			} else if (tokens.size() == 7 && tokens[4] == "glyphs") {
 				int32_t glyph_index = tokens[5].to_int();
 				if (tokens[6] == "advance") {
@@ -1385,6 +1435,11 @@ void FontFile::_get_property_list(List<PropertyInfo> *p_list) const {
 				p_list->push_back(PropertyInfo(Variant::OBJECT, prefix_sz + "textures/" + itos(k) + "/image", PROPERTY_HINT_RESOURCE_TYPE, "Image", PROPERTY_USAGE_STORAGE));
 			}
 			PackedInt32Array glyphs = get_glyph_list(i, sz);
+			if (!glyphs.is_empty() && has_glyph_cache_data(i, sz)) {
+				// Store glyph metrics as a single compact block when supported by the text server.
+				p_list->push_back(PropertyInfo(Variant::PACKED_BYTE_ARRAY, prefix_sz + "glyph_cache", PROPERTY_HINT_NONE, "", PROPERTY_USAGE_STORAGE));
+				glyphs.clear();
+			}
 			for (int k = 0; k < glyphs.size(); k++) {
 				const int32_t &gl = glyphs[k];
 				if (sz.y == 0) {
@@ -2429,6 +2484,7 @@ void FontFile::clear_cache() {
 
 void FontFile::remove_cache(int p_cache_index) {
 	ERR_FAIL_INDEX(p_cache_index, cache.size());
+	_wait_for_prerender();
 	if (cache[p_cache_index].is_valid()) {
 		TS->free_rid(cache.write[p_cache_index]);
 	}
@@ -2751,6 +2807,64 @@ void FontFile::render_glyph(int p_cache_index, const Vector2i &p_size, int32_t p
 	TS->font_render_glyph(cache[p_cache_index], p_size, p_index);
 }
 
+void FontFile::prerender_text(int p_cache_index, const Vector2i &p_size, const String &p_text) {
+	ERR_FAIL_COND(p_cache_index < 0);
+	_ensure_rid(p_cache_index);
+
+	PrerenderRequest request;
+	request.rid = cache[p_cache_index];
+	request.size = p_size;
+	request.chars.reserve(p_text.length());
+	for (int i = 0; i < p_text.length(); i++) {
+		if (p_text[i] >= 0x20) {
+			request.chars.push_back(p_text[i]);
+		}
+	}
+	if (request.chars.is_empty()) {
+		return;
+	}
+	request.chars.sort();
+	uint32_t unique = 1;
+	for (uint32_t i = 1; i < request.chars.size(); i++) {
+		if (request.chars[i] != request.chars[unique - 1]) {
+			request.chars[unique++] = request.chars[i];
+		}
+	}
+	request.chars.resize(unique);
+
+	MutexLock lock(prerender_mutex);
+	prerender_queue.push_back(request);
+	if (prerender_running) {
+		return;
+	}
+	// The previous task has drained the queue already, so this doesn't block.
+	_wait_for_prerender();
+	prerender_running = true;
+	prerender_task = WorkerThreadPool::get_singleton()->add_template_task(this, &FontFile::_prerender_task, nullptr, false, SNAME("FontFilePrerender"));
+}
+
+bool FontFile::is_prerendering() const {
+	return prerender_task != WorkerThreadPool::INVALID_TASK_ID && !WorkerThreadPool::get_singleton()->is_task_completed(prerender_task);
+}
+
+bool FontFile::has_glyph_cache_data(int p_cache_index, const Vector2i &p_size) const {
+	ERR_FAIL_COND_V(p_cache_index < 0, false);
+	_ensure_rid(p_cache_index);
+	return TS->font_has_glyph_cache_data(cache[p_cache_index], p_size);
+}
+
+PackedByteArray FontFile::get_glyph_cache_data(int p_cache_index, const Vector2i &p_size) const {
+	ERR_FAIL_COND_V(p_cache_index < 0, PackedByteArray());
+	_ensure_rid(p_cache_index);
+	return TS->font_get_glyph_cache_data(cache[p_cache_index], p_size);
+}
+
+void FontFile::set_glyph_cache_data(int p_cache_index, const Vector2i &p_size, const PackedByteArray &p_data) {
+	ERR_FAIL_COND(p_cache_index < 0);
+	_ensure_rid(p_cache_index);
+	TS->font_set_glyph_cache_data(cache[p_cache_index], p_size, p_data);
+}
+
 void FontFile::set_language_support_override(const String &p_language, bool p_supported) {
 	_ensure_rid(0);
 	TS->font_set_language_support_override(cache[0], p_language, p_supported);
@@ -31,6 +31,7 @@
 #pragma once
 
 #include "core/io/resource.h"
+#include "core/object/worker_thread_pool.h"
 #include "core/templates/lru.h"
 #include "scene/resources/texture.h"
 #include "servers/text_server.h"
@@ -212,6 +213,23 @@ class FontFile : public Font {
 	// Cache.
 	mutable Vector<RID> cache;
 
+	// Background glyph pre-rendering.
+	static constexpr int PRERENDER_BATCH_MAX = 256;
+
+	struct PrerenderRequest {
+		RID rid;
+		Vector2i size;
+		LocalVector<char32_t> chars;
+	};
+
+	Mutex prerender_mutex;
+	LocalVector<PrerenderRequest> prerender_queue;
+	bool prerender_running = false;
+	WorkerThreadPool::TaskID prerender_task = WorkerThreadPool::INVALID_TASK_ID;
+
+	void _prerender_task(void *p_userdata);
+	void _wait_for_prerender();
+
 	_FORCE_INLINE_ void _clear_cache();
 	_FORCE_INLINE_ void _ensure_rid(int p_cache_index, int p_make_linked_from = -1) const;
 
@@ -379,6 +397,12 @@ public:
 
 	virtual void render_range(int p_cache_index, const Vector2i &p_size, char32_t p_start, char32_t p_end);
 	virtual void render_glyph(int p_cache_index, const Vector2i &p_size, int32_t p_index);
+	virtual void prerender_text(int p_cache_index, const Vector2i &p_size, const String &p_text);
+	virtual bool is_prerendering() const;
+
+	virtual bool has_glyph_cache_data(int p_cache_index, const Vector2i &p_size) const;
+	virtual PackedByteArray get_glyph_cache_data(int p_cache_index, const Vector2i &p_size) const;
+	virtual void set_glyph_cache_data(int p_cache_index, const Vector2i &p_size, const PackedByteArray &p_data);
 
 	// Language/script support override.
 	virtual void set_language_support_override(const String &p_language, bool p_supported);
@@ -1409,8 +1409,14 @@ Ref<Resource> ResourceFormatLoaderText::load(const String &p_path, const String
 	loader.local_path = ProjectSettings::get_singleton()->localize_path(path);
 	loader.progress = r_progress;
 	loader.res_path = loader.local_path;
-	loader.open(f);
-	err = loader.load();
+	{
+		ResourceLoader::LoadProfileScope profile_scope(loader.local_path, "read");
+		loader.open(f);
+	}
+	{
+		ResourceLoader::LoadProfileScope profile_scope(loader.local_path, "parse");
+		err = loader.load();
+	}
 	if (r_error) {
 		*r_error = err;
 	}
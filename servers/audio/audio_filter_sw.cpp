@@ -30,8 +30,17 @@
 
 #include "audio_filter_sw.h"
 
+#include "core/math/audio_frame.h"
 #include "core/math/math_funcs.h"
 
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define AUDIO_FILTER_SSE2
+#include <emmintrin.h>
+#elif defined(__aarch64__) || defined(_M_ARM64)
+#define AUDIO_FILTER_NEON
+#include <arm_neon.h>
+#endif
+
 void AudioFilterSW::set_mode(Mode p_mode) {
 	mode = p_mode;
 }
@@ -260,3 +269,131 @@ void AudioFilterSW::Processor::process(float *p_samples, int p_amount, int p_str
 		}
 	}
 }
+
+void AudioFilterSW::Processor::process_stereo(Processor *p_left, Processor *p_right, AudioFrame *p_frames, int p_amount, bool p_interpolate) {
+	if (!p_left->filter || !p_right->filter) {
+		return;
+	}
+
+	// Each sample depends on the previous ones, so instead of vectorizing over time,
+	// both channels are computed at once, in double precision like `process_one()`.
+	// History is rounded to float after every sample, to match the scalar path.
+#if defined(AUDIO_FILTER_SSE2)
+	__m128d b0 = _mm_setr_pd(p_left->coeffs.b0, p_right->coeffs.b0);
+	__m128d b1 = _mm_setr_pd(p_left->coeffs.b1, p_right->coeffs.b1);
+	__m128d b2 = _mm_setr_pd(p_left->coeffs.b2, p_right->coeffs.b2);
+	__m128d a1 = _mm_setr_pd(p_left->coeffs.a1, p_right->coeffs.a1);
+	__m128d a2 = _mm_setr_pd(p_left->coeffs.a2, p_right->coeffs.a2);
+	const __m128d incr_b0 = _mm_setr_pd(p_left->incr_coeffs.b0, p_right->incr_coeffs.b0);
+	const __m128d incr_b1 = _mm_setr_pd(p_left->incr_coeffs.b1, p_right->incr_coeffs.b1);
+	const __m128d incr_b2 = _mm_setr_pd(p_left->incr_coeffs.b2, p_right->incr_coeffs.b2);
+	const __m128d incr_a1 = _mm_setr_pd(p_left->incr_coeffs.a1, p_right->incr_coeffs.a1);
+	const __m128d incr_a2 = _mm_setr_pd(p_left->incr_coeffs.a2, p_right->incr_coeffs.a2);
+	__m128d ha1 = _mm_setr_pd(p_left->ha1, p_right->ha1);
+	__m128d ha2 = _mm_setr_pd(p_left->ha2, p_right->ha2);
+	__m128d hb1 = _mm_setr_pd(p_left->hb1, p_right->hb1);
+	__m128d hb2 = _mm_setr_pd(p_left->hb2, p_right->hb2);
+
+	for (int i = 0; i < p_amount; i++) {
+		const __m128d pre = _mm_cvtps_pd(_mm_castsi128_ps(_mm_loadl_epi64((const __m128i *)&p_frames[i])));
+		__m128d sample = _mm_mul_pd(pre, b0);
+		sample = _mm_add_pd(sample, _mm_mul_pd(hb1, b1));
+		sample = _mm_add_pd(sample, _mm_mul_pd(hb2, b2));
+		sample = _mm_add_pd(sample, _mm_mul_pd(ha1, a1));
+		sample = _mm_add_pd(sample, _mm_mul_pd(ha2, a2));
+		const __m128 sample_f = _mm_cvtpd_ps(sample);
+		_mm_storel_epi64((__m128i *)&p_frames[i], _mm_castps_si128(sample_f));
+
+		ha2 = ha1;
+		hb2 = hb1;
+		hb1 = pre;
+		ha1 = _mm_cvtps_pd(sample_f);
+
+		if (p_interpolate) {
+			b0 = _mm_add_pd(b0, incr_b0);
+			b1 = _mm_add_pd(b1, incr_b1);
+			b2 = _mm_add_pd(b2, incr_b2);
+			a1 = _mm_add_pd(a1, incr_a1);
+			a2 = _mm_add_pd(a2, incr_a2);
+		}
+	}
+
+	double lanes[2];
+#define AUDIO_FILTER_STORE(m_vec, m_member) \
+	_mm_storeu_pd(lanes, m_vec);            \
+	p_left->m_member = lanes[0];            \
+	p_right->m_member = lanes[1];
+#elif defined(AUDIO_FILTER_NEON)
+#define AUDIO_FILTER_PAIR(m_member) vcombine_f64(vdup_n_f64(p_left->m_member), vdup_n_f64(p_right->m_member))
+	float64x2_t b0 = AUDIO_FILTER_PAIR(coeffs.b0);
+	float64x2_t b1 = AUDIO_FILTER_PAIR(coeffs.b1);
+	float64x2_t b2 = AUDIO_FILTER_PAIR(coeffs.b2);
+	float64x2_t a1 = AUDIO_FILTER_PAIR(coeffs.a1);
+	float64x2_t a2 = AUDIO_FILTER_PAIR(coeffs.a2);
+	const float64x2_t incr_b0 = AUDIO_FILTER_PAIR(incr_coeffs.b0);
+	const float64x2_t incr_b1 = AUDIO_FILTER_PAIR(incr_coeffs.b1);
+	const float64x2_t incr_b2 = AUDIO_FILTER_PAIR(incr_coeffs.b2);
+	const float64x2_t incr_a1 = AUDIO_FILTER_PAIR(incr_coeffs.a1);
+	const float64x2_t incr_a2 = AUDIO_FILTER_PAIR(incr_coeffs.a2);
+	float64x2_t ha1 = AUDIO_FILTER_PAIR(ha1);
+	float64x2_t ha2 = AUDIO_FILTER_PAIR(ha2);
+	float64x2_t hb1 = AUDIO_FILTER_PAIR(hb1);
+	float64x2_t hb2 = AUDIO_FILTER_PAIR(hb2);
+#undef AUDIO_FILTER_PAIR
+
+	for (int i = 0; i < p_amount; i++) {
+		const float64x2_t pre = vcvt_f64_f32(vld1_f32(&p_frames[i].left));
+		float64x2_t sample = vmulq_f64(pre, b0);
+		sample = vaddq_f64(sample, vmulq_f64(hb1, b1));
+		sample = vaddq_f64(sample, vmulq_f64(hb2, b2));
+		sample = vaddq_f64(sample, vmulq_f64(ha1, a1));
+		sample = vaddq_f64(sample, vmulq_f64(ha2, a2));
+		const float32x2_t sample_f = vcvt_f32_f64(sample);
+		vst1_f32(&p_frames[i].left, sample_f);
+
+		ha2 = ha1;
+		hb2 = hb1;
+		hb1 = pre;
+		ha1 = vcvt_f64_f32(sample_f);
+
+		if (p_interpolate) {
+			b0 = vaddq_f64(b0, incr_b0);
+			b1 = vaddq_f64(b1, incr_b1);
+			b2 = vaddq_f64(b2, incr_b2);
+			a1 = vaddq_f64(a1, incr_a1);
+			a2 = vaddq_f64(a2, incr_a2);
+		}
+	}
+
+	double lanes[2];
+#define AUDIO_FILTER_STORE(m_vec, m_member) \
+	vst1q_f64(lanes, m_vec);                \
+	p_left->m_member = lanes[0];            \
+	p_right->m_member = lanes[1];
+#endif
+
+#ifdef AUDIO_FILTER_STORE
+	AUDIO_FILTER_STORE(b0, coeffs.b0);
+	AUDIO_FILTER_STORE(b1, coeffs.b1);
+	AUDIO_FILTER_STORE(b2, coeffs.b2);
+	AUDIO_FILTER_STORE(a1, coeffs.a1);
+	AUDIO_FILTER_STORE(a2, coeffs.a2);
+	AUDIO_FILTER_STORE(ha1, ha1);
+	AUDIO_FILTER_STORE(ha2, ha2);
+	AUDIO_FILTER_STORE(hb1, hb1);
+	AUDIO_FILTER_STORE(hb2, hb2);
+#undef AUDIO_FILTER_STORE
+#else
+	if (p_interpolate) {
+		for (int i = 0; i < p_amount; i++) {
+			p_left->process_one_interp(p_frames[i].left);
+			p_right->process_one_interp(p_frames[i].right);
+		}
+	} else {
+		for (int i = 0; i < p_amount; i++) {
+			p_left->process_one(p_frames[i].left);
+			p_right->process_one(p_frames[i].right);
+		}
+	}
+#endif
+}
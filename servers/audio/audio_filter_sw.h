@@ -32,6 +32,8 @@
 
 #include "core/typedefs.h"
 
+struct AudioFrame;
+
 class AudioFilterSW {
 public:
 	struct Coeffs {
@@ -66,6 +68,8 @@ public:
 	public:
 		void set_filter(AudioFilterSW *p_filter, bool p_clear_history = true);
 		void process(float *p_samples, int p_amount, int p_stride = 1, bool p_interpolate = false);
+		// Filters the left channel of the frames with `p_left` and the right one with `p_right`, both at once.
+		static void process_stereo(Processor *p_left, Processor *p_right, AudioFrame *p_frames, int p_amount, bool p_interpolate = false);
 		void update_coeffs(int p_interp_buffer_len = 0);
 		_ALWAYS_INLINE_ void process_one(float &p_sample);
 		_ALWAYS_INLINE_ void process_one_interp(float &p_sample);
@@ -0,0 +1,326 @@
+/**************************************************************************/
+/*  audio_mix_kernels.cpp                                                 */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GODOT ENGINE                               */
+/*                        https://godotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#include "audio_mix_kernels.h"
+
+#include "core/string/print_string.h"
+#include "core/variant/variant.h"
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define AUDIO_MIX_SSE2
+#include <emmintrin.h>
+#if defined(__x86_64__) || defined(_M_X64)
+// AVX2 kernels are compiled for the function only, and only used when the CPU supports them.
+#define AUDIO_MIX_AVX2
+#include <immintrin.h>
+#if defined(__GNUC__) || defined(__clang__)
+#define AUDIO_MIX_TARGET_AVX2 __attribute__((target("avx2")))
+#else
+#define AUDIO_MIX_TARGET_AVX2
+#endif
+#ifdef _MSC_VER
+#include <intrin.h>
+#endif
+#endif
+#elif defined(__aarch64__) || defined(_M_ARM64)
+#define AUDIO_MIX_NEON
+#include <arm_neon.h>
+#endif
+
+// Scalar kernels, also used for the frames left over by the vectorized ones.
+// The vectorized kernels perform the same operations in the same order, so they
+// produce the same results.
+
+template <bool t_accumulate>
+static void _ramp_scalar_from(uint32_t p_from, AudioFrame *p_dst, const AudioFrame *p_src, AudioFrame p_vol_start, AudioFrame p_vol_final, uint32_t p_frames) {
+	for (uint32_t i = p_from; i < p_frames; i++) {
+		float lerp_param = (float)i / p_frames;
+		AudioFrame mixed = (p_vol_final * lerp_param + (1 - lerp_param) * p_vol_start) * p_src[i];
+		if constexpr (t_accumulate) {
+			p_dst[i] += mixed;
+		} else {
+			p_dst[i] = mixed;
+		}
+	}
+}
+
+template <bool t_accumulate>
+static void _ramp_scalar(AudioFrame *p_dst, const AudioFrame *p_src, AudioFrame p_vol_start, AudioFrame p_vol_final, uint32_t p_frames) {
+	_ramp_scalar_from<t_accumulate>(0, p_dst, p_src, p_vol_start, p_vol_final, p_frames);
+}
+
+static void _accumulate_scalar_from(uint32_t p_from, AudioFrame *p_dst, const AudioFrame *p_src, uint32_t p_frames) {
+	for (uint32_t i = p_from; i < p_frames; i++) {
+		p_dst[i] += p_src[i];
+	}
+}
+
+static void _accumulate_scalar(AudioFrame *p_dst, const AudioFrame *p_src, uint32_t p_frames) {
+	_accumulate_scalar_from(0, p_dst, p_src, p_frames);
+}
+
+#ifdef AUDIO_MIX_SSE2
+
+// Two frames per vector, laid out as (left, right, left, right).
+
+template <bool t_accumulate>
+static void _ramp_sse2(AudioFrame *p_dst, const AudioFrame *p_src, AudioFrame p_vol_start, AudioFrame p_vol_final, uint32_t p_frames) {
+	const __m128 vol_start = _mm_setr_ps(p_vol_start.left, p_vol_start.right, p_vol_start.left, p_vol_start.right);
+	const __m128 vol_final = _mm_setr_ps(p_vol_final.left, p_vol_final.right, p_vol_final.left, p_vol_final.right);
+	const __m128 frames = _mm_set1_ps((float)p_frames);
+	const __m128 one = _mm_set1_ps(1.0f);
+	const __m128 step = _mm_set1_ps(2.0f);
+	__m128 index = _mm_setr_ps(0.0f, 0.0f, 1.0f, 1.0f);
+
+	uint32_t i = 0;
+	for (; i + 2 <= p_frames; i += 2) {
+		const __m128 lerp_param = _mm_div_ps(index, frames);
+		const __m128 vol = _mm_add_ps(_mm_mul_ps(vol_final, lerp_param), _mm_mul_ps(_mm_sub_ps(one, lerp_param), vol_start));
+		__m128 mixed = _mm_mul_ps(vol, _mm_loadu_ps(&p_src[i].left));
+		if constexpr (t_accumulate) {
+			mixed = _mm_add_ps(_mm_loadu_ps(&p_dst[i].left), mixed);
+		}
+		_mm_storeu_ps(&p_dst[i].left, mixed);
+		index = _mm_add_ps(index, step);
+	}
+	_ramp_scalar_from<t_accumulate>(i, p_dst, p_src, p_vol_start, p_vol_final, p_frames);
+}
+
+static void _accumulate_sse2(AudioFrame *p_dst, const AudioFrame *p_src, uint32_t p_frames) {
+	uint32_t i = 0;
+	for (; i + 4 <= p_frames; i += 4) {
+		const __m128 a = _mm_add_ps(_mm_loadu_ps(&p_dst[i].left), _mm_loadu_ps(&p_src[i].left));
+		const __m128 b = _mm_add_ps(_mm_loadu_ps(&p_dst[i + 2].left), _mm_loadu_ps(&p_src[i + 2].left));
+		_mm_storeu_ps(&p_dst[i].left, a);
+		_mm_storeu_ps(&p_dst[i + 2].left, b);
+	}
+	_accumulate_scalar_from(i, p_dst, p_src, p_frames);
+}
+
+#endif // AUDIO_MIX_SSE2
+
+#ifdef AUDIO_MIX_AVX2
+
+// Four frames per vector.
+
+template <bool t_accumulate>
+AUDIO_MIX_TARGET_AVX2 static void _ramp_avx2(AudioFrame *p_dst, const AudioFrame *p_src, AudioFrame p_vol_start, AudioFrame p_vol_final, uint32_t p_frames) {
+	const __m256 vol_start = _mm256_setr_ps(p_vol_start.left, p_vol_start.right, p_vol_start.left, p_vol_start.right, p_vol_start.left, p_vol_start.right, p_vol_start.left, p_vol_start.right);
+	const __m256 vol_final = _mm256_setr_ps(p_vol_final.left, p_vol_final.right, p_vol_final.left, p_vol_final.right, p_vol_final.left, p_vol_final.right, p_vol_final.left, p_vol_final.right);
+	const __m256 frames = _mm256_set1_ps((float)p_frames);
+	const __m256 one = _mm256_set1_ps(1.0f);
+	const __m256 step = _mm256_set1_ps(4.0f);
+	__m256 index = _mm256_setr_ps(0.0f, 0.0f, 1.0f, 1.0f, 2.0f, 2.0f, 3.0f, 3.0f);
+
+	uint32_t i = 0;
+	for (; i + 4 <= p_frames; i += 4) {
+		const __m256 lerp_param = _mm256_div_ps(index, frames);
+		const __m256 vol = _mm256_add_ps(_mm256_mul_ps(vol_final, lerp_param), _mm256_mul_ps(_mm256_sub_ps(one, lerp_param), vol_start));
+		__m256 mixed = _mm256_mul_ps(vol, _mm256_loadu_ps(&p_src[i].left));
+		if constexpr (t_accumulate) {
+			mixed = _mm256_add_ps(_mm256_loadu_ps(&p_dst[i].left), mixed);
+		}
+		_mm256_storeu_ps(&p_dst[i].left, mixed);
+		index = _mm256_add_ps(index, step);
+	}
+	_ramp_scalar_from<t_accumulate>(i, p_dst, p_src, p_vol_start, p_vol_final, p_frames);
+}
+
+AUDIO_MIX_TARGET_AVX2 static void _accumulate_avx2(AudioFrame *p_dst, const AudioFrame *p_src, uint32_t p_frames) {
+	uint32_t i = 0;
+	for (; i + 8 <= p_frames; i += 8) {
+		const __m256 a = _mm256_add_ps(_mm256_loadu_ps(&p_dst[i].left), _mm256_loadu_ps(&p_src[i].left));
+		const __m256 b = _mm256_add_ps(_mm256_loadu_ps(&p_dst[i + 4].left), _mm256_loadu_ps(&p_src[i + 4].left));
+		_mm256_storeu_ps(&p_dst[i].left, a);
+		_mm256_storeu_ps(&p_dst[i + 4].left, b);
+	}
+	_accumulate_scalar_from(i, p_dst, p_src, p_frames);
+}
+
+static bool _cpu_has_avx2() {
+#ifdef _MSC_VER
+	int info[4];
+	__cpuid(info, 0);
+	if (info[0] < 7) {
+		return false;
+	}
+	__cpuid(info, 1);
+	// AVX, and OSXSAVE so the OS support can be queried.
+	const int avx_osxsave = (1 << 28) | (1 << 27);
+	if ((info[2] & avx_osxsave) != avx_osxsave) {
+		return false;
+	}
+	// The OS must preserve the XMM and YMM registers.
+	if ((_xgetbv(0) & 0x6) != 0x6) {
+		return false;
+	}
+	__cpuidex(info, 7, 0);
+	return (info[1] & (1 << 5)) != 0;
+#else
+	__builtin_cpu_init();
+	return __builtin_cpu_supports("avx2");
+#endif
+}
+
+#endif // AUDIO_MIX_AVX2
+
+#ifdef AUDIO_MIX_NEON
+
+// Two frames per vector, laid out as (left, right, left, right).
+
+template <bool t_accumulate>
+static void _ramp_neon(AudioFrame *p_dst, const AudioFrame *p_src, AudioFrame p_vol_start, AudioFrame p_vol_final, uint32_t p_frames) {
+	const float32x2_t vol_start_half = vld1_f32(&p_vol_start.left);
+	const float32x2_t vol_final_half = vld1_f32(&p_vol_final.left);
+	const float32x4_t vol_start = vcombine_f32(vol_start_half, vol_start_half);
+	const float32x4_t vol_final = vcombine_f32(vol_final_half, vol_final_half);
+	const float32x4_t frames = vdupq_n_f32((float)p_frames);
+	const float32x4_t one = vdupq_n_f32(1.0f);
+	const float32x4_t step = vdupq_n_f32(2.0f);
+	const float first_index[4] = { 0.0f, 0.0f, 1.0f, 1.0f };
+	float32x4_t index = vld1q_f32(first_index);
+
+	uint32_t i = 0;
+	for (; i + 2 <= p_frames; i += 2) {
+		const float32x4_t lerp_param = vdivq_f32(index, frames);
+		const float32x4_t vol = vaddq_f32(vmulq_f32(vol_final, lerp_param), vmulq_f32(vsubq_f32(one, lerp_param), vol_start));
+		float32x4_t mixed = vmulq_f32(vol, vld1q_f32(&p_src[i].left));
+		if constexpr (t_accumulate) {
+			mixed = vaddq_f32(vld1q_f32(&p_dst[i].left), mixed);
+		}
+		vst1q_f32(&p_dst[i].left, mixed);
+		index = vaddq_f32(index, step);
+	}
+	_ramp_scalar_from<t_accumulate>(i, p_dst, p_src, p_vol_start, p_vol_final, p_frames);
+}
+
+static void _accumulate_neon(AudioFrame *p_dst, const AudioFrame *p_src, uint32_t p_frames) {
+	uint32_t i = 0;
+	for (; i + 4 <= p_frames; i += 4) {
+		const float32x4_t a = vaddq_f32(vld1q_f32(&p_dst[i].left), vld1q_f32(&p_src[i].left));
+		const float32x4_t b = vaddq_f32(vld1q_f32(&p_dst[i + 2].left), vld1q_f32(&p_src[i + 2].left));
+		vst1q_f32(&p_dst[i].left, a);
+		vst1q_f32(&p_dst[i + 2].left, b);
+	}
+	_accumulate_scalar_from(i, p_dst, p_src, p_frames);
+}
+
+#endif // AUDIO_MIX_NEON
+
+AudioMixKernels::RampFunc AudioMixKernels::mix_ramp = &_ramp_scalar<true>;
+AudioMixKernels::RampFunc AudioMixKernels::scale_ramp = &_ramp_scalar<false>;
+AudioMixKernels::AccumulateFunc AudioMixKernels::accumulate = &_accumulate_scalar;
+AudioMixKernels::Implementation AudioMixKernels::implementation = AudioMixKernels::IMPLEMENTATION_SCALAR;
+
+bool AudioMixKernels::is_implementation_supported(Implementation p_implementation) {
+	switch (p_implementation) {
+		case IMPLEMENTATION_SCALAR:
+			return true;
+#ifdef AUDIO_MIX_SSE2
+		case IMPLEMENTATION_SSE2:
+			return true;
+#endif
+#ifdef AUDIO_MIX_AVX2
+		case IMPLEMENTATION_AVX2: {
+			static const bool supported = _cpu_has_avx2();
+			return supported;
+		}
+#endif
+#ifdef AUDIO_MIX_NEON
+		case IMPLEMENTATION_NEON:
+			return true;
+#endif
+		default:
+			return false;
+	}
+}
+
+AudioMixKernels::Implementation AudioMixKernels::get_best_implementation() {
+	for (int i = IMPLEMENTATION_MAX - 1; i > IMPLEMENTATION_SCALAR; i--) {
+		if (is_implementation_supported(Implementation(i))) {
+			return Implementation(i);
+		}
+	}
+	return IMPLEMENTATION_SCALAR;
+}
+
+const char *AudioMixKernels::get_implementation_name(Implementation p_implementation) {
+	switch (p_implementation) {
+		case IMPLEMENTATION_SCALAR:
+			return "Scalar";
+		case IMPLEMENTATION_SSE2:
+			return "SSE2";
+		case IMPLEMENTATION_AVX2:
+			return "AVX2";
+		case IMPLEMENTATION_NEON:
+			return "NEON";
+		default:
+			return "Unknown";
+	}
+}
+
+void AudioMixKernels::set_implementation(Implementation p_implementation) {
+	ERR_FAIL_COND_MSG(!is_implementation_supported(p_implementation), vformat("Audio mix kernels \"%s\" are not supported on this CPU.", get_implementation_name(p_implementation)));
+
+	switch (p_implementation) {
+#ifdef AUDIO_MIX_SSE2
+		case IMPLEMENTATION_SSE2:
+			mix_ramp = &_ramp_sse2<true>;
+			scale_ramp = &_ramp_sse2<false>;
+			accumulate = &_accumulate_sse2;
+			break;
+#endif
+#ifdef AUDIO_MIX_AVX2
+		case IMPLEMENTATION_AVX2:
+			mix_ramp = &_ramp_avx2<true>;
+			scale_ramp = &_ramp_avx2<false>;
+			accumulate = &_accumulate_avx2;
+			break;
+#endif
+#ifdef AUDIO_MIX_NEON
+		case IMPLEMENTATION_NEON:
+			mix_ramp = &_ramp_neon<true>;
+			scale_ramp = &_ramp_neon<false>;
+			accumulate = &_accumulate_neon;
+			break;
+#endif
+		default:
+			mix_ramp = &_ramp_scalar<true>;
+			scale_ramp = &_ramp_scalar<false>;
+			accumulate = &_accumulate_scalar;
+			break;
+	}
+	implementation = p_implementation;
+}
+
+void AudioMixKernels::init() {
+	set_implementation(get_best_implementation());
+	print_verbose(vformat("Audio mix kernels: %s.", get_implementation_name(implementation)));
+}
@@ -0,0 +1,69 @@
+/**************************************************************************/
+/*  audio_mix_kernels.h                                                   */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GODOT ENGINE                               */
+/*                        https://godotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#pragma once
+
+#include "core/math/audio_frame.h"
+
+// Inner loops of the audio mixer. Each kernel has a scalar implementation and
+// vectorized ones (SSE2 and AVX2 on x86, NEON on ARM64). The best one supported
+// by the CPU is selected at runtime by `init()`; until then the scalar one is used.
+class AudioMixKernels {
+public:
+	enum Implementation {
+		IMPLEMENTATION_SCALAR,
+		IMPLEMENTATION_SSE2,
+		IMPLEMENTATION_AVX2,
+		IMPLEMENTATION_NEON,
+		IMPLEMENTATION_MAX,
+	};
+
+	typedef void (*RampFunc)(AudioFrame *p_dst, const AudioFrame *p_src, AudioFrame p_vol_start, AudioFrame p_vol_final, uint32_t p_frames);
+	typedef void (*AccumulateFunc)(AudioFrame *p_dst, const AudioFrame *p_src, uint32_t p_frames);
+
+	// `p_dst[i] += lerp(p_vol_start, p_vol_final, i / p_frames) * p_src[i]`.
+	static RampFunc mix_ramp;
+	// `p_dst[i] = lerp(p_vol_start, p_vol_final, i / p_frames) * p_src[i]`.
+	static RampFunc scale_ramp;
+	// `p_dst[i] += p_src[i]`.
+	static AccumulateFunc accumulate;
+
+	static bool is_implementation_supported(Implementation p_implementation);
+	static Implementation get_best_implementation();
+	static const char *get_implementation_name(Implementation p_implementation);
+
+	static void set_implementation(Implementation p_implementation);
+	static Implementation get_implementation() { return implementation; }
+
+	static void init();
+
+private:
+	static Implementation implementation;
+};
@@ -31,6 +31,7 @@
 #include "audio_stream.h"
 
 #include "core/config/project_settings.h"
+#include "servers/audio/audio_stream_decode_ahead.h"
 
 void AudioStreamPlayback::start(double p_from_pos) {
 	if (GDVIRTUAL_CALL(_start, p_from_pos)) {
@@ -172,6 +173,148 @@ void AudioStreamPlaybackResampled::begin_resample() {
 	mix_offset = 0;
 }
 
+uint32_t AudioStreamPlaybackResampled::_get_decode_ahead_read_pos(uint32_t &r_write_pos) const {
+	uint32_t read_pos = decode_ahead->read_pos.get();
+	uint32_t discard_pos = decode_ahead->discard_pos.get();
+	r_write_pos = decode_ahead->write_pos.get();
+	// Positions wrap around, a discard position is only recent if it's between the read and write ones.
+	if (uint32_t(discard_pos - read_pos) <= uint32_t(r_write_pos - read_pos)) {
+		return discard_pos;
+	}
+	return read_pos;
+}
+
+int AudioStreamPlaybackResampled::_read_decoded_ahead(AudioFrame *p_buffer, int p_frames) {
+	uint32_t write_pos;
+	uint32_t read_pos = _get_decode_ahead_read_pos(write_pos);
+	uint32_t to_read = MIN(uint32_t(p_frames), write_pos - read_pos);
+
+	uint32_t offset = read_pos & decode_ahead->mask;
+	uint32_t first = MIN(to_read, decode_ahead->mask + 1 - offset);
+	memcpy(p_buffer, decode_ahead->frames.ptr() + offset, first * sizeof(AudioFrame));
+	memcpy(p_buffer + first, decode_ahead->frames.ptr(), (to_read - first) * sizeof(AudioFrame));
+
+	decode_ahead->read_pos.set(read_pos + to_read);
+	return to_read;
+}
+
+bool AudioStreamPlaybackResampled::_decode_ahead_step() {
+	MutexLock lock(decoder_mutex);
+	if (!decode_ahead || decode_ahead->ended.is_set()) {
+		return false;
+	}
+
+	uint32_t write_pos;
+	uint32_t read_pos = _get_decode_ahead_read_pos(write_pos);
+	uint32_t space = decode_ahead->mask + 1 - (write_pos - read_pos);
+	if (space < DECODE_AHEAD_CHUNK) {
+		return false;
+	}
+
+	uint32_t offset = write_pos & decode_ahead->mask;
+	int frames = MIN(uint32_t(DECODE_AHEAD_CHUNK), decode_ahead->mask + 1 - offset);
+	decode_ahead->decoding = true;
+	int decoded = _mix_internal(decode_ahead->frames.ptr() + offset, frames);
+	decode_ahead->decoding = false;
+
+	// Publish the frames before flagging the end, `_mix_decoded()` relies on that order.
+	decode_ahead->write_pos.set(write_pos + decoded);
+	if (decoded < frames) {
+		decode_ahead->ended.set();
+	}
+	return true;
+}
+
+int AudioStreamPlaybackResampled::_mix_decoded(AudioFrame *p_buffer, int p_frames) {
+	if (!decode_ahead) {
+		return _mix_internal(p_buffer, p_frames);
+	}
+
+	bool ended = decode_ahead->ended.is_set();
+	int mixed = _read_decoded_ahead(p_buffer, p_frames);
+	if (mixed < p_frames && !ended) {
+		// Underrun, decode the rest inline. This waits for at most one chunk being decoded by the
+		// decode-ahead thread, whose frames come first.
+		MutexLock lock(decoder_mutex);
+		mixed += _read_decoded_ahead(p_buffer + mixed, p_frames - mixed);
+		if (mixed < p_frames && !decode_ahead->ended.is_set()) {
+			decode_ahead->decoding = true;
+			int decoded = _mix_internal(p_buffer + mixed, p_frames - mixed);
+			decode_ahead->decoding = false;
+			if (decoded < p_frames - mixed) {
+				decode_ahead->ended.set();
+			}
+			mixed += decoded;
+		}
+	}
+
+	if (mixed < p_frames) {
+		// Same as the decoders, which fill the remainder with silence.
+		for (int i = mixed; i < p_frames; i++) {
+			p_buffer[i] = AudioFrame(0, 0);
+		}
+	} else if (!decode_ahead->ended.is_set() && uint32_t(_get_decoded_ahead_frames()) <= (decode_ahead->mask + 1) / 2) {
+		AudioStreamDecodeAhead *decoder_thread = AudioStreamDecodeAhead::get_singleton();
+		if (decoder_thread) {
+			decoder_thread->request_decode();
+		}
+	}
+	return mixed;
+}
+
+void AudioStreamPlaybackResampled::_set_decode_ahead_enabled(bool p_enabled) {
+	if (p_enabled == (decode_ahead != nullptr)) {
+		return;
+	}
+	AudioStreamDecodeAhead *decoder_thread = AudioStreamDecodeAhead::get_singleton();
+
+	if (p_enabled) {
+		if (!decoder_thread) {
+			return;
+		}
+		uint32_t frames = decoder_thread->get_buffer_frames(get_stream_sampling_rate());
+		decode_ahead = memnew(DecodeAhead);
+		decode_ahead->frames.resize(frames);
+		decode_ahead->mask = frames - 1;
+		// Nothing to decode until the playback is started and repositions its decoder.
+		decode_ahead->ended.set();
+		decoder_thread->add_playback(this);
+	} else {
+		// Waits for the decode-ahead thread to be done with this playback.
+		if (decoder_thread) {
+			decoder_thread->remove_playback(this);
+		}
+		memdelete(decode_ahead);
+		decode_ahead = nullptr;
+	}
+}
+
+void AudioStreamPlaybackResampled::_discard_decoded_ahead() {
+	if (!decode_ahead || decode_ahead->decoding) {
+		return;
+	}
+	decode_ahead->discard_pos.set(decode_ahead->write_pos.get());
+	decode_ahead->ended.clear();
+
+	AudioStreamDecodeAhead *decoder_thread = AudioStreamDecodeAhead::get_singleton();
+	if (decoder_thread) {
+		decoder_thread->request_decode();
+	}
+}
+
+int AudioStreamPlaybackResampled::_get_decoded_ahead_frames() const {
+	if (!decode_ahead) {
+		return 0;
+	}
+	uint32_t write_pos;
+	uint32_t read_pos = _get_decode_ahead_read_pos(write_pos);
+	return write_pos - read_pos;
+}
+
+AudioStreamPlaybackResampled::~AudioStreamPlaybackResampled() {
+	_set_decode_ahead_enabled(false);
+}
+
 int AudioStreamPlaybackResampled::_mix_internal(AudioFrame *p_buffer, int p_frames) {
 	int ret = 0;
 	GDVIRTUAL_CALL(_mix_resampled, p_buffer, p_frames, ret);
@@ -229,7 +372,7 @@ int AudioStreamPlaybackResampled::mix(AudioFrame *p_buffer, float p_rate_scale,
 			internal_buffer[1] = internal_buffer[INTERNAL_BUFFER_LEN + 1];
 			internal_buffer[2] = internal_buffer[INTERNAL_BUFFER_LEN + 2];
 			internal_buffer[3] = internal_buffer[INTERNAL_BUFFER_LEN + 3];
-			int mixed_frames = _mix_internal(internal_buffer + 4, INTERNAL_BUFFER_LEN);
+			int mixed_frames = _mix_decoded(internal_buffer + 4, INTERNAL_BUFFER_LEN);
 			if (mixed_frames != INTERNAL_BUFFER_LEN) {
 				// internal_buffer[mixed_frames] is the first frame of silence.
 				internal_buffer_end = mixed_frames;
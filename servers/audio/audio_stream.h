@@ -101,6 +101,10 @@ public:
 
 	virtual double get_playback_position() const;
 	virtual void seek(double p_time);
+	// Returns the playback position after playing `p_time` more seconds from `p_from_pos`, following loops,
+	// or a negative value if the stream ends before then. Used by the AudioServer to keep virtual voices in time
+	// without decoding them. `Math::NaN` means it can't be known, and such voices keep being decoded instead.
+	virtual double get_position_after(double p_from_pos, double p_time) const { return Math::NaN; }
 
 	virtual void tag_used_streams();
 
@@ -126,6 +130,8 @@ public:
 class AudioStreamPlaybackResampled : public AudioStreamPlayback {
 	GDCLASS(AudioStreamPlaybackResampled, AudioStreamPlayback);
 
+	friend class AudioStreamDecodeAhead;
+
 	enum {
 		FP_BITS = 16, //fixed point used for resampling
 		FP_LEN = (1 << FP_BITS),
@@ -138,7 +144,41 @@ class AudioStreamPlaybackResampled : public AudioStreamPlayback {
 	unsigned int internal_buffer_end = -1;
 	uint64_t mix_offset = 0;
 
+	// Frames decoded ahead of `mix()` by the AudioStreamDecodeAhead thread. Single producer
+	// (whoever holds `decoder_mutex`) and single consumer (the audio thread), so reading
+	// doesn't need to lock. Positions only grow and wrap around, indices are masked.
+	struct DecodeAhead {
+		LocalVector<AudioFrame> frames;
+		uint32_t mask = 0;
+		SafeNumeric<uint32_t> read_pos;
+		SafeNumeric<uint32_t> write_pos;
+		// Frames before this position were decoded before the decoder was repositioned.
+		// Set instead of moving `read_pos`, which only the audio thread writes.
+		SafeNumeric<uint32_t> discard_pos;
+		// The decoder returned less frames than requested, it won't produce more until repositioned.
+		SafeFlag ended;
+		// `_mix_internal()` is running. Seeking from there is looping, which must keep the frames.
+		bool decoding = false;
+	};
+	DecodeAhead *decode_ahead = nullptr;
+
+	uint32_t _get_decode_ahead_read_pos(uint32_t &r_write_pos) const;
+	int _read_decoded_ahead(AudioFrame *p_buffer, int p_frames);
+	bool _decode_ahead_step();
+	int _mix_decoded(AudioFrame *p_buffer, int p_frames);
+
 protected:
+	// Held while the decoder runs. Subclasses that support decode-ahead must also hold it
+	// while repositioning their decoder, and call `_discard_decoded_ahead()` afterwards.
+	Mutex decoder_mutex;
+
+	// Decode on the AudioStreamDecodeAhead thread if it's enabled, `_mix_internal()` may then
+	// be called from it. Subclasses must disable it in their destructor.
+	void _set_decode_ahead_enabled(bool p_enabled);
+	void _discard_decoded_ahead();
+	// Frames decoded but not mixed yet, to correct the position reported by the decoder.
+	int _get_decoded_ahead_frames() const;
+
 	void begin_resample();
 	// Returns the number of frames that were mixed.
 	virtual int _mix_internal(AudioFrame *p_buffer, int p_frames);
@@ -150,9 +190,14 @@ protected:
 	static void _bind_methods();
 
 public:
+	enum {
+		DECODE_AHEAD_CHUNK = 1024, // Frames decoded at once by the AudioStreamDecodeAhead thread.
+	};
+
 	virtual int mix(AudioFrame *p_buffer, float p_rate_scale, int p_frames) override;
 
 	AudioStreamPlaybackResampled() { mix_offset = 0; }
+	~AudioStreamPlaybackResampled();
 };
 
 class AudioStream : public Resource {
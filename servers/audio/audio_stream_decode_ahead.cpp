@@ -0,0 +1,95 @@
+/**************************************************************************/
+/*  audio_stream_decode_ahead.cpp                                         */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GODOT ENGINE                               */
+/*                        https://godotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+
+#include "audio_stream_decode_ahead.h"
+
+#include "servers/audio/audio_stream.h"
+
+AudioStreamDecodeAhead *AudioStreamDecodeAhead::singleton = nullptr;
+
+void AudioStreamDecodeAhead::_thread_func(void *p_self) {
+	Thread::set_name("AudioDecodeAhead");
+	AudioStreamDecodeAhead *self = static_cast<AudioStreamDecodeAhead *>(p_self);
+
+	while (true) {
+		self->semaphore.wait();
+		if (self->exit.is_set()) {
+			break;
+		}
+		self->wake_pending.store(false, std::memory_order_release);
+
+		// Decode one chunk per playback and round, so a playback that was just
+		// started doesn't have to wait for all the others to be filled up.
+		bool decoded = true;
+		while (decoded && !self->exit.is_set()) {
+			decoded = false;
+			MutexLock lock(self->mutex);
+			for (AudioStreamPlaybackResampled *playback : self->playbacks) {
+				decoded = playback->_decode_ahead_step() || decoded;
+			}
+		}
+	}
+}
+
+uint32_t AudioStreamDecodeAhead::get_buffer_frames(float p_sampling_rate) const {
+	uint32_t frames = uint32_t(p_sampling_rate * buffer_ms / 1000);
+	return next_power_of_2(MAX(frames, uint32_t(AudioStreamPlaybackResampled::DECODE_AHEAD_CHUNK * 2)));
+}
+
+void AudioStreamDecodeAhead::add_playback(AudioStreamPlaybackResampled *p_playback) {
+	MutexLock lock(mutex);
+	playbacks.push_back(p_playback);
+}
+
+void AudioStreamDecodeAhead::remove_playback(AudioStreamPlaybackResampled *p_playback) {
+	MutexLock lock(mutex);
+	playbacks.erase(p_playback);
+}
+
+void AudioStreamDecodeAhead::request_decode() {
+	if (!wake_pending.exchange(true, std::memory_order_acq_rel)) {
+		semaphore.post();
+	}
+}
+
+AudioStreamDecodeAhead::AudioStreamDecodeAhead(uint32_t p_buffer_ms) {
+	ERR_FAIL_COND_MSG(singleton != nullptr, "AudioStreamDecodeAhead already exists.");
+	singleton = this;
+	buffer_ms = p_buffer_ms;
+	thread.start(_thread_func, this);
+}
+
+AudioStreamDecodeAhead::~AudioStreamDecodeAhead() {
+	exit.set();
+	semaphore.post();
+	thread.wait_to_finish();
+	singleton = nullptr;
+}
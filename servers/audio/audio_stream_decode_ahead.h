@@ -0,0 +1,76 @@
+/**************************************************************************/
+/*  audio_stream_decode_ahead.h                                           */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GODOT ENGINE                               */
+/*                        https://godotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+
+#pragma once
+
+#include "core/os/mutex.h"
+#include "core/os/semaphore.h"
+#include "core/os/thread.h"
+#include "core/templates/local_vector.h"
+#include "core/templates/safe_refcount.h"
+
+class AudioStreamPlaybackResampled;
+
+// Background thread decoding compressed streams ahead of the audio thread.
+// Playbacks registered here get their `_mix_internal()` called on this thread
+// to keep a ring buffer of decoded frames filled, so `mix()` only has to copy
+// from it. Created by the AudioServer when `audio/general/decode_ahead_ms` is
+// greater than 0.
+class AudioStreamDecodeAhead {
+	static AudioStreamDecodeAhead *singleton;
+
+	uint32_t buffer_ms = 0;
+
+	Thread thread;
+	Semaphore semaphore;
+	SafeFlag exit;
+	std::atomic<bool> wake_pending = false;
+
+	Mutex mutex; // Guards `playbacks`, held while decoding so they can't be freed meanwhile.
+	LocalVector<AudioStreamPlaybackResampled *> playbacks;
+
+	static void _thread_func(void *p_self);
+
+public:
+	static AudioStreamDecodeAhead *get_singleton() { return singleton; }
+
+	// Size of the ring buffer for a stream with the given sampling rate, a power of 2.
+	uint32_t get_buffer_frames(float p_sampling_rate) const;
+
+	void add_playback(AudioStreamPlaybackResampled *p_playback);
+	void remove_playback(AudioStreamPlaybackResampled *p_playback);
+
+	// Wakes up the decoding thread, safe to call from the audio thread.
+	void request_decode();
+
+	AudioStreamDecodeAhead(uint32_t p_buffer_ms);
+	~AudioStreamDecodeAhead();
+};
@@ -38,9 +38,12 @@
 #include "core/os/os.h"
 #include "core/string/string_name.h"
 #include "core/templates/pair.h"
+#include "core/templates/sort_array.h"
 #include "scene/scene_string_names.h"
 #include "servers/audio/audio_driver_dummy.h"
+#include "servers/audio/audio_mix_kernels.h"
 #include "servers/audio/audio_stream.h"
+#include "servers/audio/audio_stream_decode_ahead.h"
 #include "servers/audio/effects/audio_effect_compressor.h"
 
 #include <cstring>
@@ -382,6 +385,7 @@ void AudioServer::_mix_step() {
 	// Main mixing loop for audio streams.
 	// The basic idea here is to copy the samples returned by the AudioStreamPlayback's mix function into the audio buffers,
 	//  while always maintaining a lookahead buffer of size LOOKAHEAD_BUFFER_SIZE to allow fade-outs for sudden stoppages.
+	_update_virtual_voices();
 	for (AudioStreamPlaybackListNode *playback : playback_list) {
 		// Paused streams are no-ops. Don't even mix audio from the stream playback.
 		if (playback->state.load() == AudioStreamPlaybackListNode::PAUSED) {
@@ -392,10 +396,28 @@ void AudioServer::_mix_step() {
 			continue;
 		}
 
+		if (playback->is_virtual.is_set()) {
+			if (playback->should_be_virtual || playback->state.load() != AudioStreamPlaybackListNode::PLAYING) {
+				_mix_virtual_voice(playback);
+				continue;
+			}
+			// The voice is mixed again. Catch up with where it would be, it then fades in from the silent volumes it was left with.
+			if (!Math::is_nan(playback->virtual_position.get())) {
+				playback->stream_playback->seek(playback->virtual_position.get());
+			}
+			for (AudioFrame &frame : playback->lookahead) {
+				frame = AudioFrame(0, 0);
+			}
+			playback->is_virtual.clear();
+		}
+
+		// A voice that stops being mixed fades out first, the same way as when it's paused.
+		bool becoming_virtual = playback->should_be_virtual && playback->state.load() == AudioStreamPlaybackListNode::PLAYING;
+
 		// If `fading_out` is true, we're in the process of fading out the stream playback.
 		// TODO: Currently this sets the volume of the stream to 0 which creates a linear interpolation between its previous volume and silence.
 		//  A more punchy option for fading out could be to just use the lookahead buffer.
-		bool fading_out = playback->state.load() == AudioStreamPlaybackListNode::FADE_OUT_TO_DELETION || playback->state.load() == AudioStreamPlaybackListNode::FADE_OUT_TO_PAUSE;
+		bool fading_out = becoming_virtual || playback->state.load() == AudioStreamPlaybackListNode::FADE_OUT_TO_DELETION || playback->state.load() == AudioStreamPlaybackListNode::FADE_OUT_TO_PAUSE;
 
 		AudioFrame *buf = mix_buffer.ptrw();
 
@@ -519,6 +541,12 @@ void AudioServer::_mix_step() {
 			}
 		}
 
+		if (becoming_virtual && playback->state.load() == AudioStreamPlaybackListNode::PLAYING) {
+			double position = playback->stream_playback->get_playback_position();
+			playback->virtual_position.set(Math::is_nan(playback->stream_playback->get_position_after(position, 0.0)) ? Math::NaN : position);
+			playback->is_virtual.set();
+		}
+
 		switch (playback->state.load()) {
 			case AudioStreamPlaybackListNode::AWAITING_DELETION:
 			case AudioStreamPlaybackListNode::FADE_OUT_TO_DELETION:
@@ -537,130 +565,306 @@ void AudioServer::_mix_step() {
 	}
 
 	// Now that all of the buses have their audio sources mixed into them, we can process the effects and bus sends.
-	for (int i = buses.size() - 1; i >= 0; i--) {
-		Bus *bus = buses[i];
+	if (bus_effects_pool && buses.size() > 2) {
+		_process_buses_parallel(solo_mode);
+	} else {
+		_process_buses_serial(solo_mode);
+	}
 
-		for (int k = 0; k < bus->channels.size(); k++) {
-			if (bus->channels[k].active && !bus->channels[k].used) {
-				// Buffer was not used, but it's still active, so it must be cleaned.
-				AudioFrame *buf = bus->channels.write[k].buffer.ptrw();
+	mix_frames += buffer_size;
+	to_mix = buffer_size;
+}
 
-				for (uint32_t j = 0; j < buffer_size; j++) {
-					buf[j] = AudioFrame(0, 0);
-				}
+AudioServer::Bus *AudioServer::_get_bus_send(int p_bus) {
+	if (p_bus == 0) {
+		return nullptr;
+	}
+
+	// Everything has a send except for the master bus.
+	Bus *bus = buses[p_bus];
+	if (!bus_map.has(bus->send)) {
+		return buses[0];
+	}
+	Bus *send = bus_map[bus->send];
+	if (send->index_cache >= bus->index_cache) { // Invalid, send to master.
+		return buses[0];
+	}
+	return send;
+}
+
+// Only touches the given bus, so buses that don't send to each other can be processed in parallel.
+void AudioServer::_process_bus(Bus *p_bus, bool p_solo_mode) {
+	for (int k = 0; k < p_bus->channels.size(); k++) {
+		if (p_bus->channels[k].active && !p_bus->channels[k].used) {
+			// Buffer was not used, but it's still active, so it must be cleaned.
+			AudioFrame *buf = p_bus->channels.write[k].buffer.ptrw();
+
+			for (uint32_t j = 0; j < buffer_size; j++) {
+				buf[j] = AudioFrame(0, 0);
 			}
 		}
+	}
 
-		// Process effects.
-		if (!bus->bypass) {
-			for (int j = 0; j < bus->effects.size(); j++) {
-				if (!bus->effects[j].enabled) {
-					continue;
-				}
+	// Process effects.
+	if (!p_bus->bypass) {
+		for (int j = 0; j < p_bus->effects.size(); j++) {
+			if (!p_bus->effects[j].enabled) {
+				continue;
+			}
 
 #ifdef DEBUG_ENABLED
-				uint64_t ticks = OS::get_singleton()->get_ticks_usec();
+			uint64_t ticks = OS::get_singleton()->get_ticks_usec();
 #endif
 
-				for (int k = 0; k < bus->channels.size(); k++) {
-					if (!(bus->channels[k].active || bus->channels[k].effect_instances[j]->process_silence())) {
-						continue;
-					}
-					bus->channels.write[k].effect_instances.write[j]->process(bus->channels[k].buffer.ptr(), temp_buffer.write[k].ptrw(), buffer_size);
+			for (int k = 0; k < p_bus->channels.size(); k++) {
+				if (!(p_bus->channels[k].active || p_bus->channels[k].effect_instances[j]->process_silence())) {
+					continue;
 				}
-
+				Bus::Channel &channel = p_bus->channels.write[k];
+				channel.effect_instances.write[j]->process(channel.buffer.ptr(), channel.effect_buffer.ptrw(), buffer_size);
 				// Swap buffers, so internal buffer always has the right data.
-				for (int k = 0; k < bus->channels.size(); k++) {
-					if (!(buses[i]->channels[k].active || bus->channels[k].effect_instances[j]->process_silence())) {
-						continue;
-					}
-					SWAP(bus->channels.write[k].buffer, temp_buffer.write[k]);
-				}
+				SWAP(channel.buffer, channel.effect_buffer);
+			}
 
 #ifdef DEBUG_ENABLED
-				bus->effects.write[j].prof_time += OS::get_singleton()->get_ticks_usec() - ticks;
+			p_bus->effects.write[j].prof_time += OS::get_singleton()->get_ticks_usec() - ticks;
 #endif
-			}
 		}
+	}
 
-		// Process send.
+	for (int k = 0; k < p_bus->channels.size(); k++) {
+		if (!p_bus->channels[k].active) {
+			p_bus->channels.write[k].peak_volume = AudioFrame(AUDIO_MIN_PEAK_DB, AUDIO_MIN_PEAK_DB);
+			continue;
+		}
 
-		Bus *send = nullptr;
+		AudioFrame *buf = p_bus->channels.write[k].buffer.ptrw();
 
-		if (i > 0) {
-			// Everything has a send except for the master bus.
-			if (!bus_map.has(bus->send)) {
-				send = buses[0];
-			} else {
-				send = bus_map[bus->send];
-				if (send->index_cache >= bus->index_cache) { // Invalid, send to master.
-					send = buses[0];
-				}
+		AudioFrame peak = AudioFrame(0, 0);
+
+		float volume = Math::db_to_linear(p_bus->volume_db);
+
+		if (p_solo_mode) {
+			if (!p_bus->soloed) {
+				volume = 0.0;
+			}
+		} else {
+			if (p_bus->mute) {
+				volume = 0.0;
 			}
 		}
 
-		for (int k = 0; k < bus->channels.size(); k++) {
-			if (!bus->channels[k].active) {
-				bus->channels.write[k].peak_volume = AudioFrame(AUDIO_MIN_PEAK_DB, AUDIO_MIN_PEAK_DB);
-				continue;
+		// Apply volume and compute peak.
+		for (uint32_t j = 0; j < buffer_size; j++) {
+			buf[j] *= volume;
+
+			float l = Math::abs(buf[j].left);
+			if (l > peak.left) {
+				peak.left = l;
+			}
+			float r = Math::abs(buf[j].right);
+			if (r > peak.right) {
+				peak.right = r;
 			}
+		}
 
-			AudioFrame *buf = bus->channels.write[k].buffer.ptrw();
+		p_bus->channels.write[k].peak_volume = AudioFrame(Math::linear_to_db(peak.left + AUDIO_PEAK_OFFSET), Math::linear_to_db(peak.right + AUDIO_PEAK_OFFSET));
 
-			AudioFrame peak = AudioFrame(0, 0);
+		if (!p_bus->channels[k].used) {
+			// See if any audio is contained, because channel was not used.
 
-			float volume = Math::db_to_linear(bus->volume_db);
+			if (MAX(peak.right, peak.left) > Math::db_to_linear(channel_disable_threshold_db)) {
+				p_bus->channels.write[k].last_mix_with_audio = mix_frames;
+			} else if (mix_frames - p_bus->channels[k].last_mix_with_audio > channel_disable_frames) {
+				p_bus->channels.write[k].active = false; // Went inactive, don't send.
+			}
+		}
+	}
+}
 
-			if (solo_mode) {
-				if (!bus->soloed) {
-					volume = 0.0;
-				}
-			} else {
-				if (bus->mute) {
-					volume = 0.0;
-				}
+void AudioServer::_send_bus(int p_bus) {
+	Bus *send = _get_bus_send(p_bus);
+	if (!send) {
+		return;
+	}
+
+	Bus *bus = buses[p_bus];
+	for (int k = 0; k < bus->channels.size(); k++) {
+		if (!bus->channels[k].active) {
+			continue;
+		}
+
+		const AudioFrame *buf = bus->channels[k].buffer.ptr();
+		AudioFrame *target_buf = thread_get_channel_mix_buffer(send->index_cache, k);
+
+		AudioMixKernels::accumulate(target_buf, buf, buffer_size);
+	}
+}
+
+void AudioServer::_process_buses_serial(bool p_solo_mode) {
+	for (int i = buses.size() - 1; i >= 0; i--) {
+		_process_bus(buses[i], p_solo_mode);
+		_send_bus(i);
+	}
+}
+
+void AudioServer::_process_bus_batch_task(void *p_audio_server, uint32_t p_index) {
+	AudioServer *audio_server = (AudioServer *)p_audio_server;
+	audio_server->_process_bus(audio_server->bus_batch[p_index], audio_server->bus_batch_solo_mode);
+}
+
+void AudioServer::_process_buses_parallel(bool p_solo_mode) {
+	// Buses only send to buses with a lower index, so depths can be computed in index order.
+	// Buses at the same depth never send to each other, and are processed as one batch,
+	// deepest first, so every bus has received all of its sends before being processed.
+	bus_depths.resize(buses.size());
+	bus_depths[0] = 0;
+	uint32_t max_depth = 0;
+	for (int i = 1; i < buses.size(); i++) {
+		bus_depths[i] = bus_depths[_get_bus_send(i)->index_cache] + 1;
+		max_depth = MAX(max_depth, bus_depths[i]);
+	}
+
+	bus_batch_solo_mode = p_solo_mode;
+	for (int64_t depth = max_depth; depth >= 0; depth--) {
+		bus_batch.clear();
+		for (int i = buses.size() - 1; i >= 0; i--) {
+			if (bus_depths[i] == depth) {
+				bus_batch.push_back(buses[i]);
 			}
+		}
 
-			// Apply volume and compute peak.
-			for (uint32_t j = 0; j < buffer_size; j++) {
-				buf[j] *= volume;
+		if (bus_batch.size() > 1) {
+			WorkerThreadPool::GroupID group = bus_effects_pool->add_native_group_task(&AudioServer::_process_bus_batch_task, this, bus_batch.size(), -1, true);
+			bus_effects_pool->wait_for_group_task_completion(group);
+		} else {
+			_process_bus(bus_batch[0], p_solo_mode);
+		}
 
-				float l = Math::abs(buf[j].left);
-				if (l > peak.left) {
-					peak.left = l;
-				}
-				float r = Math::abs(buf[j].right);
-				if (r > peak.right) {
-					peak.right = r;
-				}
+		// Sends are summed on this thread, in the same order as when processing serially.
+		for (Bus *bus : bus_batch) {
+			_send_bus(bus->index_cache);
+		}
+	}
+}
+
+void AudioServer::_update_virtual_voices() {
+	bool has_bus_limits = false;
+	for (const Bus *bus : buses) {
+		if (bus->max_voices > 0) {
+			has_bus_limits = true;
+			break;
+		}
+	}
+	bool has_limits = max_voices > 0 || has_bus_limits || virtualize_inaudible_voices;
+	if (!has_limits && !has_virtual_voices) {
+		return;
+	}
+
+	voice_ranks.clear();
+	for (AudioStreamPlaybackListNode *playback : playback_list) {
+		playback->should_be_virtual = false;
+		// Paused and stopping voices don't count towards the limits.
+		if (!has_limits || playback->state.load() != AudioStreamPlaybackListNode::PLAYING || playback->stream_playback->get_is_sample()) {
+			continue;
+		}
+
+		VoiceRank rank;
+		rank.playback = playback;
+		rank.bus_details = playback->bus_details.load();
+		rank.priority = playback->priority.get();
+		for (int idx = 0; idx < MAX_BUSES_PER_PLAYBACK; idx++) {
+			if (!rank.bus_details->bus_active[idx]) {
+				continue;
+			}
+			for (int channel_idx = 0; channel_idx < channel_count; channel_idx++) {
+				const AudioFrame &volume = rank.bus_details->volume[idx][channel_idx];
+				rank.volume = MAX(rank.volume, MAX(volume.left, volume.right));
 			}
+		}
+		if (!playback->is_virtual.is_set()) {
+			// Favor voices that are already mixed, so voices of similar volume don't keep swapping.
+			rank.volume *= 1.25f;
+		}
+		// This only allocates when there are more voices than ever before.
+		voice_ranks.push_back(rank);
+	}
+
+	has_virtual_voices = false;
+	if (voice_ranks.is_empty()) {
+		return;
+	}
 
-			bus->channels.write[k].peak_volume = AudioFrame(Math::linear_to_db(peak.left + AUDIO_PEAK_OFFSET), Math::linear_to_db(peak.right + AUDIO_PEAK_OFFSET));
+	SortArray<VoiceRank, VoiceRankComparator> sorter;
+	sorter.sort(voice_ranks.ptr(), voice_ranks.size());
 
-			if (!bus->channels[k].used) {
-				// See if any audio is contained, because channel was not used.
+	bus_voice_counts.resize(buses.size());
+	for (int &count : bus_voice_counts) {
+		count = 0;
+	}
 
-				if (MAX(peak.right, peak.left) > Math::db_to_linear(channel_disable_threshold_db)) {
-					bus->channels.write[k].last_mix_with_audio = mix_frames;
-				} else if (mix_frames - bus->channels[k].last_mix_with_audio > channel_disable_frames) {
-					bus->channels.write[k].active = false;
-					continue; //went inactive, don't mix.
-				}
+	// Keep the highest ranked voices until the global limit, or the limit of one of their buses, is reached.
+	int real_voices = 0;
+	for (const VoiceRank &rank : voice_ranks) {
+		bool virtualize = (virtualize_inaudible_voices && rank.volume < inaudible_volume_linear) || (max_voices > 0 && real_voices >= max_voices);
+		for (int idx = 0; idx < MAX_BUSES_PER_PLAYBACK && !virtualize; idx++) {
+			if (rank.bus_details->bus_active[idx]) {
+				const Bus *bus = buses[thread_find_bus_index(rank.bus_details->bus[idx])];
+				virtualize = bus->max_voices > 0 && bus_voice_counts[bus->index_cache] >= bus->max_voices;
 			}
+		}
 
-			if (send) {
-				// If not master bus, send.
-				AudioFrame *target_buf = thread_get_channel_mix_buffer(send->index_cache, k);
+		rank.playback->should_be_virtual = virtualize;
+		if (virtualize) {
+			has_virtual_voices = true;
+			continue;
+		}
 
-				for (uint32_t j = 0; j < buffer_size; j++) {
-					target_buf[j] += buf[j];
-				}
+		real_voices++;
+		for (int idx = 0; idx < MAX_BUSES_PER_PLAYBACK; idx++) {
+			if (rank.bus_details->bus_active[idx]) {
+				bus_voice_counts[thread_find_bus_index(rank.bus_details->bus[idx])]++;
 			}
 		}
 	}
+}
 
-	mix_frames += buffer_size;
-	to_mix = buffer_size;
+void AudioServer::_mix_virtual_voice(AudioStreamPlaybackListNode *p_playback) {
+	// Virtual voices are already silent, so they can stop or pause right away.
+	switch (p_playback->state.load()) {
+		case AudioStreamPlaybackListNode::AWAITING_DELETION:
+		case AudioStreamPlaybackListNode::FADE_OUT_TO_DELETION:
+			_delete_stream_playback_list_node(p_playback);
+			return;
+		case AudioStreamPlaybackListNode::FADE_OUT_TO_PAUSE:
+			p_playback->state.store(AudioStreamPlaybackListNode::PAUSED);
+			return;
+		case AudioStreamPlaybackListNode::PAUSED:
+			return;
+		case AudioStreamPlaybackListNode::PLAYING:
+			break;
+	}
+
+	bool ended = false;
+	double position = p_playback->virtual_position.get();
+	if (Math::is_nan(position)) {
+		// The stream can't tell where it would be without decoding, so it's still decoded, but not mixed.
+		ended = p_playback->stream_playback->mix(&mix_buffer.ptrw()[LOOKAHEAD_BUFFER_SIZE], p_playback->pitch_scale.get(), buffer_size) != (int)buffer_size;
+	} else {
+		double time = buffer_size * p_playback->pitch_scale.get() * playback_speed_scale / get_mix_rate();
+		position = p_playback->stream_playback->get_position_after(position, time);
+		p_playback->virtual_position.set(position);
+		ended = position < 0.0;
+	}
+
+	if (tag_used_audio_streams && p_playback->stream_playback->is_playing()) {
+		p_playback->stream_playback->tag_used_streams();
+	}
+
+	if (ended) {
+		p_playback->state.store(AudioStreamPlaybackListNode::AWAITING_DELETION);
+		_delete_stream_playback_list_node(p_playback);
+	}
 }
 
 void AudioServer::_mix_step_for_channel(AudioFrame *p_out_buf, AudioFrame *p_source_buf, AudioFrame p_vol_start, AudioFrame p_vol_final, float p_attenuation_filter_cutoff_hz, float p_highshelf_gain, AudioFilterSW::Processor *p_processor_l, AudioFilterSW::Processor *p_processor_r) {
@@ -683,22 +887,16 @@ void AudioServer::_mix_step_for_channel(AudioFrame *p_out_buf, AudioFrame *p_sou
 		p_processor_r->set_filter(&filter, /* clear_history= */ is_just_started);
 		p_processor_r->update_coeffs(buffer_size);
 
-		for (unsigned int frame_idx = 0; frame_idx < buffer_size; frame_idx++) {
-			// TODO: Make lerp speed buffer-size-invariant if buffer_size ever becomes a project setting to avoid very small buffer sizes causing pops due to too-fast lerps.
-			float lerp_param = (float)frame_idx / buffer_size;
-			AudioFrame vol = p_vol_final * lerp_param + (1 - lerp_param) * p_vol_start;
-			AudioFrame mixed = vol * p_source_buf[frame_idx];
-			p_processor_l->process_one_interp(mixed.left);
-			p_processor_r->process_one_interp(mixed.right);
-			p_out_buf[frame_idx] += mixed;
-		}
+		// TODO: Make lerp speed buffer-size-invariant if buffer_size ever becomes a project setting to avoid very small buffer sizes causing pops due to too-fast lerps.
+		// Apply the volume ramp, filter both channels at once, then mix.
+		AudioFrame *filtered = filter_buffer.ptrw();
+		AudioMixKernels::scale_ramp(filtered, p_source_buf, p_vol_start, p_vol_final, buffer_size);
+		AudioFilterSW::Processor::process_stereo(p_processor_l, p_processor_r, filtered, buffer_size, true);
+		AudioMixKernels::accumulate(p_out_buf, filtered, buffer_size);
 
 	} else {
-		for (unsigned int frame_idx = 0; frame_idx < buffer_size; frame_idx++) {
-			// TODO: Make lerp speed buffer-size-invariant if buffer_size ever becomes a project setting to avoid very small buffer sizes causing pops due to too-fast lerps.
-			float lerp_param = (float)frame_idx / buffer_size;
-			p_out_buf[frame_idx] += (p_vol_final * lerp_param + (1 - lerp_param) * p_vol_start) * p_source_buf[frame_idx];
-		}
+		// TODO: Make lerp speed buffer-size-invariant if buffer_size ever becomes a project setting to avoid very small buffer sizes causing pops due to too-fast lerps.
+		AudioMixKernels::mix_ramp(p_out_buf, p_source_buf, p_vol_start, p_vol_final, buffer_size);
 	}
 }
 
@@ -821,11 +1019,13 @@ void AudioServer::set_bus_count(int p_count) {
 		buses.write[i]->channels.resize(channel_count);
 		for (int j = 0; j < channel_count; j++) {
 			buses.write[i]->channels.write[j].buffer.resize(buffer_size);
+			buses.write[i]->channels.write[j].effect_buffer.resize(buffer_size);
 		}
 		buses[i]->name = attempt;
 		buses[i]->solo = false;
 		buses[i]->mute = false;
 		buses[i]->bypass = false;
+		buses[i]->max_voices = 0;
 		buses[i]->volume_db = 0;
 		if (i > 0) {
 			buses[i]->send = SceneStringName(Master);
@@ -894,11 +1094,13 @@ void AudioServer::add_bus(int p_at_pos) {
 	bus->channels.resize(channel_count);
 	for (int j = 0; j < channel_count; j++) {
 		bus->channels.write[j].buffer.resize(buffer_size);
+		bus->channels.write[j].effect_buffer.resize(buffer_size);
 	}
 	bus->name = attempt;
 	bus->solo = false;
 	bus->mute = false;
 	bus->bypass = false;
+	bus->max_voices = 0;
 	bus->volume_db = 0;
 
 	bus_map[attempt] = bus;
@@ -1091,6 +1293,21 @@ bool AudioServer::is_bus_bypassing_effects(int p_bus) const {
 	return buses[p_bus]->bypass;
 }
 
+void AudioServer::set_bus_max_voices(int p_bus, int p_max_voices) {
+	ERR_FAIL_INDEX(p_bus, buses.size());
+	ERR_FAIL_COND(p_max_voices < 0);
+
+	MARK_EDITED
+
+	buses[p_bus]->max_voices = p_max_voices;
+}
+
+int AudioServer::get_bus_max_voices(int p_bus) const {
+	ERR_FAIL_INDEX_V(p_bus, buses.size(), 0);
+
+	return buses[p_bus]->max_voices;
+}
+
 void AudioServer::_update_bus_effects(int p_bus) {
 	for (int i = 0; i < buses[p_bus]->channels.size(); i++) {
 		buses.write[p_bus]->channels.write[i].effect_instances.resize(buses[p_bus]->effects.size());
@@ -1224,16 +1441,16 @@ float AudioServer::get_playback_speed_scale() const {
 	return playback_speed_scale;
 }
 
-void AudioServer::start_playback_stream(Ref<AudioStreamPlayback> p_playback, const StringName &p_bus, Vector<AudioFrame> p_volume_db_vector, float p_start_time, float p_pitch_scale) {
+void AudioServer::start_playback_stream(Ref<AudioStreamPlayback> p_playback, const StringName &p_bus, Vector<AudioFrame> p_volume_db_vector, float p_start_time, float p_pitch_scale, int p_priority) {
 	ERR_FAIL_COND(p_playback.is_null());
 
 	HashMap<StringName, Vector<AudioFrame>> map;
 	map[p_bus] = p_volume_db_vector;
 
-	start_playback_stream(p_playback, map, p_start_time, p_pitch_scale);
+	start_playback_stream(p_playback, map, p_start_time, p_pitch_scale, 0, 0, p_priority);
 }
 
-void AudioServer::start_playback_stream(Ref<AudioStreamPlayback> p_playback, const HashMap<StringName, Vector<AudioFrame>> &p_bus_volumes, float p_start_time, float p_pitch_scale, float p_highshelf_gain, float p_attenuation_cutoff_hz) {
+void AudioServer::start_playback_stream(Ref<AudioStreamPlayback> p_playback, const HashMap<StringName, Vector<AudioFrame>> &p_bus_volumes, float p_start_time, float p_pitch_scale, float p_highshelf_gain, float p_attenuation_cutoff_hz, int p_priority) {
 	ERR_FAIL_COND(p_playback.is_null());
 
 	AudioStreamPlaybackListNode *playback_node = new AudioStreamPlaybackListNode();
@@ -1262,6 +1479,7 @@ void AudioServer::start_playback_stream(Ref<AudioStreamPlayback> p_playback, con
 	playback_node->pitch_scale.set(p_pitch_scale);
 	playback_node->highshelf_gain.set(p_highshelf_gain);
 	playback_node->attenuation_filter_cutoff_hz.set(p_attenuation_cutoff_hz);
+	playback_node->priority.set(p_priority);
 
 	memset(playback_node->prev_bus_details->volume, 0, sizeof(playback_node->prev_bus_details->volume));
 
@@ -1428,6 +1646,17 @@ void AudioServer::set_playback_highshelf_params(Ref<AudioStreamPlayback> p_playb
 	playback_node->highshelf_gain.set(p_gain);
 }
 
+void AudioServer::set_playback_priority(Ref<AudioStreamPlayback> p_playback, int p_priority) {
+	ERR_FAIL_COND(p_playback.is_null());
+
+	AudioStreamPlaybackListNode *playback_node = _find_playback_list_node(p_playback);
+	if (!playback_node) {
+		return;
+	}
+
+	playback_node->priority.set(p_priority);
+}
+
 bool AudioServer::is_playback_active(Ref<AudioStreamPlayback> p_playback) {
 	ERR_FAIL_COND_V(p_playback.is_null(), false);
 
@@ -1461,6 +1690,14 @@ float AudioServer::get_playback_position(Ref<AudioStreamPlayback> p_playback) {
 		return 0;
 	}
 
+	// Virtual voices aren't decoded, so the stream playback doesn't know where they are.
+	if (playback_node->is_virtual.is_set()) {
+		double position = playback_node->virtual_position.get();
+		if (position >= 0.0) {
+			return position;
+		}
+	}
+
 	return playback_node->stream_playback->get_playback_position();
 }
 
@@ -1495,17 +1732,14 @@ void AudioServer::notify_listener_changed() {
 
 void AudioServer::init_channels_and_buffers() {
 	channel_count = get_channel_count();
-	temp_buffer.resize(channel_count);
 	mix_buffer.resize(buffer_size + LOOKAHEAD_BUFFER_SIZE);
-
-	for (int i = 0; i < temp_buffer.size(); i++) {
-		temp_buffer.write[i].resize(buffer_size);
-	}
+	filter_buffer.resize(buffer_size);
 
 	for (int i = 0; i < buses.size(); i++) {
 		buses[i]->channels.resize(channel_count);
 		for (int j = 0; j < channel_count; j++) {
 			buses.write[i]->channels.write[j].buffer.resize(buffer_size);
+			buses.write[i]->channels.write[j].effect_buffer.resize(buffer_size);
 		}
 		_update_bus_effects(i);
 	}
@@ -1518,6 +1752,11 @@ void AudioServer::init() {
 	// When this becomes a project setting, it should be specified in milliseconds rather than raw sample count, because 512 samples at 192khz is shorter than it is at 48khz, for example.
 	buffer_size = 512;
 
+	max_voices = GLOBAL_DEF_RST(PropertyInfo(Variant::INT, "audio/voices/max_voices", PROPERTY_HINT_RANGE, "0,1024,1,or_greater"), 0);
+	virtualize_inaudible_voices = GLOBAL_DEF_RST("audio/voices/virtualize_inaudible_voices", false);
+	inaudible_volume_linear = Math::db_to_linear(float(GLOBAL_DEF_RST(PropertyInfo(Variant::FLOAT, "audio/voices/inaudible_threshold_db", PROPERTY_HINT_RANGE, "-80,0,0.1,suffix:dB"), -60.0)));
+
+	AudioMixKernels::init();
 	init_channels_and_buffers();
 
 	mix_count = 0;
@@ -1534,6 +1773,23 @@ void AudioServer::init() {
 #endif
 
 	GLOBAL_DEF_RST(PropertyInfo(Variant::INT, "audio/video/video_delay_compensation_ms", PROPERTY_HINT_RANGE, "-1000,1000,1,suffix:ms"), 0);
+
+	GLOBAL_DEF_RST(PropertyInfo(Variant::INT, "audio/buses/parallel_effects_threads", PROPERTY_HINT_RANGE, "0,16,1"), 0);
+#ifdef THREADS_ENABLED
+	int bus_effects_threads = GLOBAL_GET("audio/buses/parallel_effects_threads");
+	if (bus_effects_threads > 0) {
+		bus_effects_pool = memnew(WorkerThreadPool(false));
+		bus_effects_pool->init(bus_effects_threads);
+	}
+#endif
+
+	GLOBAL_DEF_RST(PropertyInfo(Variant::INT, "audio/general/decode_ahead_ms", PROPERTY_HINT_RANGE, "0,1000,1,suffix:ms"), 0);
+#ifdef THREADS_ENABLED
+	int decode_ahead_ms = GLOBAL_GET("audio/general/decode_ahead_ms");
+	if (decode_ahead_ms > 0) {
+		decode_ahead = memnew(AudioStreamDecodeAhead(decode_ahead_ms));
+	}
+#endif
 }
 
 void AudioServer::update() {
@@ -1638,6 +1894,16 @@ void AudioServer::finish() {
 		AudioDriverManager::get_driver(i)->finish();
 	}
 
+	if (bus_effects_pool) {
+		memdelete(bus_effects_pool);
+		bus_effects_pool = nullptr;
+	}
+
+	if (decode_ahead) {
+		memdelete(decode_ahead);
+		decode_ahead = nullptr;
+	}
+
 	for (int i = 0; i < buses.size(); i++) {
 		memdelete(buses[i]);
 	}
@@ -1759,6 +2025,7 @@ void AudioServer::set_bus_layout(const Ref<AudioBusLayout> &p_bus_layout) {
 		bus->solo = p_bus_layout->buses[i].solo;
 		bus->mute = p_bus_layout->buses[i].mute;
 		bus->bypass = p_bus_layout->buses[i].bypass;
+		bus->max_voices = p_bus_layout->buses[i].max_voices;
 		bus->volume_db = p_bus_layout->buses[i].volume_db;
 
 		AudioDriver::get_singleton()->set_sample_bus_solo(i, bus->solo);
@@ -1785,6 +2052,7 @@ void AudioServer::set_bus_layout(const Ref<AudioBusLayout> &p_bus_layout) {
 		buses[i]->channels.resize(channel_count);
 		for (int j = 0; j < channel_count; j++) {
 			buses.write[i]->channels.write[j].buffer.resize(buffer_size);
+			buses.write[i]->channels.write[j].effect_buffer.resize(buffer_size);
 		}
 		_update_bus_effects(i);
 	}
@@ -1808,6 +2076,7 @@ Ref<AudioBusLayout> AudioServer::generate_bus_layout() const {
 		state->buses.write[i].mute = buses[i]->mute;
 		state->buses.write[i].solo = buses[i]->solo;
 		state->buses.write[i].bypass = buses[i]->bypass;
+		state->buses.write[i].max_voices = buses[i]->max_voices;
 		state->buses.write[i].volume_db = buses[i]->volume_db;
 		for (int j = 0; j < buses[i]->effects.size(); j++) {
 			AudioBusLayout::Bus::Effect fx;
@@ -1980,6 +2249,9 @@ void AudioServer::_bind_methods() {
 	ClassDB::bind_method(D_METHOD("set_bus_bypass_effects", "bus_idx", "enable"), &AudioServer::set_bus_bypass_effects);
 	ClassDB::bind_method(D_METHOD("is_bus_bypassing_effects", "bus_idx"), &AudioServer::is_bus_bypassing_effects);
 
+	ClassDB::bind_method(D_METHOD("set_bus_max_voices", "bus_idx", "max_voices"), &AudioServer::set_bus_max_voices);
+	ClassDB::bind_method(D_METHOD("get_bus_max_voices", "bus_idx"), &AudioServer::get_bus_max_voices);
+
 	ClassDB::bind_method(D_METHOD("add_bus_effect", "bus_idx", "effect", "at_position"), &AudioServer::add_bus_effect, DEFVAL(-1));
 	ClassDB::bind_method(D_METHOD("remove_bus_effect", "bus_idx", "effect_idx"), &AudioServer::remove_bus_effect);
 
@@ -2078,6 +2350,8 @@ bool AudioBusLayout::_set(const StringName &p_name, const Variant &p_value) {
 			bus.mute = p_value;
 		} else if (what == "bypass_fx") {
 			bus.bypass = p_value;
+		} else if (what == "max_voices") {
+			bus.max_voices = p_value;
 		} else if (what == "volume_db") {
 			bus.volume_db = p_value;
 		} else if (what == "send") {
@@ -2130,6 +2404,8 @@ bool AudioBusLayout::_get(const StringName &p_name, Variant &r_ret) const {
 			r_ret = bus.mute;
 		} else if (what == "bypass_fx") {
 			r_ret = bus.bypass;
+		} else if (what == "max_voices") {
+			r_ret = bus.max_voices;
 		} else if (what == "volume_db") {
 			r_ret = bus.volume_db;
 		} else if (what == "send") {
@@ -2168,6 +2444,7 @@ void AudioBusLayout::_get_property_list(List<PropertyInfo> *p_list) const {
 		p_list->push_back(PropertyInfo(Variant::BOOL, "bus/" + itos(i) + "/solo", PROPERTY_HINT_NONE, "", PROPERTY_USAGE_NO_EDITOR | PROPERTY_USAGE_INTERNAL));
 		p_list->push_back(PropertyInfo(Variant::BOOL, "bus/" + itos(i) + "/mute", PROPERTY_HINT_NONE, "", PROPERTY_USAGE_NO_EDITOR | PROPERTY_USAGE_INTERNAL));
 		p_list->push_back(PropertyInfo(Variant::BOOL, "bus/" + itos(i) + "/bypass_fx", PROPERTY_HINT_NONE, "", PROPERTY_USAGE_NO_EDITOR | PROPERTY_USAGE_INTERNAL));
+		p_list->push_back(PropertyInfo(Variant::INT, "bus/" + itos(i) + "/max_voices", PROPERTY_HINT_NONE, "", PROPERTY_USAGE_NO_EDITOR | PROPERTY_USAGE_INTERNAL));
 		p_list->push_back(PropertyInfo(Variant::FLOAT, "bus/" + itos(i) + "/volume_db", PROPERTY_HINT_NONE, "", PROPERTY_USAGE_NO_EDITOR | PROPERTY_USAGE_INTERNAL));
 		p_list->push_back(PropertyInfo(Variant::FLOAT, "bus/" + itos(i) + "/send", PROPERTY_HINT_NONE, "", PROPERTY_USAGE_NO_EDITOR | PROPERTY_USAGE_INTERNAL));
 
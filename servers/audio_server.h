@@ -32,6 +32,7 @@
 
 #include "core/math/audio_frame.h"
 #include "core/object/class_db.h"
+#include "core/object/worker_thread_pool.h"
 #include "core/os/os.h"
 #include "core/templates/safe_list.h"
 #include "core/variant/variant.h"
@@ -45,6 +46,7 @@ class AudioSample;
 class AudioStream;
 class AudioStreamWAV;
 class AudioStreamPlayback;
+class AudioStreamDecodeAhead;
 class AudioSamplePlayback;
 
 class AudioDriver {
@@ -181,6 +183,7 @@ class AudioBusLayout;
 
 class AudioServer : public Object {
 	GDCLASS(AudioServer, Object);
+	friend class TestAudioServerInternalsAccessor;
 
 public:
 	//re-expose this here, as AudioDriver is not exposed to script
@@ -237,6 +240,7 @@ private:
 		bool solo = false;
 		bool mute = false;
 		bool bypass = false;
+		int max_voices = 0; // Zero means no limit.
 
 		bool soloed = false;
 
@@ -246,6 +250,7 @@ private:
 			bool active = false;
 			AudioFrame peak_volume = AudioFrame(AUDIO_MIN_PEAK_DB, AUDIO_MIN_PEAK_DB);
 			Vector<AudioFrame> buffer;
+			Vector<AudioFrame> effect_buffer; // Effects write here, then it's swapped with `buffer`.
 			Vector<Ref<AudioEffectInstance>> effect_instances;
 			uint64_t last_mix_with_audio = 0;
 			Channel() {}
@@ -305,6 +310,14 @@ private:
 		AudioStreamPlaybackBusDetails *prev_bus_details = nullptr;
 		// The next few samples are stored here so we have some time to fade audio out if it ends abruptly at the beginning of the next mix.
 		AudioFrame lookahead[LOOKAHEAD_BUFFER_SIZE];
+		// When voice limits are reached, voices with a higher priority keep being mixed first.
+		SafeNumeric<int> priority;
+		// Decided by `_update_virtual_voices()` for the current mix step. Should only be accessed on the audio thread.
+		bool should_be_virtual = false;
+		// Virtual voices are not mixed, and not decoded either unless the stream can't tell where they would be without it.
+		SafeFlag is_virtual;
+		// Where a virtual voice would be in the stream, or NaN if the stream can't tell.
+		SafeNumeric<double> virtual_position;
 	};
 
 	SafeList<AudioStreamPlaybackListNode *> playback_list;
@@ -315,8 +328,8 @@ private:
 	// TODO document if this is necessary.
 	SafeList<AudioStreamPlaybackBusDetails *> bus_details_graveyard_frame_old;
 
-	Vector<Vector<AudioFrame>> temp_buffer; //temp_buffer for each level
 	Vector<AudioFrame> mix_buffer;
+	Vector<AudioFrame> filter_buffer; // Scratch buffer for the attenuation filter in `_mix_step_for_channel`.
 	Vector<Bus *> buses;
 	HashMap<StringName, Bus *> bus_map;
 
@@ -326,6 +339,47 @@ private:
 
 	void init_channels_and_buffers();
 
+	// Dedicated pool for processing the effects of buses that don't send to each other in parallel,
+	// enabled with `audio/buses/parallel_effects_threads`.
+	WorkerThreadPool *bus_effects_pool = nullptr;
+	LocalVector<uint32_t> bus_depths;
+	LocalVector<Bus *> bus_batch;
+	bool bus_batch_solo_mode = false;
+
+	// Decodes compressed streams ahead of the audio thread, enabled with `audio/general/decode_ahead_ms`.
+	AudioStreamDecodeAhead *decode_ahead = nullptr;
+
+	// Voice limits, see `_update_virtual_voices()`.
+	struct VoiceRank {
+		AudioStreamPlaybackListNode *playback = nullptr;
+		const AudioStreamPlaybackBusDetails *bus_details = nullptr;
+		int priority = 0;
+		float volume = 0.0f;
+	};
+
+	struct VoiceRankComparator {
+		_FORCE_INLINE_ bool operator()(const VoiceRank &p_a, const VoiceRank &p_b) const {
+			return p_a.priority != p_b.priority ? p_a.priority > p_b.priority : p_a.volume > p_b.volume;
+		}
+	};
+
+	int max_voices = 0;
+	bool virtualize_inaudible_voices = false;
+	float inaudible_volume_linear = 0.0f;
+	bool has_virtual_voices = false;
+	LocalVector<VoiceRank> voice_ranks;
+	LocalVector<int> bus_voice_counts;
+
+	void _update_virtual_voices();
+	void _mix_virtual_voice(AudioStreamPlaybackListNode *p_playback);
+
+	Bus *_get_bus_send(int p_bus);
+	void _process_bus(Bus *p_bus, bool p_solo_mode);
+	void _send_bus(int p_bus);
+	void _process_buses_serial(bool p_solo_mode);
+	static void _process_bus_batch_task(void *p_audio_server, uint32_t p_index);
+	void _process_buses_parallel(bool p_solo_mode);
+
 	void _mix_step();
 	void _mix_step_for_channel(AudioFrame *p_out_buf, AudioFrame *p_source_buf, AudioFrame p_vol_start, AudioFrame p_vol_final, float p_attenuation_filter_cutoff_hz, float p_highshelf_gain, AudioFilterSW::Processor *p_processor_l, AudioFilterSW::Processor *p_processor_r);
 
@@ -407,6 +461,9 @@ public:
 	void set_bus_bypass_effects(int p_bus, bool p_enable);
 	bool is_bus_bypassing_effects(int p_bus) const;
 
+	void set_bus_max_voices(int p_bus, int p_max_voices);
+	int get_bus_max_voices(int p_bus) const;
+
 	void add_bus_effect(int p_bus, const Ref<AudioEffect> &p_effect, int p_at_pos = -1);
 	void remove_bus_effect(int p_bus, int p_effect);
 
@@ -428,9 +485,9 @@ public:
 	float get_playback_speed_scale() const;
 
 	// Convenience method.
-	void start_playback_stream(Ref<AudioStreamPlayback> p_playback, const StringName &p_bus, Vector<AudioFrame> p_volume_db_vector, float p_start_time = 0, float p_pitch_scale = 1);
+	void start_playback_stream(Ref<AudioStreamPlayback> p_playback, const StringName &p_bus, Vector<AudioFrame> p_volume_db_vector, float p_start_time = 0, float p_pitch_scale = 1, int p_priority = 0);
 	// Expose all parameters.
-	void start_playback_stream(Ref<AudioStreamPlayback> p_playback, const HashMap<StringName, Vector<AudioFrame>> &p_bus_volumes, float p_start_time = 0, float p_pitch_scale = 1, float p_highshelf_gain = 0, float p_attenuation_cutoff_hz = 0);
+	void start_playback_stream(Ref<AudioStreamPlayback> p_playback, const HashMap<StringName, Vector<AudioFrame>> &p_bus_volumes, float p_start_time = 0, float p_pitch_scale = 1, float p_highshelf_gain = 0, float p_attenuation_cutoff_hz = 0, int p_priority = 0);
 	void stop_playback_stream(Ref<AudioStreamPlayback> p_playback);
 
 	void set_playback_bus_exclusive(Ref<AudioStreamPlayback> p_playback, const StringName &p_bus, Vector<AudioFrame> p_volumes);
@@ -439,6 +496,7 @@ public:
 	void set_playback_pitch_scale(Ref<AudioStreamPlayback> p_playback, float p_pitch_scale);
 	void set_playback_paused(Ref<AudioStreamPlayback> p_playback, bool p_paused);
 	void set_playback_highshelf_params(Ref<AudioStreamPlayback> p_playback, float p_gain, float p_attenuation_cutoff_hz);
+	void set_playback_priority(Ref<AudioStreamPlayback> p_playback, int p_priority);
 
 	bool is_playback_active(Ref<AudioStreamPlayback> p_playback);
 	float get_playback_position(Ref<AudioStreamPlayback> p_playback);
@@ -530,6 +588,7 @@ class AudioBusLayout : public Resource {
 		bool solo = false;
 		bool mute = false;
 		bool bypass = false;
+		int max_voices = 0;
 
 		struct Effect {
 			Ref<AudioEffect> effect;
@@ -175,6 +175,10 @@ void TextServerExtension::_bind_methods() {
 	GDVIRTUAL_BIND(_font_clear_glyphs, "font_rid", "size");
 	GDVIRTUAL_BIND(_font_remove_glyph, "font_rid", "size", "glyph");
 
+	GDVIRTUAL_BIND(_font_has_glyph_cache_data, "font_rid", "size");
+	GDVIRTUAL_BIND(_font_get_glyph_cache_data, "font_rid", "size");
+	GDVIRTUAL_BIND(_font_set_glyph_cache_data, "font_rid", "size", "data");
+
 	GDVIRTUAL_BIND(_font_get_glyph_advance, "font_rid", "size", "glyph");
 	GDVIRTUAL_BIND(_font_set_glyph_advance, "font_rid", "size", "glyph", "advance");
 
@@ -211,6 +215,7 @@ void TextServerExtension::_bind_methods() {
 
 	GDVIRTUAL_BIND(_font_render_range, "font_rid", "size", "start", "end");
 	GDVIRTUAL_BIND(_font_render_glyph, "font_rid", "size", "index");
+	GDVIRTUAL_BIND(_font_render_glyphs, "font_rid", "size", "glyphs");
 
 	GDVIRTUAL_BIND(_font_draw_glyph, "font_rid", "canvas", "size", "pos", "index", "color", "oversampling");
 	GDVIRTUAL_BIND(_font_draw_glyph_outline, "font_rid", "canvas", "size", "outline_size", "pos", "index", "color", "oversampling");
@@ -884,6 +889,22 @@ void TextServerExtension::font_remove_glyph(const RID &p_font_rid, const Vector2
 	GDVIRTUAL_CALL(_font_remove_glyph, p_font_rid, p_size, p_glyph);
 }
 
+bool TextServerExtension::font_has_glyph_cache_data(const RID &p_font_rid, const Vector2i &p_size) const {
+	bool ret = false;
+	GDVIRTUAL_CALL(_font_has_glyph_cache_data, p_font_rid, p_size, ret);
+	return ret;
+}
+
+PackedByteArray TextServerExtension::font_get_glyph_cache_data(const RID &p_font_rid, const Vector2i &p_size) const {
+	PackedByteArray ret;
+	GDVIRTUAL_CALL(_font_get_glyph_cache_data, p_font_rid, p_size, ret);
+	return ret;
+}
+
+void TextServerExtension::font_set_glyph_cache_data(const RID &p_font_rid, const Vector2i &p_size, const PackedByteArray &p_data) {
+	GDVIRTUAL_CALL(_font_set_glyph_cache_data, p_font_rid, p_size, p_data);
+}
+
 Vector2 TextServerExtension::font_get_glyph_advance(const RID &p_font_rid, int64_t p_size, int64_t p_glyph) const {
 	Vector2 ret;
 	GDVIRTUAL_CALL(_font_get_glyph_advance, p_font_rid, p_size, p_glyph, ret);
@@ -1014,6 +1035,15 @@ void TextServerExtension::font_render_glyph(const RID &p_font_rid, const Vector2
 	GDVIRTUAL_CALL(_font_render_glyph, p_font_rid, p_size, p_index);
 }
 
+void TextServerExtension::font_render_glyphs(const RID &p_font_rid, const Vector2i &p_size, const PackedInt32Array &p_glyphs) {
+	if (GDVIRTUAL_CALL(_font_render_glyphs, p_font_rid, p_size, p_glyphs)) {
+		return;
+	}
+	for (int32_t glyph : p_glyphs) {
+		font_render_glyph(p_font_rid, p_size, glyph);
+	}
+}
+
 void TextServerExtension::font_draw_glyph(const RID &p_font_rid, const RID &p_canvas, int64_t p_size, const Vector2 &p_pos, int64_t p_index, const Color &p_color, float p_oversampling) const {
 	GDVIRTUAL_CALL(_font_draw_glyph, p_font_rid, p_canvas, p_size, p_pos, p_index, p_color, p_oversampling);
 #ifndef DISABLE_DEPRECATED
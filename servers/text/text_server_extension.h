@@ -286,6 +286,13 @@ public:
 	GDVIRTUAL2_REQUIRED(_font_clear_glyphs, RID, const Vector2i &);
 	GDVIRTUAL3_REQUIRED(_font_remove_glyph, RID, const Vector2i &, int64_t);
 
+	virtual bool font_has_glyph_cache_data(const RID &p_font_rid, const Vector2i &p_size) const override;
+	virtual PackedByteArray font_get_glyph_cache_data(const RID &p_font_rid, const Vector2i &p_size) const override;
+	virtual void font_set_glyph_cache_data(const RID &p_font_rid, const Vector2i &p_size, const PackedByteArray &p_data) override;
+	GDVIRTUAL2RC(bool, _font_has_glyph_cache_data, RID, const Vector2i &);
+	GDVIRTUAL2RC(PackedByteArray, _font_get_glyph_cache_data, RID, const Vector2i &);
+	GDVIRTUAL3(_font_set_glyph_cache_data, RID, const Vector2i &, const PackedByteArray &);
+
 	virtual Vector2 font_get_glyph_advance(const RID &p_font_rid, int64_t p_size, int64_t p_glyph) const override;
 	virtual void font_set_glyph_advance(const RID &p_font_rid, int64_t p_size, int64_t p_glyph, const Vector2 &p_advance) override;
 	GDVIRTUAL3RC_REQUIRED(Vector2, _font_get_glyph_advance, RID, int64_t, int64_t);
@@ -347,8 +354,10 @@ public:
 
 	virtual void font_render_range(const RID &p_font, const Vector2i &p_size, int64_t p_start, int64_t p_end) override;
 	virtual void font_render_glyph(const RID &p_font_rid, const Vector2i &p_size, int64_t p_index) override;
+	virtual void font_render_glyphs(const RID &p_font_rid, const Vector2i &p_size, const PackedInt32Array &p_glyphs) override;
 	GDVIRTUAL4(_font_render_range, RID, const Vector2i &, int64_t, int64_t);
 	GDVIRTUAL3(_font_render_glyph, RID, const Vector2i &, int64_t);
+	GDVIRTUAL3(_font_render_glyphs, RID, const Vector2i &, const PackedInt32Array &);
 
 	virtual void font_draw_glyph(const RID &p_font, const RID &p_canvas, int64_t p_size, const Vector2 &p_pos, int64_t p_index, const Color &p_color = Color(1, 1, 1), float p_oversampling = 0.0) const override;
 	virtual void font_draw_glyph_outline(const RID &p_font, const RID &p_canvas, int64_t p_size, int64_t p_outline_size, const Vector2 &p_pos, int64_t p_index, const Color &p_color = Color(1, 1, 1), float p_oversampling = 0.0) const override;
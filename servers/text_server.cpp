@@ -331,6 +331,10 @@ void TextServer::_bind_methods() {
 	ClassDB::bind_method(D_METHOD("font_clear_glyphs", "font_rid", "size"), &TextServer::font_clear_glyphs);
 	ClassDB::bind_method(D_METHOD("font_remove_glyph", "font_rid", "size", "glyph"), &TextServer::font_remove_glyph);
 
+	ClassDB::bind_method(D_METHOD("font_has_glyph_cache_data", "font_rid", "size"), &TextServer::font_has_glyph_cache_data);
+	ClassDB::bind_method(D_METHOD("font_get_glyph_cache_data", "font_rid", "size"), &TextServer::font_get_glyph_cache_data);
+	ClassDB::bind_method(D_METHOD("font_set_glyph_cache_data", "font_rid", "size", "data"), &TextServer::font_set_glyph_cache_data);
+
 	ClassDB::bind_method(D_METHOD("font_get_glyph_advance", "font_rid", "size", "glyph"), &TextServer::font_get_glyph_advance);
 	ClassDB::bind_method(D_METHOD("font_set_glyph_advance", "font_rid", "size", "glyph", "advance"), &TextServer::font_set_glyph_advance);
 
@@ -367,6 +371,7 @@ void TextServer::_bind_methods() {
 
 	ClassDB::bind_method(D_METHOD("font_render_range", "font_rid", "size", "start", "end"), &TextServer::font_render_range);
 	ClassDB::bind_method(D_METHOD("font_render_glyph", "font_rid", "size", "index"), &TextServer::font_render_glyph);
+	ClassDB::bind_method(D_METHOD("font_render_glyphs", "font_rid", "size", "glyphs"), &TextServer::font_render_glyphs);
 
 	ClassDB::bind_method(D_METHOD("font_draw_glyph", "font_rid", "canvas", "size", "pos", "index", "color", "oversampling"), &TextServer::font_draw_glyph, DEFVAL(Color(1, 1, 1)), DEFVAL(0.0));
 	ClassDB::bind_method(D_METHOD("font_draw_glyph_outline", "font_rid", "canvas", "size", "outline_size", "pos", "index", "color", "oversampling"), &TextServer::font_draw_glyph_outline, DEFVAL(Color(1, 1, 1)), DEFVAL(0.0));
@@ -391,6 +391,10 @@ public:
 	virtual void font_clear_glyphs(const RID &p_font_rid, const Vector2i &p_size) = 0;
 	virtual void font_remove_glyph(const RID &p_font_rid, const Vector2i &p_size, int64_t p_glyph) = 0;
 
+	virtual bool font_has_glyph_cache_data(const RID &p_font_rid, const Vector2i &p_size) const = 0;
+	virtual PackedByteArray font_get_glyph_cache_data(const RID &p_font_rid, const Vector2i &p_size) const = 0;
+	virtual void font_set_glyph_cache_data(const RID &p_font_rid, const Vector2i &p_size, const PackedByteArray &p_data) = 0;
+
 	virtual Vector2 font_get_glyph_advance(const RID &p_font_rid, int64_t p_size, int64_t p_glyph) const = 0;
 	virtual void font_set_glyph_advance(const RID &p_font_rid, int64_t p_size, int64_t p_glyph, const Vector2 &p_advance) = 0;
 
@@ -426,6 +430,7 @@ public:
 
 	virtual void font_render_range(const RID &p_font, const Vector2i &p_size, int64_t p_start, int64_t p_end) = 0;
 	virtual void font_render_glyph(const RID &p_font_rid, const Vector2i &p_size, int64_t p_index) = 0;
+	virtual void font_render_glyphs(const RID &p_font_rid, const Vector2i &p_size, const PackedInt32Array &p_glyphs) = 0;
 
 	virtual void font_draw_glyph(const RID &p_font, const RID &p_canvas, int64_t p_size, const Vector2 &p_pos, int64_t p_index, const Color &p_color = Color(1, 1, 1), float p_oversampling = 0.0) const = 0;
 	virtual void font_draw_glyph_outline(const RID &p_font, const RID &p_canvas, int64_t p_size, int64_t p_outline_size, const Vector2 &p_pos, int64_t p_index, const Color &p_color = Color(1, 1, 1), float p_oversampling = 0.0) const = 0;
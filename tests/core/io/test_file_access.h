@@ -220,4 +220,21 @@ TEST_CASE("[FileAccess] Get/Store floating point half precision values") {
 	}
 }
 
+TEST_CASE("[FileAccess] Read-only mapping") {
+	Ref<FileAccess> f = FileAccess::open(TestUtils::get_data_path("testdata.csv"), FileAccess::READ);
+	REQUIRE(f.is_valid());
+
+	const uint64_t length = f->get_length();
+	Vector<uint8_t> contents = f->get_buffer(length);
+	REQUIRE(contents.size() == (int64_t)length);
+
+	const uint8_t *mapped = f->map_read_only();
+	if (mapped) {
+		// Mapping is optional, but when supported it must expose the whole file.
+		CHECK(memcmp(mapped, contents.ptr(), length) == 0);
+		CHECK(f->map_read_only() == mapped);
+	}
+	f->close();
+}
+
 } // namespace TestFileAccess
@@ -116,4 +116,104 @@ TEST_CASE("[PCKPacker] Pack a PCK file with some files and directories") {
 			f->get_length() <= 27000,
 			"The generated non-empty PCK file shouldn't be too large.");
 }
+
+TEST_CASE("[PCKPacker] Read and prefetch files from a loaded PCK") {
+	PCKPacker pck_packer;
+	const String output_pck_path = TestUtils::get_temp_path("output_prefetch.pck");
+	const String source_path = OS::get_singleton()->get_executable_path().get_base_dir().path_join("../version.py");
+	REQUIRE(pck_packer.pck_start(output_pck_path) == OK);
+	REQUIRE(pck_packer.add_file("res://pck_prefetch_test/version.py", source_path) == OK);
+	REQUIRE(pck_packer.flush() == OK);
+
+	PackedData *pd = PackedData::get_singleton();
+	REQUIRE(pd != nullptr);
+	REQUIRE_FALSE(pd->has_path("res://pck_prefetch_test/version.py"));
+	REQUIRE(pd->add_pack(output_pck_path, false, 0) == OK);
+
+	const PackedData::PrefetchStatus before = pd->get_prefetch_status();
+	pd->prefetch({ "res://pck_prefetch_test/version.py", "res://pck_prefetch_test/missing.py" });
+
+	PackedData::PrefetchStatus status = pd->get_prefetch_status();
+	for (int i = 0; i < 1000 && status.pending > 0; i++) {
+		OS::get_singleton()->delay_usec(1000);
+		status = pd->get_prefetch_status();
+	}
+	CHECK_MESSAGE(status.pending == 0, "Prefetching should complete.");
+	CHECK_MESSAGE(status.completed == before.completed + 1, "Only files in the pack should be prefetched.");
+
+	Ref<FileAccess> packed = pd->try_open_path("res://pck_prefetch_test/version.py");
+	REQUIRE(packed.is_valid());
+	CHECK_MESSAGE(pd->get_prefetch_status().hits == before.hits + 1, "Opening a prefetched file should count as a hit.");
+
+	Vector<uint8_t> expected = FileAccess::get_file_as_bytes(source_path);
+	CHECK(packed->get_length() == (uint64_t)expected.size());
+	CHECK(packed->get_buffer(expected.size()) == expected);
+	CHECK(packed->get_position() == (uint64_t)expected.size());
+
+	packed->seek(0);
+	const uint8_t *view = packed->get_buffer_view(expected.size());
+	if (view) {
+		// Only available when the pack is memory-mapped.
+		CHECK(memcmp(view, expected.ptr(), expected.size()) == 0);
+	}
+
+	packed.unref();
+	pd->remove_pack(output_pck_path);
+	CHECK_FALSE(pd->has_path("res://pck_prefetch_test/version.py"));
+	CHECK_FALSE(pd->has_directory("res://pck_prefetch_test"));
+	CHECK(pd->get_prefetch_status().pending == 0);
+}
+
+TEST_CASE("[PCKPacker] Read files from a memory-mapped PCK") {
+	PCKPacker pck_packer;
+	const String output_pck_path = TestUtils::get_temp_path("output_mmap.pck");
+	const String source_path = OS::get_singleton()->get_executable_path().get_base_dir().path_join("../version.py");
+	REQUIRE(pck_packer.pck_start(output_pck_path) == OK);
+	REQUIRE(pck_packer.add_file("res://pck_mmap_test/version.py", source_path) == OK);
+	REQUIRE(pck_packer.flush() == OK);
+
+	PackedData *pd = PackedData::get_singleton();
+	REQUIRE(pd != nullptr);
+	const bool was_using_mmap = pd->is_using_mmap();
+	REQUIRE(pd->add_pack(output_pck_path, false, 0) == OK);
+
+	Vector<uint8_t> expected = FileAccess::get_file_as_bytes(source_path);
+	REQUIRE(!expected.is_empty());
+
+	pd->set_use_mmap(false);
+	Ref<FileAccess> packed = pd->try_open_path("res://pck_mmap_test/version.py");
+	REQUIRE(packed.is_valid());
+	CHECK_MESSAGE(packed->get_buffer_view(expected.size()) == nullptr, "Packs should only be mapped when enabled.");
+	CHECK(packed->get_buffer(expected.size()) == expected);
+	packed.unref();
+
+	pd->set_use_mmap(true);
+	Ref<FileAccess> mapped = pd->try_open_path("res://pck_mmap_test/version.py");
+	REQUIRE(mapped.is_valid());
+	const uint8_t *view = mapped->get_buffer_view(expected.size());
+	CHECK_MESSAGE(view != nullptr, "Unencrypted files should be read from the mapped pack.");
+	if (view) {
+		CHECK(memcmp(view, expected.ptr(), expected.size()) == 0);
+	}
+	mapped->seek(0);
+	CHECK(mapped->get_buffer(expected.size()) == expected);
+	mapped.unref();
+
+	// Truncating a mapped file is not allowed on every platform.
+	Ref<FileAccess> pck = FileAccess::open(output_pck_path, FileAccess::READ_WRITE);
+	REQUIRE(pck.is_valid());
+	if (pck->resize(pck->get_length() - expected.size() / 2) == OK) {
+		// The mapping now extends past the end of the file, reads must not touch it.
+		ERR_PRINT_OFF;
+		Ref<FileAccess> truncated = pd->try_open_path("res://pck_mmap_test/version.py");
+		ERR_PRINT_ON;
+		REQUIRE(truncated.is_valid());
+		CHECK_MESSAGE(truncated->get_buffer_view(1) == nullptr, "A truncated pack should fall back to regular reads.");
+	}
+	pck.unref();
+
+	pd->remove_pack(output_pck_path);
+	CHECK_FALSE(pd->has_path("res://pck_mmap_test/version.py"));
+	pd->set_use_mmap(was_using_mmap);
+}
 } // namespace TestPCKPacker
@@ -30,6 +30,8 @@
 
 #pragma once
 
+#include "core/config/project_settings.h"
+#include "core/io/json.h"
 #include "core/io/resource.h"
 #include "core/io/resource_loader.h"
 #include "core/io/resource_saver.h"
@@ -111,6 +113,121 @@ TEST_CASE("[Resource] Saving and loading") {
 			"The loaded child resource name should be equal to the expected value.");
 }
 
+TEST_CASE("[Resource] Load profiling") {
+	Ref<Resource> resource = memnew(Resource);
+	resource->set_name("Profiled");
+	const String save_path = TestUtils::get_temp_path("profiled_resource.res");
+	ResourceSaver::save(resource, save_path);
+
+	ResourceLoader::clear_profile();
+	ResourceLoader::set_profiling_enabled(true);
+	Ref<Resource> loaded = ResourceLoader::load(save_path, "", ResourceFormatLoader::CACHE_MODE_IGNORE);
+	ResourceLoader::set_profiling_enabled(false);
+	REQUIRE(loaded.is_valid());
+
+	HashSet<String> phases;
+	for (const ResourceLoader::LoadProfileEvent &event : ResourceLoader::get_profile_events()) {
+		if (event.path.ends_with("profiled_resource.res")) {
+			phases.insert(event.phase);
+			CHECK(event.end_usec >= event.begin_usec);
+			CHECK(event.thread_id == Thread::get_caller_id());
+		}
+	}
+	CHECK_MESSAGE(phases.has("load"), "The whole load should be recorded.");
+	CHECK_MESSAGE(phases.has("read"), "Reading the file header should be recorded.");
+	CHECK_MESSAGE(phases.has("parse"), "Parsing the resources should be recorded.");
+	CHECK_MESSAGE(phases.has("finalize"), "Finalizing the load should be recorded.");
+
+	Variant trace = JSON::parse_string(ResourceLoader::get_profile_as_chrome_trace());
+	REQUIRE(trace.get_type() == Variant::DICTIONARY);
+	CHECK(Array(Dictionary(trace)["traceEvents"]).size() >= 4);
+
+	ResourceLoader::clear_profile();
+	CHECK(ResourceLoader::get_profile_events().is_empty());
+	loaded = ResourceLoader::load(save_path, "", ResourceFormatLoader::CACHE_MODE_IGNORE);
+	CHECK_MESSAGE(ResourceLoader::get_profile_events().is_empty(), "Nothing should be recorded while profiling is disabled.");
+
+	// Only the latest events are kept.
+	ResourceLoader::set_profiling_enabled(true);
+	for (uint32_t i = 0; i < ResourceLoader::PROFILE_MAX_EVENTS + 10; i++) {
+		ResourceLoader::LoadProfileScope scope(itos(i), "test");
+	}
+	ResourceLoader::set_profiling_enabled(false);
+	Vector<ResourceLoader::LoadProfileEvent> events = ResourceLoader::get_profile_events(true);
+	REQUIRE(events.size() == (int)ResourceLoader::PROFILE_MAX_EVENTS);
+	CHECK(events[0].path == "10");
+	CHECK(events[events.size() - 1].path == itos(ResourceLoader::PROFILE_MAX_EVENTS + 9));
+	CHECK_MESSAGE(ResourceLoader::get_profile_events().is_empty(), "Draining should discard the returned events.");
+}
+
+TEST_CASE("[Resource] Threaded loads schedule nested dependencies") {
+	const String leaf_path = TestUtils::get_temp_path("dependency_leaf.res");
+	const String middle_path = TestUtils::get_temp_path("dependency_middle.res");
+	const String root_path = TestUtils::get_temp_path("dependency_root.res");
+	const ResourceUID::ID leaf_uid = ResourceUID::get_singleton()->create_id();
+
+	// Store the UID of the leaf in the middle resource, so its dependency is listed as "uid::type::fallback_path".
+	ResourceSaver::set_get_resource_id_for_path([](const String &p_path, bool p_generate) {
+		return ResourceLoader::get_resource_uid(p_path);
+	});
+	{
+		Ref<Resource> leaf = memnew(Resource);
+		leaf->set_name("Leaf");
+		REQUIRE(ResourceSaver::save(leaf, leaf_path) == OK);
+		REQUIRE(ResourceSaver::set_uid(leaf_path, leaf_uid) == OK);
+		leaf->set_path(leaf_path);
+
+		Ref<Resource> middle = memnew(Resource);
+		middle->set_meta("dependency", leaf);
+		REQUIRE(ResourceSaver::save(middle, middle_path) == OK);
+		middle->set_path(middle_path);
+
+		Ref<Resource> root = memnew(Resource);
+		root->set_meta("dependency", middle);
+		REQUIRE(ResourceSaver::save(root, root_path) == OK);
+	}
+	ResourceSaver::set_get_resource_id_for_path(nullptr);
+	REQUIRE_FALSE(ResourceCache::has(leaf_path));
+
+	List<String> dependencies;
+	ResourceLoader::get_dependencies(middle_path, &dependencies, true);
+	REQUIRE(dependencies.size() == 1);
+	CHECK(dependencies.front()->get().get_slice_count("::") == 3);
+
+	ResourceLoader::clear_profile();
+	ResourceLoader::set_profiling_enabled(true);
+	// The UID is not registered, the fallback path is used.
+	ERR_PRINT_OFF;
+	REQUIRE(ResourceLoader::load_threaded_request(root_path, "", true) == OK);
+	Ref<Resource> loaded = ResourceLoader::load_threaded_get(root_path);
+	ERR_PRINT_ON;
+	ResourceLoader::set_profiling_enabled(false);
+
+	REQUIRE(loaded.is_valid());
+	Ref<Resource> loaded_middle = loaded->get_meta("dependency");
+	REQUIRE(loaded_middle.is_valid());
+	Ref<Resource> loaded_leaf = loaded_middle->get_meta("dependency");
+	REQUIRE(loaded_leaf.is_valid());
+	CHECK(loaded_leaf->get_name() == "Leaf");
+
+	// Scheduled dependencies are started by the root load, not by the resource referencing them.
+	const String root_local_path = ProjectSettings::get_singleton()->localize_path(root_path);
+	HashMap<String, String> requesters;
+	for (const ResourceLoader::LoadProfileEvent &event : ResourceLoader::get_profile_events()) {
+		if (event.phase == "load") {
+			requesters[event.path] = event.parent;
+		}
+	}
+	const String middle_local_path = ProjectSettings::get_singleton()->localize_path(middle_path);
+	const String leaf_local_path = ProjectSettings::get_singleton()->localize_path(leaf_path);
+	REQUIRE(requesters.has(middle_local_path));
+	REQUIRE(requesters.has(leaf_local_path));
+	CHECK(requesters[middle_local_path] == root_local_path);
+	CHECK_MESSAGE(requesters[leaf_local_path] == root_local_path, "Nested dependencies should be scheduled by the root load.");
+
+	ResourceLoader::clear_profile();
+}
+
 TEST_CASE("[Resource] Breaking circular references on save") {
 	Ref<Resource> resource_a = memnew(Resource);
 	resource_a->set_name("A");
@@ -0,0 +1,167 @@
+/**************************************************************************/
+/*  test_message_queue.h                                                  */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GODOT ENGINE                               */
+/*                        https://godotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#pragma once
+
+#include "core/object/message_queue.h"
+#include "core/os/thread.h"
+#include "tests/test_macros.h"
+
+class TestCallQueueInternalsAccessor {
+public:
+	static uint32_t owner_bytes(const CallQueue *p_queue) {
+		uint32_t bytes = 0;
+		for (uint32_t i = 0; i < p_queue->pages_used; i++) {
+			bytes += p_queue->page_bytes[i];
+		}
+		return bytes;
+	}
+
+	static bool has_remote_messages(const CallQueue *p_queue) {
+		return p_queue->remote_head.load() != nullptr;
+	}
+};
+
+namespace TestMessageQueue {
+
+class _Receiver : public Object {
+public:
+	LocalVector<Vector2i> calls;
+
+	void receive(int p_thread, int p_index) {
+		calls.push_back(Vector2i(p_thread, p_index));
+	}
+};
+
+struct _Producer {
+	CallQueue *queue = nullptr;
+	_Receiver *receiver = nullptr;
+	int thread_index = 0;
+	int count = 0;
+	Thread thread;
+
+	static void push_all(void *p_user) {
+		_Producer *producer = static_cast<_Producer *>(p_user);
+		for (int i = 0; i < producer->count; i++) {
+			producer->queue->push_callable(callable_mp(producer->receiver, &_Receiver::receive), producer->thread_index, i);
+		}
+	}
+};
+
+TEST_CASE("[MessageQueue] Calls are flushed in the order they were pushed") {
+	CallQueue queue;
+	_Receiver receiver;
+
+	for (int i = 0; i < 1000; i++) {
+		queue.push_callable(callable_mp(&receiver, &_Receiver::receive), 0, i);
+	}
+	CHECK(queue.has_messages());
+
+	CHECK(queue.flush() == OK);
+	CHECK_FALSE(queue.has_messages());
+	REQUIRE(receiver.calls.size() == 1000);
+	for (int i = 0; i < 1000; i++) {
+		CHECK(receiver.calls[i] == Vector2i(0, i));
+	}
+}
+
+TEST_CASE("[MessageQueue] Calls pushed from several threads") {
+	const int thread_count = 4;
+	const int call_count = 2000;
+
+	CallQueue queue;
+	_Receiver receiver;
+	_Producer producers[thread_count];
+
+	for (int i = 0; i < thread_count; i++) {
+		producers[i].queue = &queue;
+		producers[i].receiver = &receiver;
+		producers[i].thread_index = i;
+		producers[i].count = call_count;
+		producers[i].thread.start(&_Producer::push_all, &producers[i]);
+	}
+	for (_Producer &producer : producers) {
+		producer.thread.wait_to_finish();
+	}
+
+	CHECK(queue.flush() == OK);
+	REQUIRE(receiver.calls.size() == thread_count * call_count);
+
+	// Calls from different threads may interleave, but each thread keeps its own order.
+	int next_index[thread_count] = {};
+	for (const Vector2i &call : receiver.calls) {
+		REQUIRE(call.x >= 0);
+		REQUIRE(call.x < thread_count);
+		CHECK(call.y == next_index[call.x]);
+		next_index[call.x]++;
+	}
+}
+
+TEST_CASE("[MessageQueue] The main thread pushes into the main queue's own pages") {
+	CallQueue *queue = MessageQueue::get_main_singleton();
+	REQUIRE(queue != nullptr);
+	queue->flush();
+
+	_Receiver receiver;
+	queue->push_callable(callable_mp(&receiver, &_Receiver::receive), 0, 0);
+	CHECK(TestCallQueueInternalsAccessor::owner_bytes(queue) > 0);
+	CHECK_FALSE(TestCallQueueInternalsAccessor::has_remote_messages(queue));
+
+	// Other threads still go through the remote list.
+	_Producer producer;
+	producer.queue = queue;
+	producer.receiver = &receiver;
+	producer.thread_index = 1;
+	producer.count = 1;
+	producer.thread.start(&_Producer::push_all, &producer);
+	producer.thread.wait_to_finish();
+	CHECK(TestCallQueueInternalsAccessor::has_remote_messages(queue));
+
+	CHECK(queue->flush() == OK);
+	CHECK(TestCallQueueInternalsAccessor::owner_bytes(queue) == 0);
+	CHECK_FALSE(TestCallQueueInternalsAccessor::has_remote_messages(queue));
+	REQUIRE(receiver.calls.size() == 2);
+	CHECK(receiver.calls[0] == Vector2i(0, 0));
+	CHECK(receiver.calls[1] == Vector2i(1, 0));
+}
+
+TEST_CASE("[MessageQueue] Clearing destroys pending calls") {
+	CallQueue queue;
+	_Receiver receiver;
+
+	queue.push_callable(callable_mp(&receiver, &_Receiver::receive), 0, 0);
+	queue.clear();
+	CHECK_FALSE(queue.has_messages());
+
+	CHECK(queue.flush() == OK);
+	CHECK(receiver.calls.is_empty());
+}
+
+} // namespace TestMessageQueue
@@ -455,6 +455,85 @@ TEST_CASE("[Object] Signals") {
 	}
 }
 
+TEST_CASE("[Object] Signal handles") {
+	static const Object::SignalHandle script_changed_signal(Object::get_class_static(), "script_changed");
+	CHECK(script_changed_signal.index >= 0);
+
+	GDREGISTER_CLASS(_TestDerivedObject);
+	const Object::SignalHandle derived_signal(_TestDerivedObject::get_class_static(), "script_changed");
+	CHECK_MESSAGE(derived_signal.index == script_changed_signal.index, "Inherited signals should share the index of the base class.");
+
+	_TestDerivedObject object;
+
+	SUBCASE("Emitting a signal without connections should return an error") {
+		CHECK(object.emit_signal(script_changed_signal) == ERR_UNAVAILABLE);
+	}
+
+	SUBCASE("Emitting a connected signal should call the connected method") {
+		Array empty_signal_args = { {} };
+
+		SIGNAL_WATCH(&object, "script_changed");
+		SIGNAL_CHECK_FALSE("script_changed");
+
+		CHECK(object.emit_signal(script_changed_signal) == OK);
+		SIGNAL_CHECK("script_changed", empty_signal_args);
+
+		SIGNAL_UNWATCH(&object, "script_changed");
+		CHECK(object.emit_signal(script_changed_signal) == ERR_UNAVAILABLE);
+	}
+
+	SUBCASE("Signals without an index should fall back to the lookup by name") {
+		const Object::SignalHandle user_signal(Object::get_class_static(), "my_custom_signal");
+		CHECK(user_signal.index == -1);
+
+		object.add_user_signal(MethodInfo("my_custom_signal"));
+		SIGNAL_WATCH(&object, "my_custom_signal");
+
+		CHECK(object.emit_signal(user_signal) == OK);
+		SIGNAL_CHECK("my_custom_signal", Array({ {} }));
+
+		SIGNAL_UNWATCH(&object, "my_custom_signal");
+	}
+}
+
+class _SignalReceiver : public Object {
+public:
+	int calls = 0;
+
+	void receive() { calls++; }
+};
+
+// Not part of the regular test run, use `--test --test-case="*Benchmark*" --no-skip`.
+TEST_CASE("[Object][Benchmark] Signal emission" * doctest::skip()) {
+	static const Object::SignalHandle script_changed_signal(Object::get_class_static(), "script_changed");
+	const int emit_count = 100000;
+
+	for (int connection_count : { 1, 10, 100 }) {
+		Object object;
+		_SignalReceiver receivers[100];
+		for (int i = 0; i < connection_count; i++) {
+			object.connect(script_changed_signal.name, callable_mp(&receivers[i], &_SignalReceiver::receive));
+		}
+
+		uint64_t start = OS::get_singleton()->get_ticks_usec();
+		for (int i = 0; i < emit_count; i++) {
+			object.emit_signal(CoreStringName(script_changed));
+		}
+		const uint64_t name_time = OS::get_singleton()->get_ticks_usec() - start;
+
+		start = OS::get_singleton()->get_ticks_usec();
+		for (int i = 0; i < emit_count; i++) {
+			object.emit_signal(script_changed_signal);
+		}
+		const uint64_t handle_time = OS::get_singleton()->get_ticks_usec() - start;
+
+		for (int i = 0; i < connection_count; i++) {
+			CHECK(receivers[i].calls == emit_count * 2);
+		}
+		MESSAGE(vformat("%d connections: %.1f ms by name, %.1f ms by handle (%d emissions).", connection_count, name_time / 1000.0, handle_time / 1000.0, emit_count).utf8().get_data());
+	}
+}
+
 class NotificationObjectSuperclass : public Object {
 	GDCLASS(NotificationObjectSuperclass, Object);
 
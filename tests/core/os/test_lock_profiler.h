@@ -0,0 +1,144 @@
+/**************************************************************************/
+/*  test_lock_profiler.h                                                  */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GODOT ENGINE                               */
+/*                        https://godotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+
+#pragma once
+
+#include "core/os/lock_profiler.h"
+#include "core/os/mutex.h"
+#include "core/os/os.h"
+#include "core/os/rw_lock.h"
+#include "core/os/thread.h"
+#include "core/templates/safe_refcount.h"
+
+#include "tests/test_macros.h"
+
+namespace TestLockProfiler {
+
+#ifdef LOCK_PROFILING_ENABLED
+
+static LockProfile::Stats get_lock_stats(const char *p_name) {
+	for (uint32_t i = 0; i < LockProfiler::get_profile_count(); i++) {
+		LockProfile::Stats stats = LockProfiler::get_stats(i);
+		if (strcmp(stats.name, p_name) == 0) {
+			return stats;
+		}
+	}
+	return LockProfile::Stats();
+}
+
+TEST_CASE("[LockProfiler] Acquisitions are counted per name") {
+	Mutex first("Test lock (shared name)");
+	Mutex second("Test lock (shared name)");
+	Mutex unnamed;
+
+	first.lock();
+	first.unlock();
+	{
+		MutexLock lock(second);
+	}
+	CHECK(second.try_lock());
+	second.unlock();
+	unnamed.lock();
+	unnamed.unlock();
+
+	LockProfile::Stats stats = get_lock_stats("Test lock (shared name)");
+	CHECK(stats.name != nullptr);
+	CHECK(stats.acquisitions == 3);
+	CHECK(stats.contended == 0);
+	CHECK(stats.wait_usec == 0);
+}
+
+TEST_CASE("[LockProfiler] Contention is reported against the owning call site") {
+	struct Data {
+		Mutex mutex{ "Test lock (contended)" };
+		SafeFlag waiting;
+	} data;
+
+	data.mutex.lock();
+	const int owner_line = __LINE__ - 1;
+
+	Thread thread;
+	thread.start([](void *p_data) {
+		Data *data = static_cast<Data *>(p_data);
+		data->waiting.set();
+		data->mutex.lock();
+		data->mutex.unlock();
+	},
+			&data);
+	while (!data.waiting.is_set()) {
+		OS::get_singleton()->delay_usec(100);
+	}
+	// Give the thread time to block on the lock.
+	OS::get_singleton()->delay_usec(20000);
+	data.mutex.unlock();
+	thread.wait_to_finish();
+
+	LockProfile::Stats stats = get_lock_stats("Test lock (contended)");
+	CHECK(stats.acquisitions == 2);
+	REQUIRE(stats.contended == 1);
+	CHECK(stats.wait_usec > 0);
+	CHECK(stats.max_wait_usec == stats.wait_usec);
+	REQUIRE(stats.site_count == 1);
+	CHECK(strcmp(stats.sites[0].file, __FILE__) == 0);
+	CHECK(stats.sites[0].line == owner_line);
+	CHECK(stats.sites[0].contended == 1);
+}
+
+TEST_CASE("[LockProfiler] Readers are not owners") {
+	struct Data {
+		RWLock rw_lock{ "Test lock (read/write)" };
+		SafeFlag waiting;
+	} data;
+
+	data.rw_lock.read_lock();
+	Thread thread;
+	thread.start([](void *p_data) {
+		Data *data = static_cast<Data *>(p_data);
+		data->waiting.set();
+		RWLockWrite write(data->rw_lock);
+	},
+			&data);
+	while (!data.waiting.is_set()) {
+		OS::get_singleton()->delay_usec(100);
+	}
+	OS::get_singleton()->delay_usec(20000);
+	data.rw_lock.read_unlock();
+	thread.wait_to_finish();
+
+	LockProfile::Stats stats = get_lock_stats("Test lock (read/write)");
+	CHECK(stats.acquisitions == 2);
+	REQUIRE(stats.site_count == 1);
+	CHECK(stats.sites[0].file == nullptr);
+}
+
+#endif // LOCK_PROFILING_ENABLED
+
+} // namespace TestLockProfiler
@@ -172,4 +172,186 @@ TEST_CASE("[WorkerThreadPool] Run a yielding daemon as the only hope for other t
 	CHECK_MESSAGE(all_needed_yield, "All legit tasks should have needed the daemon yielding to run.");
 }
 
+static void static_nested_subtask(void *p_arg) {
+	counter[(uintptr_t)p_arg].increment();
+}
+
+static void static_nested_task(void *p_arg) {
+	// Subtasks are queued on this thread and stolen by the others, while this one waits collaboratively.
+	WorkerThreadPool *pool = (WorkerThreadPool *)p_arg;
+	LocalVector<WorkerThreadPool::TaskID> subtasks;
+	for (uint32_t i = 0; i < counter.size(); i++) {
+		subtasks.push_back(pool->add_native_task(static_nested_subtask, (void *)(uintptr_t)i, true));
+	}
+	for (WorkerThreadPool::TaskID subtask : subtasks) {
+		pool->wait_for_task_completion(subtask);
+	}
+}
+
+TEST_CASE("[WorkerThreadPool] Process tasks posted from pool threads") {
+	WorkerThreadPool pool(false);
+	pool.init(4);
+
+	for (int iterations = 0; iterations < 100; iterations++) {
+		counter.clear();
+		counter.resize(64);
+
+		LocalVector<WorkerThreadPool::TaskID> tasks;
+		for (int i = 0; i < 4; i++) {
+			tasks.push_back(pool.add_native_task(static_nested_task, &pool, i % 2));
+		}
+		for (WorkerThreadPool::TaskID task : tasks) {
+			pool.wait_for_task_completion(task);
+		}
+
+		bool all_run = true;
+		for (uint32_t i = 0; i < counter.size(); i++) {
+			all_run &= counter[i].get() == 4;
+		}
+		CHECK(all_run);
+	}
+}
+
+static void static_blocking_task(void *p_arg) {
+	counter[0].increment();
+	while (!((SafeFlag *)p_arg)->is_set()) {
+		OS::get_singleton()->delay_usec(1);
+	}
+}
+
+static LocalVector<int> run_order;
+
+static void static_ordered_task(void *p_arg) {
+	run_order[(uintptr_t)p_arg] = counter[1].postincrement();
+}
+
+TEST_CASE("[WorkerThreadPool] Run high-priority tasks before the low-priority backlog") {
+	// With two threads, a single low-priority task is allowed to run at a time.
+	WorkerThreadPool pool(false);
+	pool.init(2);
+
+	const int task_count = 8;
+	for (int iterations = 0; iterations < 20; iterations++) {
+		counter.clear();
+		counter.resize(2);
+		run_order.clear();
+		run_order.resize(task_count * 2);
+
+		// Occupy both threads, so every task below is queued before any of them runs.
+		SafeFlag release_first;
+		SafeFlag release_second;
+		WorkerThreadPool::TaskID first_blocker = pool.add_native_task(static_blocking_task, &release_first, true);
+		WorkerThreadPool::TaskID second_blocker = pool.add_native_task(static_blocking_task, &release_second, true);
+		while (counter[0].get() != 2) {
+			OS::get_singleton()->delay_usec(1);
+		}
+
+		LocalVector<WorkerThreadPool::TaskID> tasks;
+		for (int i = 0; i < task_count; i++) {
+			tasks.push_back(pool.add_native_task(static_ordered_task, (void *)(uintptr_t)(task_count + i), false));
+		}
+		for (int i = 0; i < task_count; i++) {
+			tasks.push_back(pool.add_native_task(static_ordered_task, (void *)(uintptr_t)i, true));
+		}
+
+		// A single thread is freed, it has to steal high-priority tasks from the other one's queue before
+		// running the low-priority ones, so the order is deterministic.
+		release_first.set();
+		pool.wait_for_task_completion(first_blocker);
+		for (WorkerThreadPool::TaskID task : tasks) {
+			pool.wait_for_task_completion(task);
+		}
+		release_second.set();
+		pool.wait_for_task_completion(second_blocker);
+
+		bool high_priority_first = true;
+		for (int i = 0; i < task_count; i++) {
+			high_priority_first &= run_order[i] < task_count;
+			high_priority_first &= run_order[task_count + i] >= task_count;
+		}
+		CHECK(high_priority_first);
+	}
+}
+
+static void static_counted_low_priority_task(void *p_arg) {
+	counter[1].exchange_if_greater(counter[0].increment());
+	OS::get_singleton()->delay_usec(100);
+	counter[0].decrement();
+	counter[2].increment();
+}
+
+TEST_CASE("[WorkerThreadPool] Limit the threads running low-priority tasks") {
+	// Four threads and a ratio of a half allow two low-priority tasks to run at a time.
+	WorkerThreadPool pool(false);
+	pool.init(4, 0.5);
+
+	const int task_count = 32;
+	for (int iterations = 0; iterations < 20; iterations++) {
+		counter.clear();
+		counter.resize(3);
+
+		// Tasks over the limit wait in the low-priority queue and are promoted as others complete.
+		LocalVector<WorkerThreadPool::TaskID> tasks;
+		for (int i = 0; i < task_count; i++) {
+			tasks.push_back(pool.add_native_task(static_counted_low_priority_task, nullptr, false));
+		}
+		for (WorkerThreadPool::TaskID task : tasks) {
+			pool.wait_for_task_completion(task);
+		}
+
+		CHECK(counter[2].get() == task_count);
+		CHECK(counter[1].get() <= 2);
+	}
+}
+
+static void static_tiny_task(void *p_arg) {
+	counter[0].increment();
+}
+
+static void static_tiny_group_task(void *p_arg, uint32_t p_index) {
+	counter[0].increment();
+}
+
+// Not part of the regular test run, use `--test --test-case="*Benchmark*" --no-skip`.
+TEST_CASE("[WorkerThreadPool][Benchmark] Scaling with tiny tasks" * doctest::skip()) {
+	const int task_count = 50000;
+	const int group_count = 5000;
+	const int group_elements = 16;
+	const int max_threads = OS::get_singleton()->get_default_thread_pool_size();
+
+	LocalVector<int> thread_counts;
+	for (int i = 1; i < max_threads; i *= 2) {
+		thread_counts.push_back(i);
+	}
+	thread_counts.push_back(max_threads);
+
+	for (int thread_count : thread_counts) {
+		WorkerThreadPool pool(false);
+		pool.init(thread_count);
+		counter.clear();
+		counter.resize(1);
+
+		LocalVector<WorkerThreadPool::TaskID> tasks;
+		tasks.resize(task_count);
+		uint64_t start = OS::get_singleton()->get_ticks_usec();
+		for (int i = 0; i < task_count; i++) {
+			tasks[i] = pool.add_native_task(static_tiny_task, nullptr, true);
+		}
+		for (int i = 0; i < task_count; i++) {
+			pool.wait_for_task_completion(tasks[i]);
+		}
+		const uint64_t task_time = OS::get_singleton()->get_ticks_usec() - start;
+
+		start = OS::get_singleton()->get_ticks_usec();
+		for (int i = 0; i < group_count; i++) {
+			WorkerThreadPool::GroupID group = pool.add_native_group_task(static_tiny_group_task, nullptr, group_elements, -1, true);
+			pool.wait_for_group_task_completion(group);
+		}
+		const uint64_t group_time = OS::get_singleton()->get_ticks_usec() - start;
+
+		CHECK(counter[0].get() == task_count + group_count * group_elements);
+		MESSAGE(vformat("%d threads: %.1f ms for %d tasks, %.1f ms for %d groups of %d elements.", thread_count, task_time / 1000.0, task_count, group_time / 1000.0, group_count, group_elements).utf8().get_data());
+	}
+}
+
 } // namespace TestWorkerThreadPool
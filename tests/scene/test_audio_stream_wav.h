@@ -216,4 +216,30 @@ TEST_CASE("[Audio][AudioStreamWAV] Saving IMA ADPCM is not supported") {
 	ERR_PRINT_ON;
 }
 
+TEST_CASE("[Audio][AudioStreamWAV] Advancing the position of virtual voices") {
+	Ref<AudioStreamWAV> stream = memnew(AudioStreamWAV);
+	stream->set_data(gen_pcm8_test(WAV_RATE, WAV_COUNT, false));
+	Ref<AudioStreamPlayback> playback = stream->instantiate_playback();
+
+	SUBCASE("Without loop") {
+		CHECK(playback->get_position_after(0.25, 0.5) == doctest::Approx(0.75));
+		CHECK(playback->get_position_after(0.75, 0.5) < 0.0);
+	}
+
+	SUBCASE("Forward loop") {
+		stream->set_loop_mode(AudioStreamWAV::LOOP_FORWARD);
+		stream->set_loop_begin(WAV_COUNT / 4);
+		stream->set_loop_end(WAV_COUNT / 2);
+		CHECK(playback->get_position_after(0.0, 0.4) == doctest::Approx(0.4));
+		CHECK(playback->get_position_after(0.4, 0.2) == doctest::Approx(0.35));
+		CHECK(playback->get_position_after(0.4, 10.0) == doctest::Approx(0.4));
+	}
+
+	SUBCASE("Unknown without decoding") {
+		stream->set_loop_mode(AudioStreamWAV::LOOP_PINGPONG);
+		stream->set_loop_end(WAV_COUNT / 2);
+		CHECK(Math::is_nan(playback->get_position_after(0.0, 0.1)));
+	}
+}
+
 } // namespace TestAudioStreamWAV
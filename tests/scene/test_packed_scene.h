@@ -174,6 +174,31 @@ TEST_CASE("[PackedScene] Instantiate Packed Scene") {
 	memdelete(instance);
 }
 
+TEST_CASE("[PackedScene] Instantiation is recorded by the load profiler") {
+	Node *scene = memnew(Node);
+	scene->set_name("TestScene");
+
+	Ref<PackedScene> packed_scene;
+	packed_scene.instantiate();
+	packed_scene->pack(scene);
+	packed_scene->set_path_cache("res://profiled_scene.tscn");
+
+	ResourceLoader::clear_profile();
+	ResourceLoader::set_profiling_enabled(true);
+	Node *instance = packed_scene->instantiate();
+	ResourceLoader::set_profiling_enabled(false);
+	REQUIRE(instance != nullptr);
+
+	Vector<ResourceLoader::LoadProfileEvent> events = ResourceLoader::get_profile_events(true);
+	REQUIRE(events.size() == 1);
+	CHECK(events[0].path == "res://profiled_scene.tscn");
+	CHECK(events[0].phase == "instantiate");
+	CHECK(events[0].end_usec >= events[0].begin_usec);
+
+	memdelete(scene);
+	memdelete(instance);
+}
+
 TEST_CASE("[PackedScene] Instantiate Packed Scene With Children") {
 	// Create a scene to pack.
 	Node *scene = memnew(Node);
@@ -0,0 +1,274 @@
+/**************************************************************************/
+/*  test_rich_text_label.h                                                */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GODOT ENGINE                               */
+/*                        https://godotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#pragma once
+
+#include "scene/gui/rich_text_label.h"
+#include "scene/main/window.h"
+#include "scene/resources/text_paragraph.h"
+#include "scene/theme/theme_db.h"
+
+#include "tests/test_macros.h"
+
+class TestRichTextLabelInternalsAccessor {
+public:
+	// RID of the first broken line of each paragraph, a new one is created whenever a paragraph is reshaped.
+	static Vector<RID> get_paragraph_line_rids(RichTextLabel *p_rtl) {
+		Vector<RID> rids;
+		for (const RichTextLabel::Line &line : p_rtl->main->lines) {
+			rids.push_back(line.text_buf->get_line_rid(0));
+		}
+		return rids;
+	}
+
+	// Revalidates every paragraph, as if something they don't depend on changed.
+	static void revalidate_all_lines(RichTextLabel *p_rtl) {
+		p_rtl->main->first_invalid_line.store(0);
+		p_rtl->_validate_line_caches();
+	}
+};
+
+namespace TestRichTextLabel {
+
+TEST_CASE("[SceneTree][RichTextLabel] Visible characters") {
+	RichTextLabel *rtl = memnew(RichTextLabel);
+	rtl->set_size(Size2(400, 200));
+	SceneTree::get_singleton()->get_root()->add_child(rtl);
+
+	rtl->set_text("First paragraph of the dialogue.\nSecond paragraph, a bit longer than the first one so that it wraps.\nThird.");
+	CHECK(rtl->is_finished());
+
+	const int total_chars = rtl->get_total_character_count();
+	const int line_count = rtl->get_line_count();
+	const int content_height = rtl->get_content_height();
+
+	SUBCASE("Revealing characters one by one keeps layout consistent") {
+		for (int i = 0; i <= total_chars; i++) {
+			rtl->set_visible_characters(i);
+			CHECK(rtl->is_finished());
+		}
+		CHECK(rtl->get_line_count() == line_count);
+		CHECK(rtl->get_content_height() == content_height);
+
+		rtl->set_visible_characters(-1);
+		CHECK(rtl->get_line_count() == line_count);
+		CHECK(rtl->get_content_height() == content_height);
+	}
+
+	SUBCASE("Hiding characters trims trailing paragraphs") {
+		rtl->set_visible_characters(5);
+		CHECK(rtl->get_content_height() < content_height);
+		CHECK(rtl->get_character_paragraph(2) == 0);
+
+		rtl->set_visible_ratio(1.0);
+		CHECK(rtl->get_visible_characters() == -1);
+		CHECK(rtl->get_line_count() == line_count);
+		CHECK(rtl->get_content_height() == content_height);
+	}
+
+	SUBCASE("Resizing after a reveal updates cached lines") {
+		rtl->set_visible_characters(40);
+		rtl->set_size(Size2(100, 200));
+		rtl->set_visible_characters(-1);
+		CHECK(rtl->get_line_count() > line_count);
+
+		rtl->set_size(Size2(400, 200));
+		CHECK(rtl->get_line_count() == line_count);
+		CHECK(rtl->get_content_height() == content_height);
+	}
+
+	SUBCASE("Paragraphs with unchanged inputs are not reshaped") {
+		const Vector<RID> rids = TestRichTextLabelInternalsAccessor::get_paragraph_line_rids(rtl);
+		REQUIRE(rids.size() == 3);
+
+		TestRichTextLabelInternalsAccessor::revalidate_all_lines(rtl);
+		CHECK(TestRichTextLabelInternalsAccessor::get_paragraph_line_rids(rtl) == rids);
+
+		// Only the last paragraph is trimmed.
+		rtl->set_visible_characters(total_chars - 1);
+		TestRichTextLabelInternalsAccessor::revalidate_all_lines(rtl);
+		const Vector<RID> trimmed_rids = TestRichTextLabelInternalsAccessor::get_paragraph_line_rids(rtl);
+		CHECK(trimmed_rids[0] == rids[0]);
+		CHECK(trimmed_rids[1] == rids[1]);
+		CHECK(trimmed_rids[2] != rids[2]);
+	}
+
+	memdelete(rtl);
+}
+
+TEST_CASE("[SceneTree][RichTextLabel] Batched shaping matches shaping one paragraph at a time") {
+	// Several batches of paragraphs, shaped in parallel slices when the pool has more than one thread.
+	const int paragraph_count = 600;
+	String text;
+	for (int i = 0; i < paragraph_count; i++) {
+		text += vformat("Paragraph %d.", i) + String(" Some more words to wrap.").repeat(i % 7) + "\n";
+	}
+
+	RichTextLabel *batched = memnew(RichTextLabel);
+	batched->set_size(Size2(300, 200));
+	SceneTree::get_singleton()->get_root()->add_child(batched);
+	batched->add_text(text);
+
+	RichTextLabel *serial = memnew(RichTextLabel);
+	serial->set_size(Size2(300, 200));
+	SceneTree::get_singleton()->get_root()->add_child(serial);
+	for (const String &paragraph : text.split("\n", false)) {
+		serial->add_text(paragraph + "\n");
+		serial->get_content_height(); // Shape this paragraph alone.
+	}
+
+	CHECK(batched->is_finished());
+	CHECK(batched->get_paragraph_count() == serial->get_paragraph_count());
+	CHECK(batched->get_line_count() == serial->get_line_count());
+	CHECK(batched->get_content_height() == serial->get_content_height());
+	bool same_offsets = true;
+	for (int i = 0; i < batched->get_paragraph_count(); i++) {
+		same_offsets = same_offsets && batched->get_paragraph_offset(i) == serial->get_paragraph_offset(i);
+	}
+	CHECK(same_offsets);
+
+	memdelete(serial);
+	memdelete(batched);
+}
+
+TEST_CASE("[SceneTree][RichTextLabel] Max paragraphs") {
+	RichTextLabel *rtl = memnew(RichTextLabel);
+	rtl->set_size(Size2(400, 200));
+	SceneTree::get_singleton()->get_root()->add_child(rtl);
+
+	SUBCASE("Oldest paragraphs are evicted") {
+		rtl->set_max_paragraphs(3);
+		for (int i = 0; i < 10; i++) {
+			rtl->add_text(vformat("Message %d", i));
+			rtl->add_newline();
+			CHECK(rtl->get_paragraph_count() <= 3);
+		}
+		CHECK(rtl->get_paragraph_count() == 3);
+		CHECK(rtl->get_parsed_text() == "Message 8\nMessage 9\n");
+		CHECK(rtl->get_total_character_count() == 20);
+		CHECK(rtl->is_finished());
+
+		rtl->set_max_paragraphs(2);
+		CHECK(rtl->get_parsed_text() == "Message 9\n");
+
+		rtl->append_text("[b]Message 10[/b]\nMessage 11\n");
+		CHECK(rtl->get_paragraph_count() == 2);
+		CHECK(rtl->get_parsed_text() == "Message 11\n");
+	}
+
+	SUBCASE("Paragraphs with open tags are kept") {
+		rtl->set_max_paragraphs(2);
+		rtl->push_bold();
+		rtl->add_text("a\nb\nc\n");
+		CHECK(rtl->get_paragraph_count() == 4);
+
+		rtl->pop();
+		rtl->add_text("d\n");
+		CHECK(rtl->get_paragraph_count() == 2);
+		CHECK(rtl->get_parsed_text() == "d\n");
+	}
+
+	SUBCASE("Limit is at least one paragraph") {
+		rtl->set_max_paragraphs(0);
+		CHECK(rtl->get_max_paragraphs() == 1);
+		rtl->set_max_paragraphs(-5);
+		CHECK(rtl->get_max_paragraphs() == -1);
+	}
+
+	SUBCASE("Unlimited by default") {
+		CHECK(rtl->get_max_paragraphs() == -1);
+		for (int i = 0; i < 10; i++) {
+			rtl->add_text(vformat("Message %d", i));
+			rtl->add_newline();
+		}
+		CHECK(rtl->get_paragraph_count() == 11);
+	}
+
+	memdelete(rtl);
+}
+
+static String make_paragraph(int p_index, const String &p_run) {
+	return vformat("Paragraph %d of run %s.", p_index, p_run) + String(" Some more words to wrap.").repeat(p_index % 7);
+}
+
+static void shape_paragraph(void *p_userdata, uint32_t p_index) {
+	LocalVector<Ref<TextParagraph>> *paragraphs = static_cast<LocalVector<Ref<TextParagraph>> *>(p_userdata);
+	(*paragraphs)[p_index]->get_size();
+}
+
+// Not part of the regular test run, use `--test --test-case="*Benchmark*" --no-skip`.
+TEST_CASE("[SceneTree][RichTextLabel][Benchmark] Shaping paragraphs in parallel slices" * doctest::skip()) {
+	const int paragraph_count = 2000;
+	const Ref<Font> font = ThemeDB::get_singleton()->get_fallback_font();
+	const int font_size = ThemeDB::get_singleton()->get_fallback_font_size();
+
+	// Every run uses different text, so shaped text cached by the previous run is not reused.
+	LocalVector<Ref<TextParagraph>> paragraphs;
+	paragraphs.resize(paragraph_count);
+	for (int i = 0; i < paragraph_count; i++) {
+		paragraphs[i].instantiate();
+		paragraphs[i]->add_string(make_paragraph(i, "serial"), font, font_size);
+		paragraphs[i]->set_width(300);
+	}
+	uint64_t start = OS::get_singleton()->get_ticks_usec();
+	for (int i = 0; i < paragraph_count; i++) {
+		shape_paragraph(&paragraphs, i);
+	}
+	const uint64_t serial_time = OS::get_singleton()->get_ticks_usec() - start;
+
+	for (int i = 0; i < paragraph_count; i++) {
+		paragraphs[i].instantiate();
+		paragraphs[i]->add_string(make_paragraph(i, "parallel"), font, font_size);
+		paragraphs[i]->set_width(300);
+	}
+	start = OS::get_singleton()->get_ticks_usec();
+	WorkerThreadPool::GroupID group = WorkerThreadPool::get_singleton()->add_native_group_task(&shape_paragraph, &paragraphs, paragraph_count, -1, true);
+	WorkerThreadPool::get_singleton()->wait_for_group_task_completion(group);
+	const uint64_t parallel_time = OS::get_singleton()->get_ticks_usec() - start;
+
+	// The label fills paragraphs in order and shapes them in slices.
+	String text;
+	for (int i = 0; i < paragraph_count; i++) {
+		text += make_paragraph(i, "label") + "\n";
+	}
+	RichTextLabel *rtl = memnew(RichTextLabel);
+	rtl->set_size(Size2(300, 200));
+	SceneTree::get_singleton()->get_root()->add_child(rtl);
+	start = OS::get_singleton()->get_ticks_usec();
+	rtl->add_text(text);
+	rtl->get_content_height();
+	const uint64_t label_time = OS::get_singleton()->get_ticks_usec() - start;
+	memdelete(rtl);
+
+	// Shaping holds the text server lock, so the parallel speedup is bounded by the share of line breaking.
+	MESSAGE(vformat("%d paragraphs, %d threads: serial %d usec, parallel %d usec (%.2fx), RichTextLabel %d usec.", paragraph_count, WorkerThreadPool::get_singleton()->get_thread_count(), serial_time, parallel_time, double(serial_time) / MAX(parallel_time, (uint64_t)1), label_time).utf8().get_data());
+}
+
+} // namespace TestRichTextLabel
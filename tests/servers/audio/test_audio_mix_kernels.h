@@ -0,0 +1,206 @@
+/**************************************************************************/
+/*  test_audio_mix_kernels.h                                              */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GODOT ENGINE                               */
+/*                        https://godotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#pragma once
+
+#include "servers/audio/audio_filter_sw.h"
+#include "servers/audio/audio_mix_kernels.h"
+
+#include "tests/test_macros.h"
+
+namespace TestAudioMixKernels {
+
+// Not a multiple of any vector width, so the scalar tail is exercised too.
+static const uint32_t FRAME_COUNT = 517;
+
+static LocalVector<AudioFrame> make_signal(uint32_t p_frames, uint32_t p_seed) {
+	LocalVector<AudioFrame> signal;
+	signal.resize(p_frames);
+	for (uint32_t i = 0; i < p_frames; i++) {
+		signal[i] = AudioFrame(Math::sin((i + p_seed) * 0.05f), Math::cos((i * 3 + p_seed) * 0.02f));
+	}
+	return signal;
+}
+
+static bool frames_equal_approx(const LocalVector<AudioFrame> &p_a, const LocalVector<AudioFrame> &p_b) {
+	for (uint32_t i = 0; i < p_a.size(); i++) {
+		if (!Math::is_equal_approx(p_a[i].left, p_b[i].left) || !Math::is_equal_approx(p_a[i].right, p_b[i].right)) {
+			return false;
+		}
+	}
+	return true;
+}
+
+static void setup_highshelf(AudioFilterSW &r_filter, AudioFilterSW::Processor &r_left, AudioFilterSW::Processor &r_right, uint32_t p_frames) {
+	r_filter.set_mode(AudioFilterSW::HIGHSHELF);
+	r_filter.set_sampling_rate(44100);
+	r_filter.set_cutoff(2000);
+	r_filter.set_resonance(1);
+	r_filter.set_stages(1);
+	r_filter.set_gain(0.5);
+	r_left.set_filter(&r_filter);
+	r_left.update_coeffs(p_frames);
+	r_right.set_filter(&r_filter);
+	r_right.update_coeffs(p_frames);
+}
+
+TEST_CASE("[AudioMixKernels] Vectorized kernels match the scalar ones") {
+	const AudioMixKernels::Implementation previous = AudioMixKernels::get_implementation();
+	const LocalVector<AudioFrame> source = make_signal(FRAME_COUNT, 0);
+	const LocalVector<AudioFrame> initial = make_signal(FRAME_COUNT, 100);
+	const AudioFrame vol_start(0.25, 1.0);
+	const AudioFrame vol_final(0.75, 0.5);
+
+	AudioMixKernels::set_implementation(AudioMixKernels::IMPLEMENTATION_SCALAR);
+	LocalVector<AudioFrame> expected_mix = initial;
+	AudioMixKernels::mix_ramp(expected_mix.ptr(), source.ptr(), vol_start, vol_final, FRAME_COUNT);
+	LocalVector<AudioFrame> expected_scale = initial;
+	AudioMixKernels::scale_ramp(expected_scale.ptr(), source.ptr(), vol_start, vol_final, FRAME_COUNT);
+	LocalVector<AudioFrame> expected_sum = initial;
+	AudioMixKernels::accumulate(expected_sum.ptr(), source.ptr(), FRAME_COUNT);
+
+	CHECK(Math::is_equal_approx(expected_mix[1].left, initial[1].left + (0.75f / FRAME_COUNT + (1 - 1.0f / FRAME_COUNT) * 0.25f) * source[1].left));
+	CHECK(Math::is_equal_approx(expected_scale[0].right, source[0].right));
+	CHECK(Math::is_equal_approx(expected_sum[2].left, initial[2].left + source[2].left));
+
+	for (int i = AudioMixKernels::IMPLEMENTATION_SCALAR + 1; i < AudioMixKernels::IMPLEMENTATION_MAX; i++) {
+		const AudioMixKernels::Implementation implementation = AudioMixKernels::Implementation(i);
+		if (!AudioMixKernels::is_implementation_supported(implementation)) {
+			continue;
+		}
+		AudioMixKernels::set_implementation(implementation);
+		INFO(AudioMixKernels::get_implementation_name(implementation));
+
+		LocalVector<AudioFrame> mix = initial;
+		AudioMixKernels::mix_ramp(mix.ptr(), source.ptr(), vol_start, vol_final, FRAME_COUNT);
+		CHECK(frames_equal_approx(mix, expected_mix));
+
+		LocalVector<AudioFrame> scale = initial;
+		AudioMixKernels::scale_ramp(scale.ptr(), source.ptr(), vol_start, vol_final, FRAME_COUNT);
+		CHECK(frames_equal_approx(scale, expected_scale));
+
+		LocalVector<AudioFrame> sum = initial;
+		AudioMixKernels::accumulate(sum.ptr(), source.ptr(), FRAME_COUNT);
+		CHECK(frames_equal_approx(sum, expected_sum));
+	}
+
+	AudioMixKernels::set_implementation(previous);
+}
+
+TEST_CASE("[AudioMixKernels] Stereo filter processing matches per-channel processing") {
+	AudioFilterSW filter;
+	AudioFilterSW::Processor left;
+	AudioFilterSW::Processor right;
+	AudioFilterSW::Processor stereo_left;
+	AudioFilterSW::Processor stereo_right;
+	setup_highshelf(filter, left, right, FRAME_COUNT);
+	setup_highshelf(filter, stereo_left, stereo_right, FRAME_COUNT);
+
+	LocalVector<AudioFrame> expected = make_signal(FRAME_COUNT, 0);
+	LocalVector<AudioFrame> frames = expected;
+
+	// Run twice, so the history carried over between calls is checked as well.
+	for (int pass = 0; pass < 2; pass++) {
+		for (AudioFrame &frame : expected) {
+			left.process_one_interp(frame.left);
+			right.process_one_interp(frame.right);
+		}
+		AudioFilterSW::Processor::process_stereo(&stereo_left, &stereo_right, frames.ptr(), FRAME_COUNT, true);
+		CHECK(frames_equal_approx(frames, expected));
+	}
+}
+
+// Not part of the regular test run, use `--test --test-case="*Benchmark*" --no-skip`.
+TEST_CASE("[AudioMixKernels][Benchmark] Mixing 256 voices" * doctest::skip()) {
+	const int voice_count = 256;
+	const uint32_t buffer_size = 512;
+	const int mix_count = 200;
+	const AudioMixKernels::Implementation previous = AudioMixKernels::get_implementation();
+
+	LocalVector<LocalVector<AudioFrame>> voices;
+	voices.resize(voice_count);
+	for (int i = 0; i < voice_count; i++) {
+		voices[i] = make_signal(buffer_size, i * 7);
+	}
+	LocalVector<AudioFrame> output;
+	output.resize(buffer_size);
+	LocalVector<AudioFrame> filtered;
+	filtered.resize(buffer_size);
+
+	AudioFilterSW filter;
+	LocalVector<AudioFilterSW::Processor> processors;
+	processors.resize(voice_count * 2);
+
+	for (int i = AudioMixKernels::IMPLEMENTATION_SCALAR; i < AudioMixKernels::IMPLEMENTATION_MAX; i++) {
+		const AudioMixKernels::Implementation implementation = AudioMixKernels::Implementation(i);
+		if (!AudioMixKernels::is_implementation_supported(implementation)) {
+			continue;
+		}
+		AudioMixKernels::set_implementation(implementation);
+
+		// Volume ramps only, like most voices.
+		uint64_t start = OS::get_singleton()->get_ticks_usec();
+		for (int mix = 0; mix < mix_count; mix++) {
+			for (int voice = 0; voice < voice_count; voice++) {
+				AudioMixKernels::mix_ramp(output.ptr(), voices[voice].ptr(), AudioFrame(0.5, 0.5), AudioFrame(0.25, 0.75), buffer_size);
+			}
+		}
+		const uint64_t ramp_time = OS::get_singleton()->get_ticks_usec() - start;
+
+		// Volume ramps and attenuation filters, like 3D voices.
+		start = OS::get_singleton()->get_ticks_usec();
+		for (int mix = 0; mix < mix_count; mix++) {
+			for (int voice = 0; voice < voice_count; voice++) {
+				setup_highshelf(filter, processors[voice * 2], processors[voice * 2 + 1], buffer_size);
+				if (implementation == AudioMixKernels::IMPLEMENTATION_SCALAR) {
+					// The per-sample loop used before the stereo filter.
+					for (uint32_t frame = 0; frame < buffer_size; frame++) {
+						float lerp_param = (float)frame / buffer_size;
+						AudioFrame mixed = (AudioFrame(0.25, 0.75) * lerp_param + (1 - lerp_param) * AudioFrame(0.5, 0.5)) * voices[voice][frame];
+						processors[voice * 2].process_one_interp(mixed.left);
+						processors[voice * 2 + 1].process_one_interp(mixed.right);
+						output[frame] += mixed;
+					}
+				} else {
+					AudioMixKernels::scale_ramp(filtered.ptr(), voices[voice].ptr(), AudioFrame(0.5, 0.5), AudioFrame(0.25, 0.75), buffer_size);
+					AudioFilterSW::Processor::process_stereo(&processors[voice * 2], &processors[voice * 2 + 1], filtered.ptr(), buffer_size, true);
+					AudioMixKernels::accumulate(output.ptr(), filtered.ptr(), buffer_size);
+				}
+			}
+		}
+		const uint64_t filter_time = OS::get_singleton()->get_ticks_usec() - start;
+
+		MESSAGE(vformat("%s: ramp %.3f ms/mix, ramp and filter %.3f ms/mix.", AudioMixKernels::get_implementation_name(implementation), ramp_time / 1000.0 / mix_count, filter_time / 1000.0 / mix_count).utf8().get_data());
+	}
+
+	AudioMixKernels::set_implementation(previous);
+}
+
+} // namespace TestAudioMixKernels
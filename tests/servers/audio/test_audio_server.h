@@ -0,0 +1,354 @@
+/**************************************************************************/
+/*  test_audio_server.h                                                   */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GODOT ENGINE                               */
+/*                        https://godotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#pragma once
+
+#include "core/object/worker_thread_pool.h"
+#include "servers/audio/effects/audio_effect_amplify.h"
+#include "servers/audio/effects/audio_effect_delay.h"
+#include "servers/audio/audio_stream.h"
+#include "servers/audio_server.h"
+
+#include "tests/test_macros.h"
+
+class TestAudioServerInternalsAccessor {
+public:
+	// Does what `_mix_step()` does before mixing, then fills the first channel of every bus with a different signal.
+	static void begin_mix(AudioServer *p_server) {
+		for (int i = 0; i < p_server->buses.size(); i++) {
+			AudioServer::Bus *bus = p_server->buses[i];
+			bus->index_cache = i;
+			for (int k = 0; k < bus->channels.size(); k++) {
+				bus->channels.write[k].used = false;
+			}
+
+			AudioFrame *buffer = p_server->thread_get_channel_mix_buffer(i, 0);
+			for (uint32_t j = 0; j < p_server->buffer_size; j++) {
+				buffer[j] = AudioFrame(Math::sin(j * 0.01f * (i + 1)), Math::cos(j * 0.02f * (i + 1))) * 0.2f;
+			}
+		}
+	}
+
+	static void process_buses(AudioServer *p_server, bool p_parallel) {
+		if (p_parallel) {
+			p_server->_process_buses_parallel(false);
+		} else {
+			p_server->_process_buses_serial(false);
+		}
+	}
+
+	static Vector<AudioFrame> get_bus_buffer(AudioServer *p_server, int p_bus) {
+		return p_server->buses[p_bus]->channels[0].buffer;
+	}
+
+	// Gives every effect a fresh instance, so stateful effects start over.
+	static void reset_effects(AudioServer *p_server) {
+		for (int i = 0; i < p_server->buses.size(); i++) {
+			p_server->_update_bus_effects(i);
+		}
+	}
+
+	static void set_bus_effects_pool(AudioServer *p_server, WorkerThreadPool *p_pool) {
+		p_server->bus_effects_pool = p_pool;
+	}
+
+	static uint32_t get_bus_depth(AudioServer *p_server, int p_bus) {
+		return p_server->bus_depths[p_bus];
+	}
+
+	static void mix_step(AudioServer *p_server) {
+		p_server->_mix_step();
+	}
+
+	static uint32_t get_buffer_size(AudioServer *p_server) {
+		return p_server->buffer_size;
+	}
+
+	static bool is_virtual_voice(AudioServer *p_server, const Ref<AudioStreamPlayback> &p_playback) {
+		AudioServer::AudioStreamPlaybackListNode *playback = p_server->_find_playback_list_node(p_playback);
+		return playback && playback->is_virtual.is_set();
+	}
+};
+
+namespace TestAudioServer {
+
+// Records the order in which buses run their effects.
+class OrderRecorder {
+	Mutex mutex;
+	LocalVector<int> order;
+
+public:
+	void record(int p_bus) {
+		MutexLock lock(mutex);
+		order.push_back(p_bus);
+	}
+
+	int64_t find(int p_bus) const {
+		return order.find(p_bus);
+	}
+
+	uint32_t size() const { return order.size(); }
+
+	void clear() { order.clear(); }
+};
+
+class OrderEffectInstance : public AudioEffectInstance {
+public:
+	OrderRecorder *recorder = nullptr;
+	int bus = 0;
+
+	virtual void process(const AudioFrame *p_src_frames, AudioFrame *p_dst_frames, int p_frame_count) override {
+		recorder->record(bus);
+		memcpy(p_dst_frames, p_src_frames, sizeof(AudioFrame) * p_frame_count);
+	}
+};
+
+class OrderEffect : public AudioEffect {
+public:
+	OrderRecorder *recorder = nullptr;
+	int bus = 0;
+
+	virtual Ref<AudioEffectInstance> instantiate() override {
+		Ref<OrderEffectInstance> instance;
+		instance.instantiate();
+		instance->recorder = recorder;
+		instance->bus = bus;
+		return instance;
+	}
+};
+
+static bool _is_same_output(const Vector<AudioFrame> &p_a, const Vector<AudioFrame> &p_b) {
+	return p_a.size() == p_b.size() && memcmp(p_a.ptr(), p_b.ptr(), sizeof(AudioFrame) * p_a.size()) == 0;
+}
+
+// Master <- Bus 1 <- Bus 2 <- Bus 4, and Master <- Bus 3.
+static void _make_bus_graph() {
+	AudioServer *server = AudioServer::get_singleton();
+	server->set_bus_count(5);
+	for (int i = 1; i < 5; i++) {
+		server->set_bus_name(i, "Bus " + itos(i));
+	}
+	server->set_bus_send(2, "Bus 1");
+	server->set_bus_send(4, "Bus 2");
+	server->set_bus_volume_db(3, -6.0f);
+}
+
+static void _clear_bus_graph() {
+	AudioServer *server = AudioServer::get_singleton();
+	server->set_bus_count(1);
+	while (server->get_bus_effect_count(0) > 0) {
+		server->remove_bus_effect(0, 0);
+	}
+}
+
+TEST_CASE("[Audio][AudioServer] Processing buses in parallel matches processing them serially") {
+	AudioServer *server = AudioServer::get_singleton();
+	// Keep the driver thread from mixing in between, so the buses only run the mixes of this test.
+	server->lock();
+	_make_bus_graph();
+
+	Ref<AudioEffectAmplify> amplify;
+	amplify.instantiate();
+	amplify->set_volume_db(3.0f);
+	Ref<AudioEffectDelay> delay;
+	delay.instantiate();
+	server->add_bus_effect(0, amplify);
+	server->add_bus_effect(2, delay);
+	server->add_bus_effect(3, amplify);
+	server->add_bus_effect(4, delay);
+	server->add_bus_effect(4, amplify);
+
+	WorkerThreadPool *pool = memnew(WorkerThreadPool(false));
+	pool->init(2);
+
+	const int mix_count = 4;
+	LocalVector<Vector<AudioFrame>> serial;
+	for (int mix = 0; mix < mix_count; mix++) {
+		TestAudioServerInternalsAccessor::begin_mix(server);
+		TestAudioServerInternalsAccessor::process_buses(server, false);
+		for (int i = 0; i < server->get_bus_count(); i++) {
+			serial.push_back(TestAudioServerInternalsAccessor::get_bus_buffer(server, i));
+		}
+	}
+
+	TestAudioServerInternalsAccessor::reset_effects(server);
+	TestAudioServerInternalsAccessor::set_bus_effects_pool(server, pool);
+	uint32_t index = 0;
+	for (int mix = 0; mix < mix_count; mix++) {
+		TestAudioServerInternalsAccessor::begin_mix(server);
+		TestAudioServerInternalsAccessor::process_buses(server, true);
+		for (int i = 0; i < server->get_bus_count(); i++) {
+			CHECK_MESSAGE(_is_same_output(TestAudioServerInternalsAccessor::get_bus_buffer(server, i), serial[index++]), vformat("Bus %d should have the same output in mix %d.", i, mix));
+		}
+	}
+	TestAudioServerInternalsAccessor::set_bus_effects_pool(server, nullptr);
+
+	memdelete(pool);
+	_clear_bus_graph();
+	server->unlock();
+}
+
+TEST_CASE("[Audio][AudioServer] Buses are processed after every bus that sends to them") {
+	AudioServer *server = AudioServer::get_singleton();
+	// Keep the driver thread from mixing in between, so the buses only run the mixes of this test.
+	server->lock();
+	_make_bus_graph();
+
+	OrderRecorder recorder;
+	for (int i = 0; i < server->get_bus_count(); i++) {
+		Ref<OrderEffect> effect;
+		effect.instantiate();
+		effect->recorder = &recorder;
+		effect->bus = i;
+		server->add_bus_effect(i, effect);
+	}
+
+	WorkerThreadPool *pool = memnew(WorkerThreadPool(false));
+	pool->init(4);
+	TestAudioServerInternalsAccessor::set_bus_effects_pool(server, pool);
+
+	for (int mix = 0; mix < 8; mix++) {
+		recorder.clear();
+		TestAudioServerInternalsAccessor::begin_mix(server);
+		TestAudioServerInternalsAccessor::process_buses(server, true);
+
+		REQUIRE(recorder.size() == 5);
+		CHECK(recorder.find(4) < recorder.find(2));
+		CHECK(recorder.find(2) < recorder.find(1));
+		CHECK(recorder.find(1) < recorder.find(0));
+		CHECK(recorder.find(3) < recorder.find(0));
+	}
+
+	CHECK(TestAudioServerInternalsAccessor::get_bus_depth(server, 0) == 0);
+	CHECK(TestAudioServerInternalsAccessor::get_bus_depth(server, 1) == 1);
+	CHECK(TestAudioServerInternalsAccessor::get_bus_depth(server, 2) == 2);
+	CHECK(TestAudioServerInternalsAccessor::get_bus_depth(server, 3) == 1);
+	CHECK(TestAudioServerInternalsAccessor::get_bus_depth(server, 4) == 3);
+
+	TestAudioServerInternalsAccessor::set_bus_effects_pool(server, nullptr);
+	memdelete(pool);
+	_clear_bus_graph();
+	server->unlock();
+}
+
+// Plays a constant signal for `length` seconds, and can tell where it would be without mixing.
+class TimedPlayback : public AudioStreamPlayback {
+public:
+	double mix_rate = 0.0;
+	double length = 0.0;
+	int64_t position = 0; // In frames.
+	bool active = false;
+	uint32_t mixed_frames = 0;
+	double last_seek = -1.0;
+
+	virtual void start(double p_from_pos) override {
+		active = true;
+		position = p_from_pos * mix_rate;
+	}
+	virtual void stop() override { active = false; }
+	virtual bool is_playing() const override { return active; }
+	virtual double get_playback_position() const override { return position / mix_rate; }
+	virtual void seek(double p_time) override {
+		last_seek = p_time;
+		position = p_time * mix_rate;
+	}
+	virtual int mix(AudioFrame *p_buffer, float p_rate_scale, int p_frames) override {
+		for (int i = 0; i < p_frames; i++) {
+			p_buffer[i] = AudioFrame(0.5f, 0.5f);
+		}
+		position += p_frames;
+		mixed_frames += p_frames;
+		return p_frames;
+	}
+	virtual double get_position_after(double p_from_pos, double p_time) const override {
+		const double after = p_from_pos + p_time;
+		return after < length ? after : -1.0;
+	}
+};
+
+static Ref<TimedPlayback> _start_voice(int p_priority) {
+	AudioServer *server = AudioServer::get_singleton();
+	Ref<TimedPlayback> playback;
+	playback.instantiate();
+	playback->mix_rate = server->get_mix_rate();
+	playback->length = 60.0;
+
+	Vector<AudioFrame> volumes;
+	volumes.resize(AudioServer::MAX_CHANNELS_PER_BUS);
+	volumes.fill(AudioFrame(1.0f, 1.0f));
+	server->start_playback_stream(playback, server->get_bus_name(0), volumes, 0.0f, 1.0f, p_priority);
+	return playback;
+}
+
+TEST_CASE("[Audio][AudioServer] Voices over the limit become virtual and come back in time") {
+	AudioServer *server = AudioServer::get_singleton();
+	// Keep the driver thread from mixing in between, so positions only move with the mixes of this test.
+	server->lock();
+	server->set_bus_max_voices(0, 2);
+
+	Ref<TimedPlayback> low = _start_voice(0);
+	Ref<TimedPlayback> middle = _start_voice(5);
+	Ref<TimedPlayback> high = _start_voice(10);
+
+	const uint32_t buffer_size = TestAudioServerInternalsAccessor::get_buffer_size(server);
+	const double buffer_time = buffer_size / double(server->get_mix_rate());
+
+	// The lowest priority voice fades out over one mix, then stops being mixed.
+	TestAudioServerInternalsAccessor::mix_step(server);
+	CHECK(TestAudioServerInternalsAccessor::is_virtual_voice(server, low));
+	CHECK_FALSE(TestAudioServerInternalsAccessor::is_virtual_voice(server, middle));
+	CHECK_FALSE(TestAudioServerInternalsAccessor::is_virtual_voice(server, high));
+	CHECK(low->mixed_frames == buffer_size);
+
+	const int virtual_mixes = 5;
+	for (int i = 0; i < virtual_mixes; i++) {
+		TestAudioServerInternalsAccessor::mix_step(server);
+	}
+	CHECK_MESSAGE(low->mixed_frames == buffer_size, "Virtual voices should not be decoded.");
+	CHECK(middle->mixed_frames == buffer_size * (virtual_mixes + 1));
+	const double virtual_position = buffer_time * (virtual_mixes + 1);
+	CHECK(server->get_playback_position(low) == doctest::Approx(virtual_position));
+
+	// Stopping a voice frees a slot, the virtual voice catches up with where it would be and is mixed again.
+	server->stop_playback_stream(high);
+	TestAudioServerInternalsAccessor::mix_step(server);
+	CHECK_FALSE(TestAudioServerInternalsAccessor::is_virtual_voice(server, low));
+	CHECK(low->last_seek == doctest::Approx(virtual_position));
+	CHECK(low->mixed_frames == buffer_size * 2);
+	CHECK(low->get_playback_position() == doctest::Approx(virtual_position + buffer_time));
+
+	server->stop_playback_stream(low);
+	server->stop_playback_stream(middle);
+	TestAudioServerInternalsAccessor::mix_step(server);
+	server->set_bus_max_voices(0, 0);
+	server->unlock();
+}
+
+} // namespace TestAudioServer
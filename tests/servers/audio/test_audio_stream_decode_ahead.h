@@ -0,0 +1,152 @@
+/**************************************************************************/
+/*  test_audio_stream_decode_ahead.h                                      */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GODOT ENGINE                               */
+/*                        https://godotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+
+#pragma once
+
+#include "core/os/os.h"
+#include "servers/audio/audio_stream.h"
+#include "servers/audio/audio_stream_decode_ahead.h"
+
+#include "tests/test_macros.h"
+
+namespace TestAudioStreamDecodeAhead {
+
+// Outputs its frame index on the left channel, until `length` frames were decoded.
+class CountingPlayback : public AudioStreamPlaybackResampled {
+	int position = 0;
+	int length = 0;
+	bool active = false;
+
+protected:
+	virtual int _mix_internal(AudioFrame *p_buffer, int p_frames) override {
+		int mixed = 0;
+		while (active && mixed < p_frames) {
+			p_buffer[mixed++] = AudioFrame(position, 0);
+			active = ++position < length;
+		}
+		for (int i = mixed; i < p_frames; i++) {
+			p_buffer[i] = AudioFrame(0, 0);
+		}
+		return mixed;
+	}
+	virtual float get_stream_sampling_rate() override { return 22050; }
+
+public:
+	virtual void start(double p_from_pos = 0.0) override {
+		MutexLock lock(decoder_mutex);
+		active = true;
+		seek(p_from_pos);
+		begin_resample();
+	}
+	virtual void stop() override {
+		MutexLock lock(decoder_mutex);
+		active = false;
+		_discard_decoded_ahead();
+	}
+	virtual bool is_playing() const override { return active || _get_decoded_ahead_frames() > 0; }
+	virtual void seek(double p_time) override {
+		MutexLock lock(decoder_mutex);
+		_discard_decoded_ahead();
+		position = p_time * get_stream_sampling_rate();
+	}
+
+	int get_decoded_ahead_frames() const { return _get_decoded_ahead_frames(); }
+
+	CountingPlayback(int p_length, bool p_decode_ahead) {
+		length = p_length;
+		_set_decode_ahead_enabled(p_decode_ahead);
+	}
+	~CountingPlayback() {
+		_set_decode_ahead_enabled(false);
+	}
+};
+
+static void wait_for_decoded_frames(const Ref<CountingPlayback> &p_playback) {
+	for (int i = 0; i < 1000 && p_playback->get_decoded_ahead_frames() == 0; i++) {
+		OS::get_singleton()->delay_usec(1000);
+	}
+}
+
+TEST_CASE("[Audio][AudioStreamDecodeAhead] Decoding ahead mixes the same frames as decoding inline") {
+	const int length = 22050;
+	const int buffer_frames = 512;
+
+	// Disabled by default in project settings.
+	AudioStreamDecodeAhead *decoder_thread = nullptr;
+	if (!AudioStreamDecodeAhead::get_singleton()) {
+		decoder_thread = memnew(AudioStreamDecodeAhead(100));
+	}
+
+	Ref<CountingPlayback> inline_playback = memnew(CountingPlayback(length, false));
+	Ref<CountingPlayback> decode_ahead_playback = memnew(CountingPlayback(length, true));
+	inline_playback->start();
+	decode_ahead_playback->start();
+	wait_for_decoded_frames(decode_ahead_playback);
+	CHECK(decode_ahead_playback->get_decoded_ahead_frames() > 0);
+	CHECK(inline_playback->get_decoded_ahead_frames() == 0);
+
+	LocalVector<AudioFrame> expected;
+	LocalVector<AudioFrame> frames;
+	expected.resize(buffer_frames);
+	frames.resize(buffer_frames);
+
+	bool same_frames = true;
+	int total_mixed = 0;
+	for (int block = 0; block < 200; block++) {
+		if (block == 20) {
+			// Frames decoded before seeking must not be mixed.
+			inline_playback->seek(0.25);
+			decode_ahead_playback->seek(0.25);
+			wait_for_decoded_frames(decode_ahead_playback);
+		}
+		int expected_mixed = inline_playback->mix(expected.ptr(), 1.0, buffer_frames);
+		int mixed = decode_ahead_playback->mix(frames.ptr(), 1.0, buffer_frames);
+		REQUIRE(mixed == expected_mixed);
+		for (int i = 0; i < mixed; i++) {
+			same_frames = same_frames && frames[i].left == expected[i].left;
+		}
+		total_mixed += mixed;
+		if (mixed < buffer_frames) {
+			break;
+		}
+	}
+	CHECK(same_frames);
+	CHECK_MESSAGE(total_mixed < 200 * buffer_frames, "Both playbacks should have reached the end of the stream.");
+	CHECK_FALSE(decode_ahead_playback->is_playing());
+
+	decode_ahead_playback.unref();
+	inline_playback.unref();
+	if (decoder_thread) {
+		memdelete(decoder_thread);
+	}
+}
+
+} // namespace TestAudioStreamDecodeAhead
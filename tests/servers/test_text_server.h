@@ -56,6 +56,142 @@ TEST_SUITE("[TextServer]") {
 			}
 		}
 
+		SUBCASE("[TextServer] Glyph cache data") {
+			for (int i = 0; i < TextServerManager::get_singleton()->get_interface_count(); i++) {
+				Ref<TextServer> ts = TextServerManager::get_singleton()->get_interface(i);
+				CHECK_FALSE_MESSAGE(ts.is_null(), "Invalid TS interface.");
+
+				if (!ts->has_feature(TextServer::FEATURE_FONT_DYNAMIC)) {
+					continue;
+				}
+
+				RID font1 = ts->create_font();
+				ts->font_set_data_ptr(font1, _font_NotoSans_Regular, _font_NotoSans_Regular_size);
+				ts->font_render_range(font1, Vector2i(16, 0), 'A', 'Z');
+				CHECK_MESSAGE(ts->font_has_glyph_cache_data(font1, Vector2i(16, 0)), "Glyph cache data not reported.");
+				PackedByteArray data = ts->font_get_glyph_cache_data(font1, Vector2i(16, 0));
+				CHECK_FALSE_MESSAGE(data.is_empty(), "Glyph cache data is empty.");
+
+				RID font2 = ts->create_font();
+				ts->font_set_data_ptr(font2, _font_NotoSans_Regular, _font_NotoSans_Regular_size);
+				CHECK_FALSE_MESSAGE(ts->font_has_glyph_cache_data(font2, Vector2i(16, 0)), "Glyph cache data reported for an empty cache.");
+
+				ERR_PRINT_OFF;
+				ts->font_set_glyph_cache_data(font2, Vector2i(16, 0), data);
+				ERR_PRINT_ON;
+				CHECK_FALSE_MESSAGE(ts->font_has_glyph_cache_data(font2, Vector2i(16, 0)), "Glyph cache data referring to missing textures accepted.");
+
+				// Textures are loaded first, like when a saved font is loaded.
+				for (int64_t j = 0; j < ts->font_get_texture_count(font1, Vector2i(16, 0)); j++) {
+					ts->font_set_texture_image(font2, Vector2i(16, 0), j, ts->font_get_texture_image(font1, Vector2i(16, 0), j));
+				}
+				ts->font_set_glyph_cache_data(font2, Vector2i(16, 0), data);
+				CHECK(ts->font_has_glyph_cache_data(font2, Vector2i(16, 0)));
+
+				PackedInt32Array glyphs1 = ts->font_get_glyph_list(font1, Vector2i(16, 0));
+				PackedInt32Array glyphs2 = ts->font_get_glyph_list(font2, Vector2i(16, 0));
+				CHECK_EQ(glyphs1.size(), glyphs2.size());
+				for (int32_t gl : glyphs1) {
+					CHECK_EQ(ts->font_get_glyph_uv_rect(font1, Vector2i(16, 0), gl), ts->font_get_glyph_uv_rect(font2, Vector2i(16, 0), gl));
+					CHECK_EQ(ts->font_get_glyph_texture_idx(font1, Vector2i(16, 0), gl), ts->font_get_glyph_texture_idx(font2, Vector2i(16, 0), gl));
+					CHECK_EQ(ts->font_get_glyph_advance(font1, 16, gl), ts->font_get_glyph_advance(font2, 16, gl));
+				}
+
+				ts->free_rid(font1);
+				ts->free_rid(font2);
+			}
+		}
+
+		SUBCASE("[TextServer] Batch glyph rendering") {
+			for (int i = 0; i < TextServerManager::get_singleton()->get_interface_count(); i++) {
+				Ref<TextServer> ts = TextServerManager::get_singleton()->get_interface(i);
+				CHECK_FALSE_MESSAGE(ts.is_null(), "Invalid TS interface.");
+
+				if (!ts->has_feature(TextServer::FEATURE_FONT_DYNAMIC)) {
+					continue;
+				}
+
+				RID font1 = ts->create_font();
+				ts->font_set_data_ptr(font1, _font_NotoSans_Regular, _font_NotoSans_Regular_size);
+				RID font2 = ts->create_font();
+				ts->font_set_data_ptr(font2, _font_NotoSans_Regular, _font_NotoSans_Regular_size);
+
+				PackedInt32Array glyphs;
+				for (char32_t c = 'A'; c <= 'z'; c++) {
+					glyphs.push_back(ts->font_get_glyph_index(font1, 16, c, 0));
+				}
+				ts->font_render_glyphs(font1, Vector2i(16, 0), glyphs);
+				for (int32_t gl : glyphs) {
+					ts->font_render_glyph(font2, Vector2i(16, 0), gl);
+				}
+
+				CHECK_EQ(ts->font_get_glyph_list(font1, Vector2i(16, 0)).size(), ts->font_get_glyph_list(font2, Vector2i(16, 0)).size());
+				for (int32_t gl : glyphs) {
+					CHECK_EQ(ts->font_get_glyph_size(font1, Vector2i(16, 0), gl), ts->font_get_glyph_size(font2, Vector2i(16, 0), gl));
+					CHECK_EQ(ts->font_get_glyph_offset(font1, Vector2i(16, 0), gl), ts->font_get_glyph_offset(font2, Vector2i(16, 0), gl));
+					CHECK_EQ(ts->font_get_glyph_advance(font1, 16, gl), ts->font_get_glyph_advance(font2, 16, gl));
+				}
+
+				ts->free_rid(font1);
+				ts->free_rid(font2);
+			}
+		}
+
+		SUBCASE("[TextServer] Shaped text reuse") {
+			for (int i = 0; i < TextServerManager::get_singleton()->get_interface_count(); i++) {
+				Ref<TextServer> ts = TextServerManager::get_singleton()->get_interface(i);
+				CHECK_FALSE_MESSAGE(ts.is_null(), "Invalid TS interface.");
+
+				if (!ts->has_feature(TextServer::FEATURE_FONT_DYNAMIC) || !ts->has_feature(TextServer::FEATURE_SIMPLE_LAYOUT)) {
+					continue;
+				}
+
+				RID font1 = ts->create_font();
+				ts->font_set_data_ptr(font1, _font_NotoSans_Regular, _font_NotoSans_Regular_size);
+				ts->font_set_allow_system_fallback(font1, false);
+
+				Array font = { font1 };
+				String test = U"Shaped text reuse test";
+
+				RID ctx1 = ts->create_shaped_text();
+				ts->shaped_text_add_string(ctx1, test, font, 16);
+				RID ctx2 = ts->create_shaped_text();
+				ts->shaped_text_add_string(ctx2, test, font, 16);
+
+				CHECK_EQ(ts->shaped_text_get_glyph_count(ctx1), ts->shaped_text_get_glyph_count(ctx2));
+				CHECK_EQ(ts->shaped_text_get_width(ctx1), ts->shaped_text_get_width(ctx2));
+				CHECK_EQ(ts->shaped_text_get_ascent(ctx1), ts->shaped_text_get_ascent(ctx2));
+
+				// Changing font spacing must invalidate previously shaped results.
+				real_t width = ts->shaped_text_get_width(ctx1);
+				ts->font_set_spacing(font1, TextServer::SPACING_GLYPH, 4);
+				RID ctx3 = ts->create_shaped_text();
+				ts->shaped_text_add_string(ctx3, test, font, 16);
+				CHECK_GT(ts->shaped_text_get_width(ctx3), width);
+
+				// So must changing the baseline offset of a linked variation, which is baked into glyph offsets.
+				RID variation = ts->create_font_linked_variation(font1);
+				Array variation_font = { variation };
+				RID ctx4 = ts->create_shaped_text();
+				ts->shaped_text_add_string(ctx4, test, variation_font, 16);
+				REQUIRE(ts->shaped_text_get_glyph_count(ctx4) > 0);
+				real_t y_offset = ts->shaped_text_get_glyphs(ctx4)[0].y_off;
+				ts->font_set_baseline_offset(variation, 0.5);
+				RID ctx5 = ts->create_shaped_text();
+				ts->shaped_text_add_string(ctx5, test, variation_font, 16);
+				REQUIRE(ts->shaped_text_get_glyph_count(ctx5) > 0);
+				CHECK_GT(ts->shaped_text_get_glyphs(ctx5)[0].y_off, y_offset);
+
+				ts->free_rid(ctx5);
+				ts->free_rid(ctx4);
+				ts->free_rid(variation);
+				ts->free_rid(ctx3);
+				ts->free_rid(ctx2);
+				ts->free_rid(ctx1);
+				ts->free_rid(font1);
+			}
+		}
+
 		SUBCASE("[TextServer] Text layout: Font fallback") {
 			for (int i = 0; i < TextServerManager::get_singleton()->get_interface_count(); i++) {
 				Ref<TextServer> ts = TextServerManager::get_singleton()->get_interface(i);
@@ -84,9 +84,11 @@
 #include "tests/core/math/test_vector4.h"
 #include "tests/core/math/test_vector4i.h"
 #include "tests/core/object/test_class_db.h"
+#include "tests/core/object/test_message_queue.h"
 #include "tests/core/object/test_method_bind.h"
 #include "tests/core/object/test_object.h"
 #include "tests/core/object/test_undo_redo.h"
+#include "tests/core/os/test_lock_profiler.h"
 #include "tests/core/os/test_os.h"
 #include "tests/core/string/test_fuzzy_search.h"
 #include "tests/core/string/test_node_path.h"
@@ -144,6 +146,9 @@
 #include "tests/scene/test_viewport.h"
 #include "tests/scene/test_visual_shader.h"
 #include "tests/scene/test_window.h"
+#include "tests/servers/audio/test_audio_mix_kernels.h"
+#include "tests/servers/audio/test_audio_server.h"
+#include "tests/servers/audio/test_audio_stream_decode_ahead.h"
 #include "tests/servers/rendering/test_shader_preprocessor.h"
 #include "tests/servers/test_nav_heap.h"
 #include "tests/servers/test_text_server.h"
@@ -154,6 +159,7 @@
 #include "tests/scene/test_color_picker.h"
 #include "tests/scene/test_graph_node.h"
 #include "tests/scene/test_option_button.h"
+#include "tests/scene/test_rich_text_label.h"
 #include "tests/scene/test_split_container.h"
 #include "tests/scene/test_tab_bar.h"
 #include "tests/scene/test_tab_container.h"